@@ -0,0 +1,16 @@
+#!/bin/bash
+
+set -e
+
+source ./sources.sh
+source ./flags.sh
+
+EXECUTABLE_NAME="${BIN_PATH}/runBenchmark.o"
+MAIN_FILE="${MAIN_PATH}/runBenchmark.cpp"
+
+function compile_runBenchmark {
+    echo "Compiling runBenchmark..."
+    g++ ${PRODUCTION_FLAG_SET} -std="${C_VERSION}" -o "${EXECUTABLE_NAME}" "${MAIN_FILE}" ${DUCHESS_SOURCES} ${PLAYER_SOURCES}
+}
+
+compile_runBenchmark
@@ -22,13 +22,24 @@ DUCHESS_TEST_SOURCES="${DUCHESS_TEST_PATH}/testPosition.cpp
                 ${DUCHESS_TEST_PATH}/testMove.cpp
                 ${DUCHESS_TEST_PATH}/testTeamUtils.cpp
                 ${DUCHESS_TEST_PATH}/testMoveVector.cpp
-                ${DUCHESS_TEST_PATH}/testMoveVectorUtils.cpp"
+                ${DUCHESS_TEST_PATH}/testMoveVectorUtils.cpp
+                ${DUCHESS_TEST_PATH}/testBitboard.cpp
+                ${DUCHESS_TEST_PATH}/testMoveList.cpp
+                ${DUCHESS_TEST_PATH}/testCompactMove.cpp
+                ${DUCHESS_TEST_PATH}/testMoveVectorPool.cpp"
 
 PLAYER_TEST_SOURCES="${PLAYER_TEST_PATH}/testPlayer.cpp
                 ${PLAYER_TEST_PATH}/testSearchAnalytics.cpp
-                ${PLAYER_TEST_PATH}/testHeuristicCache.cpp
+                ${PLAYER_TEST_PATH}/testSearchContext.cpp
                 ${PLAYER_TEST_PATH}/testFeatureUtils.cpp
-                ${PLAYER_TEST_PATH}/testBrain.cpp"
+                ${PLAYER_TEST_PATH}/testBrain.cpp
+                ${PLAYER_TEST_PATH}/testTranspositionTable.cpp
+                ${PLAYER_TEST_PATH}/testWorkStealingPool.cpp
+                ${PLAYER_TEST_PATH}/testTimeManager.cpp
+                ${PLAYER_TEST_PATH}/testTimeControl.cpp
+                ${PLAYER_TEST_PATH}/testPrincipalVariation.cpp
+                ${PLAYER_TEST_PATH}/testMovePicker.cpp
+                ${PLAYER_TEST_PATH}/testReductionTable.cpp"
 
 # Duchess sources
 DUCHESS_SOURCES="${DUCHESS_PATH}/Piece.cpp
@@ -40,7 +51,10 @@ DUCHESS_SOURCES="${DUCHESS_PATH}/Piece.cpp
                 ${DUCHESS_PATH}/TeamUtils.cpp
                 ${DUCHESS_PATH}/GeneralUtils.cpp
                 ${DUCHESS_PATH}/MoveVector.cpp
-                ${DUCHESS_PATH}/MoveVectorUtils.cpp"
+                ${DUCHESS_PATH}/MoveVectorUtils.cpp
+                ${DUCHESS_PATH}/Bitboard.cpp
+                ${DUCHESS_PATH}/MoveVectorPool.cpp
+                ${DUCHESS_PATH}/ZobristUtils.cpp"
 
 # Game sources
 GAME_SOURCES="${GAME_PATH}/Game.cpp
@@ -54,8 +68,15 @@ GAME_TEST_SOURCES="${GAME_TEST_PATH}/testGameLog.cpp
 PLAYER_SOURCES="${PLAYER_PATH}/Player.cpp
                 ${PLAYER_PATH}/FeatureUtils.cpp
                 ${PLAYER_PATH}/SearchAnalytics.cpp
-                ${PLAYER_PATH}/HeuristicCache.cpp
-                ${PLAYER_PATH}/Brain.cpp"
+                ${PLAYER_PATH}/SearchContext.cpp
+                ${PLAYER_PATH}/MovePicker.cpp
+                ${PLAYER_PATH}/ReductionTable.cpp
+                ${PLAYER_PATH}/Brain.cpp
+                ${PLAYER_PATH}/TranspositionTable.cpp
+                ${PLAYER_PATH}/WorkStealingPool.cpp
+                ${PLAYER_PATH}/YoungBrothersWaitSearch.cpp
+                ${PLAYER_PATH}/TimeManager.cpp
+                ${PLAYER_PATH}/TimeControl.cpp"
 
 SERVER_SOURCES="${SERVER_PATH}/Server.cpp
                 ${SERVER_PATH}/LegacyUtils.cpp"
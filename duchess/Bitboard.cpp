@@ -0,0 +1,35 @@
+#define NDEBUG
+
+#include "Bitboard.h"
+
+#include <cassert>
+#include <string>
+
+BoardIndex Bitboard::lowest() const {
+    assert(!this->isEmpty());
+    short word = 0;
+    while (m_words[word] == 0) {
+        ++word;
+    }
+    return (BoardIndex) (word * 64 + __builtin_ctzll(m_words[word]));
+}
+
+BoardIndex Bitboard::popLowest() {
+    const BoardIndex index = this->lowest();
+    this->clear(index);
+    return index;
+}
+
+std::string Bitboard::toString() const {
+    std::string result;
+    short i;
+    for (i = 0; i < NUM_BITS; ++i) {
+        if (this->test((BoardIndex) i)) {
+            if (!result.empty()) {
+                result += " ";
+            }
+            result += std::to_string(i);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,117 @@
+#ifndef DUCHESS_CPP_BITBOARD_H
+#define DUCHESS_CPP_BITBOARD_H
+
+#include "Position.h"
+
+#include <cstdint>
+#include <string>
+
+// A set of board indices (0 - 157) packed into three 64 bit words
+// Bit i of the board lives in word i / 64 at offset i % 64
+class Bitboard {
+public:
+    static const short NUM_WORDS = 3;
+    static const short NUM_BITS = 158;
+
+    Bitboard() : m_words{0, 0, 0} { }
+
+    Bitboard(const uint64_t t_word0, const uint64_t t_word1, const uint64_t t_word2) :
+            m_words{t_word0, t_word1, t_word2} { }
+
+    // Returns a mask with just the given index set
+    static Bitboard fromIndex(const BoardIndex t_index) {
+        Bitboard result;
+        result.set(t_index);
+        return result;
+    }
+
+    void set(const BoardIndex t_index) {
+        m_words[t_index >> 6] |= (uint64_t(1) << (t_index & 63));
+    }
+
+    void clear(const BoardIndex t_index) {
+        m_words[t_index >> 6] &= ~(uint64_t(1) << (t_index & 63));
+    }
+
+    bool test(const BoardIndex t_index) const {
+        return (m_words[t_index >> 6] >> (t_index & 63)) & 1;
+    }
+
+    void reset() {
+        m_words[0] = 0;
+        m_words[1] = 0;
+        m_words[2] = 0;
+    }
+
+    bool isEmpty() const {
+        return (m_words[0] | m_words[1] | m_words[2]) == 0;
+    }
+
+    int count() const {
+        return __builtin_popcountll(m_words[0]) + __builtin_popcountll(m_words[1]) + __builtin_popcountll(m_words[2]);
+    }
+
+    // Returns the smallest index in the set. Undefined if the set is empty
+    BoardIndex lowest() const;
+
+    // Removes and returns the smallest index in the set. Undefined if the set is empty
+    BoardIndex popLowest();
+
+    uint64_t getWord(const short t_word) const {
+        return m_words[t_word];
+    }
+
+    Bitboard operator&(const Bitboard& t_other) const {
+        return Bitboard(m_words[0] & t_other.m_words[0], m_words[1] & t_other.m_words[1], m_words[2] & t_other.m_words[2]);
+    }
+
+    Bitboard operator|(const Bitboard& t_other) const {
+        return Bitboard(m_words[0] | t_other.m_words[0], m_words[1] | t_other.m_words[1], m_words[2] | t_other.m_words[2]);
+    }
+
+    Bitboard operator^(const Bitboard& t_other) const {
+        return Bitboard(m_words[0] ^ t_other.m_words[0], m_words[1] ^ t_other.m_words[1], m_words[2] ^ t_other.m_words[2]);
+    }
+
+    // Complement within the 158 board bits (the unused high bits of the last word stay clear)
+    Bitboard operator~() const {
+        return Bitboard(~m_words[0], ~m_words[1], ~m_words[2] & ((uint64_t(1) << (NUM_BITS - 128)) - 1));
+    }
+
+    Bitboard& operator&=(const Bitboard& t_other) {
+        m_words[0] &= t_other.m_words[0];
+        m_words[1] &= t_other.m_words[1];
+        m_words[2] &= t_other.m_words[2];
+        return *this;
+    }
+
+    Bitboard& operator|=(const Bitboard& t_other) {
+        m_words[0] |= t_other.m_words[0];
+        m_words[1] |= t_other.m_words[1];
+        m_words[2] |= t_other.m_words[2];
+        return *this;
+    }
+
+    Bitboard& operator^=(const Bitboard& t_other) {
+        m_words[0] ^= t_other.m_words[0];
+        m_words[1] ^= t_other.m_words[1];
+        m_words[2] ^= t_other.m_words[2];
+        return *this;
+    }
+
+    bool operator==(const Bitboard& t_other) const {
+        return m_words[0] == t_other.m_words[0] && m_words[1] == t_other.m_words[1] && m_words[2] == t_other.m_words[2];
+    }
+
+    bool operator!=(const Bitboard& t_other) const {
+        return !(*this == t_other);
+    }
+
+    // Space separated list of the indices in the set, e.g. "1 12 157"
+    std::string toString() const;
+
+private:
+    uint64_t m_words[NUM_WORDS];
+};
+
+#endif //DUCHESS_CPP_BITBOARD_H
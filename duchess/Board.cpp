@@ -7,6 +7,7 @@
 #include "MoveVector.h"
 #include "MoveVectorUtils.h"
 #include "GeneralUtils.h"
+#include "ZobristUtils.h"
 
 #include <vector>
 #include <deque>
@@ -14,7 +15,8 @@
 #include <iostream>
 #include <algorithm>
 
-Board::Board() {
+Board::Board() :
+        m_hash(ZobristUtils::getSideToMoveKey(1)), m_sideToMove(1) {
     // Populate positions, squares, pieces
     BoardIndex i;
     for (i = 0; i <= 157; ++i) {
@@ -49,6 +51,7 @@ Board::Board() {
             Piece* p = new Piece(m_positions[posIndex], type, owner);
 
             this->m_squares[posIndex] = p;
+            this->addPieceToOccupancy(p, posIndex);
             piecesForPlayer.push_back(p);
         }
         this->m_pieces.push_back(piecesForPlayer);
@@ -56,10 +59,12 @@ Board::Board() {
 
     // Initialise checkmateRecords as indicating no one is in checkmate
     this->m_checkmateRecords = {false, false, false, false, false, false};
+    this->m_checkmateRecordsKnown = {false, false, false, false, false, false};
 
 }
 
-Board::Board(std::vector<std::vector<Piece>> t_pieces) {
+Board::Board(std::vector<std::vector<Piece>> t_pieces) :
+        m_hash(ZobristUtils::getSideToMoveKey(1)), m_sideToMove(1) {
     // Populate positions, squares
     BoardIndex i;
     for (i = 0; i <= 157; ++i) {
@@ -91,6 +96,9 @@ Board::Board(std::vector<std::vector<Piece>> t_pieces) {
             }
 
             this->m_squares[posIndex] = p;
+            if (posIndex != 0) {
+                this->addPieceToOccupancy(p, posIndex);
+            }
             piecesForPlayer.push_back(p);
         }
         this->m_pieces.push_back(piecesForPlayer);
@@ -98,11 +106,68 @@ Board::Board(std::vector<std::vector<Piece>> t_pieces) {
 
     // Initialise the checkmate records as all false
     this->m_checkmateRecords = {false, false, false, false, false, false};
+    this->m_checkmateRecordsKnown = {false, false, false, false, false, false};
+}
+
+Board::Board(const Board& t_other) :
+        m_checkmateRecords(t_other.m_checkmateRecords), m_checkmateRecordsKnown(t_other.m_checkmateRecordsKnown),
+        m_occupancy(t_other.m_occupancy), m_hash(t_other.m_hash), m_sideToMove(t_other.m_sideToMove) {
+    std::copy(t_other.m_playerOccupancy, t_other.m_playerOccupancy + 6, m_playerOccupancy);
+    std::copy(t_other.m_teamOccupancy, t_other.m_teamOccupancy + 2, m_teamOccupancy);
+    std::copy(t_other.m_pieceTypeOccupancy, t_other.m_pieceTypeOccupancy + 9, m_pieceTypeOccupancy);
+
+    BoardIndex i;
+    for (i = 0; i <= 157; ++i) {
+        this->m_positions.push_back(PositionUtils::boardIndexToPositionSixPlayer(i));
+        this->m_squares.push_back(nullptr);
+    }
+
+    // Each piece is recreated in the same slot, on our copy of its position
+    short player;
+    for (player = 0; player < 6; ++player) {
+        std::vector<Piece*> piecesForPlayer;
+        for (auto const& otherPiece : t_other.m_pieces[player]) {
+            const BoardIndex posIndex = otherPiece->getPosition()->getBoardIndex();
+            piecesForPlayer.push_back(new Piece(m_positions[posIndex], otherPiece->getType(), otherPiece->getOwner()));
+        }
+        this->m_pieces.push_back(piecesForPlayer);
+    }
+
+    for (i = 0; i <= 157; ++i) {
+        const Piece* otherPiece = t_other.m_squares[i];
+        if (otherPiece != nullptr) {
+            m_squares[i] = m_pieces[otherPiece->getOwner() - 1][t_other.getPieceSlot(otherPiece)];
+        }
+    }
+
+    // Every move vector is in exactly one piece's active list, so going through those copies each one once
+    short slot;
+    for (player = 0; player < 6; ++player) {
+        for (slot = 0; slot < CompactMove::PIECES_PER_PLAYER; ++slot) {
+            const Piece* otherPiece = t_other.m_pieces[player][slot];
+            Piece* activePiece = m_pieces[player][slot];
+            for (auto const& otherVectors : {otherPiece->getActiveAttackingVectors(), otherPiece->getActiveDefendingVectors()}) {
+                for (auto const& otherVector : otherVectors) {
+                    const Piece* otherPassive = otherVector->getPassivePiece();
+                    Piece* passivePiece = m_pieces[otherPassive->getOwner() - 1][t_other.getPieceSlot(otherPassive)];
+                    m_moveVectorPool.create(activePiece, passivePiece, *otherVector)->registerSelf();
+                }
+            }
+        }
+    }
 }
 
 Board::~Board() {
-    // Free up the Pieces we created
+    // Free up all the move vectors at once, so the pieces have nothing left to delete
     short i;
+    for (i = 0; i < 6; ++i) {
+        for (auto piece : m_pieces[i]) {
+            piece->forgetAllMoveVectors();
+        }
+    }
+    m_moveVectorPool.reset();
+
+    // Free up the Pieces we created
     for (i = 0; i < 6; ++i) {
         for (auto piece : m_pieces[i]) {
             delete piece;
@@ -139,15 +204,68 @@ std::vector<Piece*> Board::getPiecesForPlayer(const short t_playerNumber) const
     return m_pieces[t_playerNumber - 1];
 }
 
+short Board::getPieceSlot(const Piece* t_piece) const {
+    if (t_piece == nullptr) {
+        return CompactMove::NO_PIECE;
+    }
+    const std::vector<Piece*>& playerPieces = m_pieces[t_piece->getOwner() - 1];
+    short slot;
+    for (slot = 0; slot < CompactMove::PIECES_PER_PLAYER; ++slot) {
+        if (playerPieces[slot] == t_piece) {
+            return slot;
+        }
+    }
+    return CompactMove::NO_PIECE;
+}
+
+CompactMove Board::toCompactMove(const Move& t_move) const {
+    if (t_move.isNull()) {
+        CompactMove nullMove;
+        return nullMove;
+    }
+
+    const Piece* pieceTaken = t_move.getPieceTaken();
+    const Piece* replacePiece = t_move.getReplacePiece();
+    const short takenSlot = this->getPieceSlot(pieceTaken);
+    const short replaceSlot = this->getPieceSlot(replacePiece);
+    assert((pieceTaken == nullptr) == (takenSlot == CompactMove::NO_PIECE));
+    assert((replacePiece == nullptr) == (replaceSlot == CompactMove::NO_PIECE));
+
+    return CompactMove(t_move.getFromPosition()->getBoardIndex(), t_move.getToPosition()->getBoardIndex(),
+                       pieceTaken == nullptr ? 0 : pieceTaken->getOwner(), takenSlot,
+                       replacePiece == nullptr ? 0 : replacePiece->getOwner(), replaceSlot);
+}
+
+Move Board::fromCompactMove(const CompactMove t_move) const {
+    if (t_move.isNull()) {
+        Move nullMove;
+        return nullMove;
+    }
+
+    Piece* pieceTaken = t_move.hasPieceTaken() ? m_pieces[t_move.getPieceTakenOwner() - 1][t_move.getPieceTakenSlot()] : nullptr;
+    Piece* replacePiece = t_move.hasReplacePiece() ? m_pieces[t_move.getReplacePieceOwner() - 1][t_move.getReplacePieceSlot()] : nullptr;
+
+    Move m (this->getPosition(t_move.getFromIndex()), this->getPosition(t_move.getToIndex()), pieceTaken, replacePiece);
+    return m;
+}
+
 void Board::markPlayerInCheckmate(const short t_player) {
     m_checkmateRecords[t_player - 1] = true;
+    m_checkmateRecordsKnown[t_player - 1] = true;
 }
 
 void Board::markPlayerNotInCheckmate(const short t_player) {
     m_checkmateRecords[t_player - 1] = false;
+    m_checkmateRecordsKnown[t_player - 1] = true;
 }
 
+// Checkmate records are worked out on demand, and remembered until the next move is applied or undone
 bool Board::isPlayerInCheckmate(const short t_player) const {
+    if (!m_checkmateRecordsKnown[t_player - 1]) {
+        // In checkmate if someone is actively attacking our king (i.e. in check) and we have no legal moves
+        m_checkmateRecords[t_player - 1] = this->isPlayerInCheck(t_player) && !this->hasAnyLegalMove(t_player);
+        m_checkmateRecordsKnown[t_player - 1] = true;
+    }
     return m_checkmateRecords[t_player - 1];
 }
 
@@ -166,27 +284,33 @@ TeamType Board::getWinner() const {
 }
 
 std::vector<Position*> Board::getAccessibleSquares (const Piece* t_piece) const {
-    std::vector<Position*> accessiblePositions;
+    PositionList accessiblePositions;
+    this->getAccessibleSquares(t_piece, accessiblePositions);
+    return accessiblePositions.toVector();
+}
+
+void Board::getAccessibleSquares(const Piece* t_piece, PositionList& t_accessiblePositions) const {
+    t_accessiblePositions.clear();
     const PieceType pieceType = t_piece->getType();
     const Position* piecePosition = t_piece->getPosition();
 
     if (pieceType == PieceType::PAWN) {
         // PAWN
         // Adjacent squares for regular movement
-        const std::vector<BoardIndex>& adjacentSquares = PositionUtils::getAdjacentSquareIndices(piecePosition);
+        const BoardIndexList adjacentSquares = PositionUtils::getAdjacentSquareIndices(piecePosition);
         for(auto const& adjacentSquareIndex: adjacentSquares) {
             Position* pos = this->getPosition(adjacentSquareIndex);
             if (!this->doesSquareContainPiece(pos)) {
-                accessiblePositions.push_back(pos);
+                t_accessiblePositions.push_back(pos);
             }
         }
 
         // Taking on diagonals
-        const std::vector<BoardIndex>& diagonalSquares = PositionUtils::getDiagonalSquareIndices(piecePosition);
+        const BoardIndexList diagonalSquares = PositionUtils::getDiagonalSquareIndices(piecePosition);
         for (auto const& diagonalSquareIndex: diagonalSquares) {
             Position* pos = this->getPosition(diagonalSquareIndex);
             if (this->doesSquareContainEnemy(pos, t_piece)) {
-                accessiblePositions.push_back(pos);
+                t_accessiblePositions.push_back(pos);
             }
         }
 
@@ -195,64 +319,38 @@ std::vector<Position*> Board::getAccessibleSquares (const Piece* t_piece) const
         //
         // Note we exclude Wizards from this branch, however, as their unit moves are equivalent to "teleportations next to self", which
         // are added in the Wizard-adjacent check below
-        const std::vector<BoardIndex>& allAdjacent = PositionUtils::getAdjacentAndDiagonalSquareIndices(piecePosition);
+        const BoardIndexList allAdjacent = PositionUtils::getAdjacentAndDiagonalSquareIndices(piecePosition);
         for (auto const& adjacentSquareIndex : allAdjacent) {
             Position* pos = this->getPosition(adjacentSquareIndex);
             if (!this->doesSquareContainAlly(pos, t_piece)) {
-                accessiblePositions.push_back(pos);
+                t_accessiblePositions.push_back(pos);
             }
         }
     }
 
     if (pieceType == PieceType::KNIGHT || pieceType == PieceType::DUCHESS || pieceType == PieceType::FORTRESS) {
         // Each of these pieces can take on knight-moves
-        const std::vector<BoardIndex>& knightAdjacent = PositionUtils::getKnightMovesFromPosition(piecePosition);
+        const BoardIndexList knightAdjacent = PositionUtils::getKnightMovesFromPosition(piecePosition);
         for (auto const& knightAdjacentIndex : knightAdjacent) {
             Position* pos = this->getPosition(knightAdjacentIndex);
             if (!this->doesSquareContainAlly(pos, t_piece)) {
-                accessiblePositions.push_back(pos);
+                t_accessiblePositions.push_back(pos);
             }
         }
     }
 
     if (piecePosition->isVortex()) {
+        // Rook-style lines leave through the adjacent squares, bishop-style lines through the diagonal ones
+        short ray;
         if (pieceType == PieceType::ROOK || pieceType == PieceType::FORTRESS || pieceType == PieceType::QUEEN) {
-            const std::vector<BoardIndex>& adjacentSquares = PositionUtils::getAdjacentSquareIndices(piecePosition);
-            short direction = PositionUtils::DIRECTION_OUT;
-            for (auto const& index : adjacentSquares) {
-                short tempDirection = direction;
-                Position* prev = this->getPosition(piecePosition);
-                Position* cur = this->getPosition(index);
-                // Can't go off board, can't go past an enemy, can't go onto ally
-                while (!cur->isOffBoard() && !this->doesSquareContainEnemy(prev, t_piece) && !this->doesSquareContainAlly(cur, t_piece)) {
-                    accessiblePositions.push_back(cur);
-                    const BoardIndex nextInLineIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur, tempDirection);
-                    const short flapChange = PositionUtils::getFlapChange(prev, cur);
-                    tempDirection = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(tempDirection,
-                                                                                                             flapChange);
-                    prev = cur;
-                    cur = this->getPosition(nextInLineIndex);
-                }
+            for (ray = 0; ray < PositionUtils::NUM_VORTEX_ADJACENT_RAYS; ++ray) {
+                this->appendAccessibleSquaresAlongRay(t_piece, PositionUtils::getVortexRay(ray), t_accessiblePositions);
             }
         }
 
         if (pieceType == PieceType::BISHOP || pieceType == PieceType::QUEEN || pieceType == PieceType::DUCHESS) {
-            const std::vector<BoardIndex>& diagonalSquares = PositionUtils::getDiagonalSquareIndices(piecePosition);
-            short direction = PositionUtils::DIRECTION_OUT_ANTICLOCKWISE;
-            for (auto const& index : diagonalSquares) {
-                short tempDirection = direction;
-                Position* prev = this->getPosition(piecePosition);
-                Position* cur = this->getPosition(index);
-                // Can't go off board, can't go past an enemy, can't go onto ally
-                while (!cur->isOffBoard() && !this->doesSquareContainEnemy(prev, t_piece) && !this->doesSquareContainAlly(cur, t_piece)) {
-                    accessiblePositions.push_back(cur);
-                    const BoardIndex nextInLineIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur, tempDirection);
-                    const short flapChange = PositionUtils::getFlapChange(prev, cur);
-                    tempDirection = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(tempDirection,
-                                                                                                             flapChange);
-                    prev = cur;
-                    cur = this->getPosition(nextInLineIndex);
-                }
+            for (ray = PositionUtils::NUM_VORTEX_ADJACENT_RAYS; ray < PositionUtils::NUM_VORTEX_RAYS; ++ray) {
+                this->appendAccessibleSquaresAlongRay(t_piece, PositionUtils::getVortexRay(ray), t_accessiblePositions);
             }
         }
 
@@ -263,11 +361,8 @@ std::vector<Position*> Board::getAccessibleSquares (const Piece* t_piece) const
             short startDirection;
             for (startDirection = PositionUtils::DIRECTION_CLOCKWISE;
                  startDirection <= PositionUtils::DIRECTION_OUT; ++startDirection) {
-                const std::vector<Position *> positionsAlongLine = this->getAccessibleSquaresAlongDirection(t_piece,
-                                                                                                            startDirection);
-                // append positionsAlongLine to accessiblePositions
-                accessiblePositions.insert(std::end(accessiblePositions), std::begin(positionsAlongLine),
-                                           std::end(positionsAlongLine));
+                this->appendAccessibleSquaresAlongRay(t_piece, PositionUtils::getRay(piecePosition->getBoardIndex(), startDirection),
+                                                      t_accessiblePositions);
             }
         }
 
@@ -277,57 +372,64 @@ std::vector<Position*> Board::getAccessibleSquares (const Piece* t_piece) const
             short startDirection;
             for (startDirection = PositionUtils::DIRECTION_IN_CLOCKWISE;
                  startDirection <= PositionUtils::DIRECTION_OUT_ANTICLOCKWISE; ++startDirection) {
-                const std::vector<Position *> &positionsAlongLine = this->getAccessibleSquaresAlongDirection(t_piece,
-                                                                                                             startDirection);
-                // append positionsAlongLine to accessiblePositions
-                accessiblePositions.insert(std::end(accessiblePositions), std::begin(positionsAlongLine),
-                                           std::end(positionsAlongLine));
+                this->appendAccessibleSquaresAlongRay(t_piece, PositionUtils::getRay(piecePosition->getBoardIndex(), startDirection),
+                                                      t_accessiblePositions);
             }
         }
     }
     // If piece is adjacent to wizard, add in the teleportable squares
     if (this->isPieceWizardAdjacent(t_piece)) {
-        const std::vector<BoardIndex>& teleportableSquares = this->getTeleportableSquares(t_piece);
-        for (auto const& teleportableSquare : teleportableSquares) {
-            Position* pos = this->getPosition(teleportableSquare);
+        PositionList teleportableSquares;
+        this->getTeleportableSquares(t_piece, teleportableSquares);
+        for (auto const& pos : teleportableSquares) {
             // Don't add if duplicate or if contains ally
-            if (!doesSquareContainAlly(pos, t_piece) &&
-                    std::find(accessiblePositions.begin(), accessiblePositions.end(), pos) == accessiblePositions.end()) {
-                accessiblePositions.push_back(pos);
+            if (!doesSquareContainAlly(pos, t_piece) && !t_accessiblePositions.contains(pos)) {
+                t_accessiblePositions.push_back(pos);
             }
         }
     }
-
-    return accessiblePositions;
 }
 
 std::vector<Position*> Board::getAccessibleSquaresAlongDirection(const Piece* t_piece, const short t_startDirection) const {
-    std::vector<Position*> accessiblePositions;
+    PositionList accessiblePositions;
+    const BoardIndex* ray = PositionUtils::getRay(t_piece->getPosition()->getBoardIndex(), t_startDirection);
+    this->appendAccessibleSquaresAlongRay(t_piece, ray, accessiblePositions);
 
-    short direction = t_startDirection;
-    Position* startPosition = t_piece->getPosition();
-    Position* prev = startPosition;
-    const BoardIndex posIndex = PositionUtils::getIndexOfPositionInDirection(startPosition, t_startDirection);
-    Position* curr = this->getPosition(posIndex);
-    while (!curr->isOffBoard() && !this->doesSquareContainAlly(curr, t_piece) && !this->doesSquareContainEnemy(prev, t_piece)) {
-        // Keep extending along line adding positions
-        // Finish one short of an ally, or on top of an enemy, or when off board
-        accessiblePositions.push_back(curr);
-        const BoardIndex nextCurrIndex = PositionUtils::getIndexOfNextSquareInLine(prev, curr, direction);
-        const short flapChange = PositionUtils::getFlapChange(prev, curr);
-        direction = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(direction, flapChange);
-        prev = curr;
-        curr = this->getPosition(nextCurrIndex);
-    }
-
-    return accessiblePositions;
+    return accessiblePositions.toVector();
+}
+
+// Keep extending along the line adding positions
+// Finish one short of an ally, or on top of an enemy, or when off board
+void Board::appendAccessibleSquaresAlongRay(const Piece* t_piece, const BoardIndex* t_ray,
+                                            PositionList& t_accessiblePositions) const {
+    const short owner = t_piece->getOwner();
+    const Bitboard& allies = m_teamOccupancy[owner % 2];
+    const Bitboard& enemies = m_teamOccupancy[1 - (owner % 2)];
+
+    const BoardIndex* square;
+    for (square = t_ray; *square != 0 && !allies.test(*square); ++square) {
+        t_accessiblePositions.push_back(this->getPosition(*square));
+        if (enemies.test(*square)) {
+            break;
+        }
+    }
 }
 
 // Given that t_piece is adjacent to (or is) a friendly wizard, returns a list of positions that can therefore be accessed
 // using teleportation (including self-teleportation for wizards, which is equivalent to a KING move)
 std::vector<BoardIndex> Board::getTeleportableSquares(const Piece* t_piece) const {
-    const short originalOwner = t_piece->getOwner();
+    PositionList squares;
+    this->getTeleportableSquares(t_piece, squares);
     std::vector<BoardIndex> positions;
+    for (auto const& pos : squares) {
+        positions.push_back(pos->getBoardIndex());
+    }
+    return positions;
+}
+
+void Board::getTeleportableSquares(const Piece* t_piece, PositionList& t_squares) const {
+    t_squares.clear();
+    const short originalOwner = t_piece->getOwner();
     // For each wizard on my team who is not Off Board
     short pieceOwner;
     for (pieceOwner = 1; pieceOwner <= 6; ++pieceOwner) {
@@ -336,19 +438,17 @@ std::vector<BoardIndex> Board::getTeleportableSquares(const Piece* t_piece) cons
             const Position* wizardPosition = this->getPiecesForPlayer(pieceOwner)[11]->getPosition();
             if (!wizardPosition->isOffBoard()) {
                 // Get the squares adjacent and diagonal of them
-                const std::vector<BoardIndex>& adjacentSquares = PositionUtils::getAdjacentAndDiagonalSquareIndices(wizardPosition);
+                const BoardIndexList adjacentSquares = PositionUtils::getAdjacentAndDiagonalSquareIndices(wizardPosition);
 
                 // For each of those squares add it to positions
                 for (auto const& adjacentSquareIndex : adjacentSquares) {
                     if (this->getPieceAtPosition(adjacentSquareIndex) != t_piece) {
-                        positions.push_back(adjacentSquareIndex);
+                        t_squares.push_back(this->getPosition(adjacentSquareIndex));
                     }
                 }
             }
         }
     }
-
-    return positions;
 }
 
 // Tells us if a piece is adjacent to a wizard (i.e. if it is elligible to teleport)
@@ -359,11 +459,14 @@ bool Board::isPieceWizardAdjacent(const Piece* t_piece) const {
     if (t_piece->getType() == PieceType::WIZARD) {
         return true;
     } else {
-        const short owner = t_piece->getOwner();
+        const Bitboard alliedWizards = this->getPieceTypeOccupancy(PieceType::WIZARD) &
+                                       m_teamOccupancy[t_piece->getOwner() % 2];
+        if (alliedWizards.isEmpty()) {
+            return false;
+        }
 
         for(auto const& adjacentSquare : PositionUtils::getAdjacentAndDiagonalSquareIndices(t_piece->getPosition())) {
-            const Piece* p = this->getPieceAtPosition(adjacentSquare);
-            if (p != nullptr && p->getType() == PieceType::WIZARD && TeamUtils::isSameTeam(owner, p->getOwner())) {
+            if (alliedWizards.test(adjacentSquare)) {
                 return true;
             }
         }
@@ -373,7 +476,7 @@ bool Board::isPieceWizardAdjacent(const Piece* t_piece) const {
 }
 
 std::vector<Piece*> Board::getAdjacentPieces(const Piece* t_piece) const {
-    const std::vector<BoardIndex>& adjacentSquares = PositionUtils::getAdjacentAndDiagonalSquareIndices(t_piece->getPosition());
+    const BoardIndexList adjacentSquares = PositionUtils::getAdjacentAndDiagonalSquareIndices(t_piece->getPosition());
     std::vector<Piece*> adjacentPieces;
 
     for (auto const& adjacentIndex : adjacentSquares) {
@@ -389,78 +492,104 @@ std::vector<Piece*> Board::getAdjacentPieces(const Piece* t_piece) const {
 
 bool Board::doesSquareContainPiece(const Position* t_position) const {
     assert(t_position != nullptr && !t_position->isOffBoard());
-    return this->getPieceAtPosition(t_position) != nullptr;
+    return m_occupancy.test(t_position->getBoardIndex());
 }
 
 bool Board::doesSquareContainEnemy(const Position* t_position, const Piece* t_piece) const {
     assert(t_position != nullptr && !t_position->isOffBoard() && t_piece != nullptr);
-    bool result = false;
-
-    Piece* pieceInPosition = this->getPieceAtPosition(t_position);
-    if (pieceInPosition != nullptr) {
-        result = !(TeamUtils::isSameTeam(t_piece->getOwner(), pieceInPosition->getOwner()));
-    }
-
-    return result;
+    // Enemies are on the other team, i.e. have the other parity
+    return m_teamOccupancy[1 - (t_piece->getOwner() % 2)].test(t_position->getBoardIndex());
 }
 
 bool Board::doesSquareContainAlly(const Position* t_position, const Piece* t_piece) const {
-    return this->doesSquareContainPiece(t_position) && !this->doesSquareContainEnemy(t_position, t_piece);
+    assert(t_position != nullptr && !t_position->isOffBoard() && t_piece != nullptr);
+    return m_teamOccupancy[t_piece->getOwner() % 2].test(t_position->getBoardIndex());
 }
 
 std::vector<Move> Board::getLegalMoves(const short t_player) const {
-    std::vector<Move> legalMoves;
-    std::vector<Position*> blockableSquares;
-    const Piece* myKing = this->getPiecesForPlayer(t_player)[12];
+    MoveList legalMoves;
+    this->getLegalMoves(t_player, legalMoves);
+    return legalMoves.toVector();
+}
+
+void Board::getLegalMoves(const short t_player, MoveList& t_moves) const {
+    t_moves.clear();
+    Bitboard blockableSquares;
+    const std::vector<Piece*>& pieces = m_pieces[t_player - 1];
+    const Piece* myKing = pieces[12];
 
     // Determine if king is in check
     const std::vector<MoveVector*>& attackingKingVectors = myKing->getPassiveAttackingVectors();
     bool kingInCheck = attackingKingVectors.size() != 0;
 
     if (kingInCheck) {
-        blockableSquares = MoveVectorUtils::getCommonPositions(attackingKingVectors);
+        blockableSquares = MoveVectorUtils::getCommonSquares(attackingKingVectors);
     }
 
-    std::vector<Piece*> pieces = this->getPiecesForPlayer(t_player);
     for (auto const& piece : pieces) {
         if (!piece->getPosition()->isOffBoard()) {
-            // Get the legal moves for this piece
-            const std::vector<Move>& movesForPiece = getLegalMovesForPiece(piece, kingInCheck, blockableSquares);
-
-            // Append those moves to our total legal moves vector
-            legalMoves.insert(std::end(legalMoves), std::begin(movesForPiece), std::end(movesForPiece));
+            // Append the legal moves for this piece straight onto our total legal moves
+            this->getLegalMovesForPiece(piece, kingInCheck, blockableSquares, t_moves);
         }
     }
 
     // If we don't actually have any legal moves (i.e. we're in checkmate or stalemate), we can perform the null move
-    if (legalMoves.size() == 0) {
+    if (t_moves.empty()) {
         Move nullMove;
-        legalMoves.push_back(nullMove);
+        t_moves.push_back(nullMove);
     }
+}
 
-    return legalMoves;
+// Like getLegalMoves, but gives up as soon as one piece turns out to have a move
+bool Board::hasAnyLegalMove(const short t_player) const {
+    Bitboard blockableSquares;
+    const std::vector<Piece*>& pieces = m_pieces[t_player - 1];
+    const std::vector<MoveVector*>& attackingKingVectors = pieces[12]->getPassiveAttackingVectors();
+    const bool kingInCheck = attackingKingVectors.size() != 0;
 
+    if (kingInCheck) {
+        blockableSquares = MoveVectorUtils::getCommonSquares(attackingKingVectors);
+    }
+
+    MoveList moves;
+    for (auto const& piece : pieces) {
+        if (!piece->getPosition()->isOffBoard()) {
+            this->getLegalMovesForPiece(piece, kingInCheck, blockableSquares, moves);
+            if (!moves.empty()) {
+                return true;
+            }
+        }
+    }
+
+    return false;
 }
 
-std::vector<Move> Board::getLegalMovesForPiece(const Piece* t_piece, bool t_kingInCheck, const std::vector<Position*>& t_blockableSquares) const {
+void Board::getLegalMovesForPiece(const Piece* t_piece, bool t_kingInCheck, const Bitboard& t_blockableSquares, MoveList& t_moves) const {
     const Position* piecePosition = t_piece->getPosition();
     const PieceType pieceType = t_piece->getType();
 
     // Work out where we can move to
-    std::vector<Move> legalMoves;
-    const std::vector<Position*>& accessibleSquares = this->getAccessibleSquares(t_piece);
-    const std::vector<Position*>& attackingLineOnKingThroughThisPiece = this->getAttackingLineOnKingThroughPosition(piecePosition, t_piece->getOwner());
-    std::vector<Position*> legalDestinations;
-    if (accessibleSquares.size() > 0) {
-        if (t_kingInCheck && pieceType != PieceType::KING) {
-            legalDestinations = MoveVectorUtils::getCommonPositions(accessibleSquares, t_blockableSquares);
-        } else {
-            legalDestinations = accessibleSquares;
-        }
-
+    PositionList accessibleSquares;
+    this->getAccessibleSquares(t_piece, accessibleSquares);
+    PositionList attackingLineOnKingThroughThisPiece;
+    this->getAttackingLineOnKingThroughPosition(piecePosition, t_piece->getOwner(), attackingLineOnKingThroughThisPiece);
+    PositionList legalDestinations;
+    if (!accessibleSquares.empty()) {
+        const bool mustBlock = t_kingInCheck && pieceType != PieceType::KING;
         // If moving this piece opens up a new attack vector, we have to only move along that vector (thereby blocking the attack)
-        if (attackingLineOnKingThroughThisPiece.size() > 0) {
-            legalDestinations = MoveVectorUtils::getCommonPositions(attackingLineOnKingThroughThisPiece, legalDestinations);
+        // Keeps the order of the line, as MoveVectorUtils::getCommonPositions did
+        if (!attackingLineOnKingThroughThisPiece.empty()) {
+            for (auto const& pos : attackingLineOnKingThroughThisPiece) {
+                if (accessibleSquares.contains(pos) && (!mustBlock || t_blockableSquares.test(pos->getBoardIndex()))) {
+                    legalDestinations.push_back(pos);
+                }
+            }
+        } else {
+            for (auto const& pos : accessibleSquares) {
+                if (!mustBlock || t_blockableSquares.test(pos->getBoardIndex())) {
+                    legalDestinations.push_back(pos);
+                }
+            }
         }
     }
 
@@ -475,32 +604,122 @@ std::vector<Move> Board::getLegalMovesForPiece(const Piece* t_piece, bool t_king
                 // m_from(nullptr), m_to(nullptr), m_pieceTaken(nullptr), m_replacePiece(nullptr), m_isNull(true)
                 for (const auto& piece : this->getPawnReplaceOptionsForPlayer(t_piece->getOwner())) {
                     Move m (piecePosition, dest, destinationPiece, piece);
-                    legalMoves.push_back(m);
+                    t_moves.push_back(m);
                 }
             }
             // Not surrounding this in "else" since it's legal to move pawn to vortex and not upgrade it
             if (t_piece->getType() != PieceType::KING) {
                 Move m (piecePosition, dest, destinationPiece);
-                legalMoves.push_back(m);
+                t_moves.push_back(m);
             } else {
                 // If the piece is a king, make sure it's not moving into the path of an attack
-                const std::vector<std::deque<Position*>>& attacksThroughPos = this->getLinesAttackingSquare(dest);
-                bool anyoneAttacking = false;
-                for (auto const& positionDeque : attacksThroughPos) {
-                    const Piece* attackingPiece = this->getPieceAtPosition(positionDeque[0]);
-                    anyoneAttacking = anyoneAttacking || !TeamUtils::isSameTeam(t_piece->getOwner(), attackingPiece->getOwner());
-                }
-                if (!anyoneAttacking) {
+                if (this->isKingDestinationSafe(t_piece, dest)) {
                     Move m (piecePosition, dest, destinationPiece);
-                    legalMoves.push_back(m);
+                    t_moves.push_back(m);
                 }
             }
 
         }
 
     }
+}
 
-    return legalMoves;
+bool Board::isKingDestinationSafe(const Piece* t_king, const Position* t_destination) const {
+    const Bitboard& enemies = m_teamOccupancy[1 - (t_king->getOwner() % 2)];
+    return (this->getPiecesTouchingSquare(t_destination) & enemies).isEmpty();
+}
+
+// Captures are read off the attacking vectors we already keep (plus wizard teleports, which aren't in them), so
+// unlike getLegalMovesForPiece this never has to work out every square a piece can reach
+void Board::getTacticalMoves(const short t_player, MoveList& t_moves) const {
+    t_moves.clear();
+
+    if (this->isPlayerInCheck(t_player)) {
+        this->getLegalMoves(t_player, t_moves);
+        if (t_moves.size() == 1 && t_moves[0].isNull()) {
+            t_moves.clear();
+        }
+        return;
+    }
+
+    const Bitboard& enemies = m_teamOccupancy[1 - (t_player % 2)];
+    const Bitboard& kings = this->getPieceTypeOccupancy(PieceType::KING);
+
+    for (auto const& piece : m_pieces[t_player - 1]) {
+        Position* piecePosition = piece->getPosition();
+        if (piecePosition->isOffBoard()) {
+            continue;
+        }
+        const PieceType pieceType = piece->getType();
+
+        Bitboard captures;
+        for (auto const& moveVector : piece->getActiveAttackingVectors()) {
+            captures.set(moveVector->getPassivePiece()->getPosition()->getBoardIndex());
+        }
+        if (this->isPieceWizardAdjacent(piece)) {
+            PositionList teleportableSquares;
+            this->getTeleportableSquares(piece, teleportableSquares);
+            for (auto const& pos : teleportableSquares) {
+                if (enemies.test(pos->getBoardIndex())) {
+                    captures.set(pos->getBoardIndex());
+                }
+            }
+        }
+        // Kings are never taken
+        captures &= ~kings;
+
+        // A pawn next to an empty vortex can step into it and be replaced
+        Position* emptyVortex = nullptr;
+        if (pieceType == PieceType::PAWN) {
+            for (auto const& adjacentSquareIndex : PositionUtils::getAdjacentSquareIndices(piecePosition)) {
+                Position* pos = this->getPosition(adjacentSquareIndex);
+                if (pos->isVortex() && !m_occupancy.test(adjacentSquareIndex)) {
+                    emptyVortex = pos;
+                }
+            }
+        }
+
+        if (captures.isEmpty() && emptyVortex == nullptr) {
+            continue;
+        }
+
+        // If moving this piece would open up an attack on our king, it can only move along the line of that attack
+        PositionList attackingLineOnKingThroughThisPiece;
+        this->getAttackingLineOnKingThroughPosition(piecePosition, t_player, attackingLineOnKingThroughThisPiece);
+        if (!attackingLineOnKingThroughThisPiece.empty()) {
+            Bitboard line;
+            for (auto const& pos : attackingLineOnKingThroughThisPiece) {
+                line.set(pos->getBoardIndex());
+            }
+            captures &= line;
+            if (emptyVortex != nullptr && !line.test(emptyVortex->getBoardIndex())) {
+                emptyVortex = nullptr;
+            }
+        }
+
+        while (!captures.isEmpty()) {
+            Position* dest = this->getPosition(captures.popLowest());
+            Piece* destinationPiece = this->getPieceAtPosition(dest);
+            if (pieceType == PieceType::KING && !this->isKingDestinationSafe(piece, dest)) {
+                continue;
+            }
+            if (dest->isVortex() && pieceType == PieceType::PAWN) {
+                for (const auto& replacePiece : this->getPawnReplaceOptionsForPlayer(t_player)) {
+                    Move m (piecePosition, dest, destinationPiece, replacePiece);
+                    t_moves.push_back(m);
+                }
+            }
+            Move m (piecePosition, dest, destinationPiece);
+            t_moves.push_back(m);
+        }
+
+        if (emptyVortex != nullptr) {
+            for (const auto& replacePiece : this->getPawnReplaceOptionsForPlayer(t_player)) {
+                Move m (piecePosition, emptyVortex, nullptr, replacePiece);
+                t_moves.push_back(m);
+            }
+        }
+    }
 }
 
 // When using this in apply move, be sure to update position of taken piece first
@@ -515,8 +734,12 @@ void Board::setPiecePosition(Piece* t_piece, const BoardIndex t_positionIndex) {
     // Set piece's old position to now hold nothing
     const BoardIndex oldPositionIndex = t_piece->getPosition()->getBoardIndex();
     this->m_squares[oldPositionIndex] = nullptr;
+    if (oldPositionIndex != 0) {
+        this->removePieceFromOccupancy(t_piece, oldPositionIndex);
+    }
     if (t_positionIndex != 0) {
         this->m_squares[t_positionIndex] = t_piece;
+        this->addPieceToOccupancy(t_piece, t_positionIndex);
     }
 
     // Set the position on the piece itself
@@ -530,17 +753,67 @@ void Board::setPiecePosition(Piece* t_piece, const Position* t_position) {
     this->setPiecePosition(t_piece, positionIndex);
 }
 
+void Board::addPieceToOccupancy(const Piece* t_piece, const BoardIndex t_positionIndex) {
+    assert(t_positionIndex != 0);
+    const short owner = t_piece->getOwner();
+    m_occupancy.set(t_positionIndex);
+    m_playerOccupancy[owner - 1].set(t_positionIndex);
+    m_teamOccupancy[owner % 2].set(t_positionIndex);
+    m_pieceTypeOccupancy[static_cast<int>(t_piece->getType())].set(t_positionIndex);
+    m_hash ^= ZobristUtils::getPieceKey(owner, t_piece->getType(), t_positionIndex);
+}
+
+void Board::removePieceFromOccupancy(const Piece* t_piece, const BoardIndex t_positionIndex) {
+    assert(t_positionIndex != 0);
+    const short owner = t_piece->getOwner();
+    m_occupancy.clear(t_positionIndex);
+    m_playerOccupancy[owner - 1].clear(t_positionIndex);
+    m_teamOccupancy[owner % 2].clear(t_positionIndex);
+    m_pieceTypeOccupancy[static_cast<int>(t_piece->getType())].clear(t_positionIndex);
+    m_hash ^= ZobristUtils::getPieceKey(owner, t_piece->getType(), t_positionIndex);
+}
+
+void Board::setSideToMove(const short t_player) {
+    m_hash ^= ZobristUtils::getSideToMoveKey(m_sideToMove);
+    m_sideToMove = t_player;
+    m_hash ^= ZobristUtils::getSideToMoveKey(m_sideToMove);
+}
+
+// Every apply (including null moves) passes the turn on to the next player, and every undo passes it back
+void Board::advanceSideToMove() {
+    this->setSideToMove(m_sideToMove == 6 ? 1 : m_sideToMove + 1);
+}
+
+void Board::retreatSideToMove() {
+    this->setSideToMove(m_sideToMove == 1 ? 6 : m_sideToMove - 1);
+}
+
+ZobristKey Board::computeHashFromScratch() const {
+    ZobristKey hash = ZobristUtils::getSideToMoveKey(m_sideToMove);
+    BoardIndex i;
+    for (i = 1; i <= 157; ++i) {
+        const Piece* piece = m_squares[i];
+        if (piece != nullptr) {
+            hash ^= ZobristUtils::getPieceKey(piece->getOwner(), piece->getType(), i);
+        }
+    }
+    return hash;
+}
+
 void Board::initialiseAttDefVectors() {
     // Go through each piece, find what it's actively doing (attacking or defending)
     // Add these vectors to both pieces
     short playerNum;
 
     // Clear all vectors for all pieces
+    // Every vector is between two of our pieces, so rather than deregistering them one at a time
+    // we drop all the references and then free the whole pool in one go
     for (playerNum = 1; playerNum <= 6; ++playerNum) {
-        for (auto& piece : this->getPiecesForPlayer(playerNum)) {
-            piece->clearActiveMoveVectors();
+        for (auto& piece : m_pieces[playerNum - 1]) {
+            piece->forgetAllMoveVectors();
         }
     }
+    m_moveVectorPool.reset();
 
     for (playerNum = 1; playerNum <= 6; ++playerNum) {
         for (auto& piece : this->getPiecesForPlayer(playerNum)) {
@@ -549,7 +822,7 @@ void Board::initialiseAttDefVectors() {
     }
 
     // Finally, update the checkmate records
-    this->updateCheckmateRecords();
+    this->invalidateCheckmateRecords();
 };
 
 void Board::initialiseActiveVectorsForPiece(Piece* t_piece) {
@@ -561,7 +834,7 @@ void Board::initialiseActiveVectorsForPiece(Piece* t_piece) {
         if (pieceType == PieceType::PAWN) {
             // PAWN
             // Taking on diagonals
-            const std::vector<BoardIndex>& diagonalSquares = PositionUtils::getDiagonalSquareIndices(piecePosition);
+            const BoardIndexList diagonalSquares = PositionUtils::getDiagonalSquareIndices(piecePosition);
             for (auto const &diagonalSquareIndex: diagonalSquares) {
                 Position *pos = this->getPosition(diagonalSquareIndex);
                 if (this->doesSquareContainPiece(pos)) {
@@ -571,7 +844,7 @@ void Board::initialiseActiveVectorsForPiece(Piece* t_piece) {
 
         } else if (pieceType == PieceType::KING || pieceType == PieceType::WIZARD) {
             // Kings and Wizards can move (and take) unit bishop or unit rook
-            const std::vector<BoardIndex>& allAdjacent = PositionUtils::getAdjacentAndDiagonalSquareIndices(piecePosition);
+            const BoardIndexList allAdjacent = PositionUtils::getAdjacentAndDiagonalSquareIndices(piecePosition);
             for (auto const &adjacentSquareIndex : allAdjacent) {
                 Position *pos = this->getPosition(adjacentSquareIndex);
                 if (this->doesSquareContainPiece(pos)) {
@@ -582,7 +855,7 @@ void Board::initialiseActiveVectorsForPiece(Piece* t_piece) {
 
         if (pieceType == PieceType::KNIGHT || pieceType == PieceType::DUCHESS || pieceType == PieceType::FORTRESS) {
             // Each of these pieces can take on knight-moves
-            const std::vector<BoardIndex>& knightAdjacent = PositionUtils::getKnightMovesFromPosition(piecePosition);
+            const BoardIndexList knightAdjacent = PositionUtils::getKnightMovesFromPosition(piecePosition);
             for (auto const &knightAdjacentIndex : knightAdjacent) {
                 Position *pos = this->getPosition(knightAdjacentIndex);
                 if (this->doesSquareContainPiece(pos)) {
@@ -632,7 +905,7 @@ void Board::initialiseActiveVectorsForPiece(Piece* t_piece) {
 
         for (auto const &attDefVector : activelyTouching) {
             Piece *passivePiece = this->getPieceAtPosition(attDefVector.back());
-            MoveVector *mv = new MoveVector(t_piece, passivePiece, attDefVector);
+            MoveVector* mv = m_moveVectorPool.create(t_piece, passivePiece, attDefVector);
             mv->registerSelf();
         }
     }
@@ -645,41 +918,26 @@ std::vector<std::vector<Position*>> Board::getActiveLinesFromVortex(const Piece*
     Position* piecePosition = t_piece->getPosition();
 
     // Work out the directions we need to check for this piece
+    // Diagonal lines (OUT_ANTICLOCKWISE) are vortex rays 6 - 11, adjacent lines (OUT) are vortex rays 0 - 5
     const std::vector<short> directionsToCheck {PositionUtils::DIRECTION_OUT_ANTICLOCKWISE, PositionUtils::DIRECTION_OUT};
 
     // For each direction this piece can go in...
     for (auto const& direction : directionsToCheck) {
         if (PositionUtils::canPieceMoveInDirection(t_piece->getType(), direction)) {
-            std::vector<BoardIndex> surroundingSquareIndices;
-            if (direction == PositionUtils::DIRECTION_OUT) {
-                surroundingSquareIndices = PositionUtils::getAdjacentSquareIndices(piecePosition);
-            } else {
-                surroundingSquareIndices = PositionUtils::getDiagonalSquareIndices(piecePosition);
-            }
-
-            // For the relevant surrounding squares (diagonal or adjacent), keep branching out until we go off board
-            // or until we hit a piece
-            for (auto const &squareIndex : surroundingSquareIndices) {
-                bool success = false;
-                short tempDirection = direction;
-                Position *prev = piecePosition;
-                Position *cur = this->getPosition(squareIndex);
-                std::vector < Position * > line {prev, cur};
-
-                while (!success && !cur->isOffBoard()) {
-                    success = this->getPieceAtPosition(cur) != nullptr;
-
-                    if (!success) {
-                        prev = cur;
-                        cur = this->getPosition(PositionUtils::getIndexOfPositionInDirection(cur, tempDirection));
-                        line.push_back(cur);
+            const short firstRay = direction == PositionUtils::DIRECTION_OUT ? 0 : PositionUtils::NUM_VORTEX_ADJACENT_RAYS;
+
+            // For the relevant lines out of the vortex, keep branching out until we go off board or until we hit a piece
+            short ray;
+            for (ray = firstRay; ray < firstRay + PositionUtils::NUM_VORTEX_ADJACENT_RAYS; ++ray) {
+                std::vector<Position*> line {piecePosition};
+                const BoardIndex* square;
+                for (square = PositionUtils::getVortexRay(ray); *square != 0; ++square) {
+                    line.push_back(this->getPosition(*square));
+                    if (m_occupancy.test(*square)) {
+                        attackingLines.push_back(line);
+                        break;
                     }
                 }
-
-                if (success) {
-                    attackingLines.push_back(line);
-                }
-
             }
         }
     }
@@ -693,18 +951,12 @@ void Board::initialisePassiveVectorsForPiece(Piece *t_piece) {
 
     // Use the vectors in beingTouched to create MoveVectors
     for (auto const& attDefQueue : beingTouched) {
-        // Convert the queue attDefQueue to a vector attDefVector
-        std::vector<Position*> attDefVector;
-        attDefVector.reserve(attDefQueue.size());
-        auto qit = attDefQueue.begin();
-        attDefVector.insert(attDefVector.begin(), qit, qit + attDefQueue.size());
-
         // For each active piece now, clear all of its existing move vectors that pass through this position
-        Piece* activePiece = this->getPieceAtPosition(attDefVector.front());
+        Piece* activePiece = this->getPieceAtPosition(attDefQueue.front());
         activePiece->clearActiveMoveVectorsThatPassThroughPosition(t_piece->getPosition());
 
         // Construct and register the new move vector
-        MoveVector* mv = new MoveVector(activePiece, t_piece, attDefVector);
+        MoveVector* mv = m_moveVectorPool.create(activePiece, t_piece, attDefQueue);
         mv->registerSelf();
     }
 
@@ -713,152 +965,166 @@ void Board::initialisePassiveVectorsForPiece(Piece *t_piece) {
 std::vector<std::deque<Position*>> Board::getLinesAttackingSquare(Position* t_position) const {
     std::vector <std::deque<Position *>> beingTouched;
     if (!t_position->isOffBoard()) {
-        const std::vector<BoardIndex>& knightMovesFromPos = PositionUtils::getKnightMovesFromPosition(t_position);
+        // Masks of the pieces that can touch this square with a single step of each kind
+        const Bitboard kingsAndWizards = this->getPieceTypeOccupancy(PieceType::KING) |
+                                         this->getPieceTypeOccupancy(PieceType::WIZARD);
+        const Bitboard knightMovers = this->getPieceTypeOccupancy(PieceType::KNIGHT) |
+                                      this->getPieceTypeOccupancy(PieceType::DUCHESS) |
+                                      this->getPieceTypeOccupancy(PieceType::FORTRESS);
+        const Bitboard diagonalSteppers = kingsAndWizards | this->getPieceTypeOccupancy(PieceType::PAWN);
+
+        const BoardIndexList knightMovesFromPos = PositionUtils::getKnightMovesFromPosition(t_position);
         for (auto const &posIndex : knightMovesFromPos) {
-            const Piece *piece = this->getPieceAtPosition(posIndex);
-            if (piece != nullptr) {
-                const PieceType type = piece->getType();
-                if (type == PieceType::KNIGHT || type == PieceType::DUCHESS || type == PieceType::FORTRESS) {
-                    std::deque<Position *> vec {this->getPosition(posIndex), t_position};
-                    beingTouched.push_back(vec);
-                }
+            if (knightMovers.test(posIndex)) {
+                std::deque<Position *> vec {this->getPosition(posIndex), t_position};
+                beingTouched.push_back(vec);
             }
         }
 
         // Check for pawns/kings/wizards taking diagonally
-        const std::vector<BoardIndex>& diagonalFromPos = PositionUtils::getDiagonalSquareIndices(t_position);
+        const BoardIndexList diagonalFromPos = PositionUtils::getDiagonalSquareIndices(t_position);
         for (auto const &posIndex : diagonalFromPos) {
-            const Piece *piece = this->getPieceAtPosition(posIndex);
-            if (piece != nullptr) {
-                const PieceType type = piece->getType();
-                if (type == PieceType::PAWN || type == PieceType::KING || type == PieceType::WIZARD) {
-                    std::deque<Position*> vec {this->getPosition(posIndex), t_position};
-                    beingTouched.push_back(vec);
-                }
-
+            if (diagonalSteppers.test(posIndex)) {
+                std::deque<Position*> vec {this->getPosition(posIndex), t_position};
+                beingTouched.push_back(vec);
             }
         }
 
         // Check for kings/wizards taking horizontally/vertically
-        const std::vector<BoardIndex>& adjacentToPos = PositionUtils::getAdjacentSquareIndices(t_position);
+        const BoardIndexList adjacentToPos = PositionUtils::getAdjacentSquareIndices(t_position);
         for (auto const &posIndex : adjacentToPos) {
-            const Piece *piece = this->getPieceAtPosition(posIndex);
-            if (piece != nullptr) {
-                const PieceType type = piece->getType();
-                if (type == PieceType::KING || type == PieceType::WIZARD) {
-                    std::deque < Position * > vec {this->getPosition(posIndex), t_position};
-                    beingTouched.push_back(vec);
-                }
+            if (kingsAndWizards.test(posIndex)) {
+                std::deque < Position * > vec {this->getPosition(posIndex), t_position};
+                beingTouched.push_back(vec);
             }
         }
 
         // Check for rook-style and bishop style attacks to here
         if (t_position->isVortex()) {
-            // For each square diagonal of the vortex, go in a line OUT_ANTICLOCKWISE
-            // For each square adjacent to the vortex, go in a line OUT
-            const std::vector<short> directions {PositionUtils::DIRECTION_OUT_ANTICLOCKWISE, PositionUtils::DIRECTION_OUT};
-            const std::vector<std::vector<BoardIndex>> adjacentSquares {diagonalFromPos, adjacentToPos};
-            short i;
-            for (i = 0; i < 2; ++i) {
-                const std::vector<BoardIndex>& surroundingPositions = adjacentSquares[i];
-                const short direction = directions[i];
-
-                for (auto const& posIndex : surroundingPositions) {
-                    short tempDirection = direction;
-                    Position* pos = this->getPosition(posIndex);
-                    Position* prev = t_position;
-                    std::deque<Position*> line {prev};
-                    Position* cur = pos;
-                    bool success = false;
-                    bool passComplete = false;
-                    while (!passComplete && !cur->isOffBoard()) {
-                        line.push_front(cur);
-                        Piece* pieceHere = this->getPieceAtPosition(cur);
-                        passComplete = pieceHere != nullptr;
-                        if (passComplete) {
-                            success = PositionUtils::canPieceMoveInDirection(pieceHere->getType(), direction);
-                        } else {
-                            const BoardIndex nextInLineIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur, tempDirection);
-                            const short flapChange = PositionUtils::getFlapChange(prev, cur);
-                            tempDirection = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(tempDirection,
-                                                                                                                     flapChange);
-                            prev = cur;
-                            cur = this->getPosition(nextInLineIndex);
+            // Check the lines out of the vortex through each diagonal square (OUT_ANTICLOCKWISE) and then through each
+            // adjacent square (OUT)
+            const short directions[] {PositionUtils::DIRECTION_OUT_ANTICLOCKWISE, PositionUtils::DIRECTION_OUT};
+            for (auto const& direction : directions) {
+                const short firstRay = direction == PositionUtils::DIRECTION_OUT ? 0 : PositionUtils::NUM_VORTEX_ADJACENT_RAYS;
+                short ray;
+                for (ray = firstRay; ray < firstRay + PositionUtils::NUM_VORTEX_ADJACENT_RAYS; ++ray) {
+                    std::deque<Position*> line {t_position};
+                    const BoardIndex* square;
+                    for (square = PositionUtils::getVortexRay(ray); *square != 0; ++square) {
+                        line.push_front(this->getPosition(*square));
+                        if (m_occupancy.test(*square)) {
+                            if (PositionUtils::canPieceMoveInDirection(this->getPieceAtPosition(*square)->getType(), direction)) {
+                                beingTouched.push_back(line);
+                            }
+                            break;
                         }
-
-                    }
-
-                    if (success) {
-                        beingTouched.push_back(line);
                     }
                 }
             }
 
-
         } else {
+            // Note that the type of a line (rook-style or bishop-style) never changes as it goes round the board, so the
+            // starting direction tells us which pieces can travel along it
+            const BoardIndex positionIndex = t_position->getBoardIndex();
             short direction;
             for (direction = PositionUtils::DIRECTION_CLOCKWISE;
                  direction <= PositionUtils::DIRECTION_OUT_ANTICLOCKWISE; ++direction) {
                 std::deque < Position * > positionsInLine {t_position};
-                short tempDirection = direction;
-                Position *prev = t_position;
-                Position *cur = this->getPosition(PositionUtils::getIndexOfPositionInDirection(t_position, direction));
-                // Do we know there's no point in continuing?
-                bool passComplete = false;
-
-                while (!cur->isOffBoard() && !passComplete) {
-                    positionsInLine.push_front(cur);
-                    const Piece *pieceHere = this->getPieceAtPosition(cur);
-                    if (pieceHere != nullptr) {
-                        passComplete = true;
-                        if (PositionUtils::canPieceMoveInDirection(pieceHere->getType(), tempDirection)) {
+                const BoardIndex* square;
+                for (square = PositionUtils::getRay(positionIndex, direction); *square != 0; ++square) {
+                    positionsInLine.push_front(this->getPosition(*square));
+                    if (m_occupancy.test(*square)) {
+                        if (PositionUtils::canPieceMoveInDirection(this->getPieceAtPosition(*square)->getType(), direction)) {
                             beingTouched.push_back(positionsInLine);
                         }
+                        break;
                     }
+                }
+            }
+        }
 
+    }
+    return beingTouched;
+}
 
-                    const BoardIndex nextInLineIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur, tempDirection);
-                    const short flapChange = PositionUtils::getFlapChange(prev, cur);
-                    tempDirection = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(tempDirection,
-                                                                                                             flapChange);
-                    prev = cur;
-                    cur = this->getPosition(nextInLineIndex);
+Bitboard Board::getPiecesTouchingSquare(const Position* t_position) const {
+    Bitboard touching;
+    if (t_position->isOffBoard()) {
+        return touching;
+    }
 
+    // The same steps and lines as getLinesAttackingSquare, keeping only the piece each one starts from
+    const Bitboard kingsAndWizards = this->getPieceTypeOccupancy(PieceType::KING) |
+                                     this->getPieceTypeOccupancy(PieceType::WIZARD);
+    const Bitboard knightMovers = this->getPieceTypeOccupancy(PieceType::KNIGHT) |
+                                  this->getPieceTypeOccupancy(PieceType::DUCHESS) |
+                                  this->getPieceTypeOccupancy(PieceType::FORTRESS);
+    const Bitboard diagonalSteppers = kingsAndWizards | this->getPieceTypeOccupancy(PieceType::PAWN);
+
+    for (auto const& posIndex : PositionUtils::getKnightMovesFromPosition(t_position)) {
+        if (knightMovers.test(posIndex)) {
+            touching.set(posIndex);
+        }
+    }
+    for (auto const& posIndex : PositionUtils::getDiagonalSquareIndices(t_position)) {
+        if (diagonalSteppers.test(posIndex)) {
+            touching.set(posIndex);
+        }
+    }
+    for (auto const& posIndex : PositionUtils::getAdjacentSquareIndices(t_position)) {
+        if (kingsAndWizards.test(posIndex)) {
+            touching.set(posIndex);
+        }
+    }
+
+    if (t_position->isVortex()) {
+        short ray;
+        for (ray = 0; ray < PositionUtils::NUM_VORTEX_RAYS; ++ray) {
+            const short direction = ray < PositionUtils::NUM_VORTEX_ADJACENT_RAYS ? PositionUtils::DIRECTION_OUT : PositionUtils::DIRECTION_OUT_ANTICLOCKWISE;
+            const BoardIndex* square;
+            for (square = PositionUtils::getVortexRay(ray); *square != 0; ++square) {
+                if (m_occupancy.test(*square)) {
+                    if (PositionUtils::canPieceMoveInDirection(this->getPieceAtPosition(*square)->getType(), direction)) {
+                        touching.set(*square);
+                    }
+                    break;
+                }
+            }
+        }
+    } else {
+        short direction;
+        for (direction = PositionUtils::DIRECTION_CLOCKWISE; direction <= PositionUtils::DIRECTION_OUT_ANTICLOCKWISE; ++direction) {
+            const BoardIndex* square;
+            for (square = PositionUtils::getRay(t_position->getBoardIndex(), direction); *square != 0; ++square) {
+                if (m_occupancy.test(*square)) {
+                    if (PositionUtils::canPieceMoveInDirection(this->getPieceAtPosition(*square)->getType(), direction)) {
+                        touching.set(*square);
+                    }
+                    break;
                 }
             }
         }
-
     }
-    return beingTouched;
+
+    return touching;
 }
 
 std::vector<Position*> Board::getAttackingOrDefendingVectorAlongLine(const Piece* t_piece, const short t_direction) const {
-
-    short direction = t_direction;
     Position* startPosition = t_piece->getPosition();
-    Position* prev = startPosition;
-    const BoardIndex posIndex = PositionUtils::getIndexOfPositionInDirection(startPosition, t_direction);
-    Position* curr = this->getPosition(posIndex);
-    std::vector<Position*> positions {startPosition, curr};
-    while (!curr->isOffBoard() && !this->doesSquareContainPiece(curr)) {
-        // Keep extending along line adding positions
-        // Finish one short of an ally, or on top of an enemy, or when off board
-        // NB: This used to use nextPositionInDirection but ran into a bug crossing over the vortex
-        // Further investigation may be required to ensure it's getting lines along vortex properly
-        const BoardIndex nextCurrIndex = PositionUtils::getIndexOfNextSquareInLine(prev, curr, direction);
-        const short flapChange = PositionUtils::getFlapChange(prev, curr);
-        direction = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(direction, flapChange);
-        prev = curr;
-        curr = this->getPosition(nextCurrIndex);
-        positions.push_back(curr);
+    std::vector<Position*> positions {startPosition};
+
+    // Extend along the line until we land on a piece
+    const BoardIndex* square;
+    for (square = PositionUtils::getRay(startPosition->getBoardIndex(), t_direction); *square != 0; ++square) {
+        positions.push_back(this->getPosition(*square));
+        if (m_occupancy.test(*square)) {
+            return positions;
+        }
     }
 
     // If the vector ended because we ran off the board there's obviously nothing along this line
     // Therefore, send back an empty array
-    if (curr->isOffBoard()) {
-        positions.clear();
-    }
-
+    positions.clear();
     return positions;
 }
 
@@ -890,60 +1156,53 @@ std::vector<Piece*> Board::getPawnReplaceOptionsForPlayer(const short t_player)
 
 // If a piece moves, will it open a new
 std::vector<Position*> Board::getAttackingLineOnKingThroughPosition(const Position* t_throughPosition, const short t_owner) const {
+    PositionList positionsInLine;
+    this->getAttackingLineOnKingThroughPosition(t_throughPosition, t_owner, positionsInLine);
+    return positionsInLine.toVector();
+}
+
+void Board::getAttackingLineOnKingThroughPosition(const Position* t_throughPosition, const short t_owner, PositionList& t_line) const {
+    t_line.clear();
     Position* kingPosition = this->getPiecesForPlayer(t_owner)[12]->getPosition();
-    std::vector<Position*> positionsInLine;
+    const BoardIndex throughIndex = t_throughPosition->getBoardIndex();
 
     if (kingPosition->isVortex()) {
-        const std::vector<short> directions {PositionUtils::DIRECTION_OUT_ANTICLOCKWISE, PositionUtils::DIRECTION_OUT};
-        const std::vector<std::vector<BoardIndex>> adjacentSquares {PositionUtils::getDiagonalSquareIndices(kingPosition),
-                                                                  PositionUtils::getAdjacentSquareIndices(kingPosition)};
-        short i;
-        bool success = false;
-        for (i = 0; i < 2 && !success; ++i) {
-            const std::vector<BoardIndex>& surroundingPositions = adjacentSquares[i];
-            const short& direction = directions[i];
-
-            for (auto const& posIndex : surroundingPositions) {
-                short tempDirection = direction;
-                Position* pos = this->getPosition(posIndex);
-                Position* prev = kingPosition;
-                positionsInLine.push_back(prev);
-                Position* cur = pos;
-                bool passComplete = false;
+        // Check the lines out of the vortex through each diagonal square and then through each adjacent square
+        const short directions[] {PositionUtils::DIRECTION_OUT_ANTICLOCKWISE, PositionUtils::DIRECTION_OUT};
+        for (auto const& direction : directions) {
+            const short firstRay = direction == PositionUtils::DIRECTION_OUT ? 0 : PositionUtils::NUM_VORTEX_ADJACENT_RAYS;
+            short ray;
+            for (ray = firstRay; ray < firstRay + PositionUtils::NUM_VORTEX_ADJACENT_RAYS; ++ray) {
+                t_line.push_back(kingPosition);
+                bool success = false;
                 bool throughPos = false;
-                while (!passComplete && !cur->isOffBoard()) {
-                    bool curIsThroughPos = *cur == *t_throughPosition;
+                const BoardIndex* square;
+                for (square = PositionUtils::getVortexRay(ray); *square != 0; ++square) {
+                    const bool curIsThroughPos = *square == throughIndex;
                     throughPos = throughPos || curIsThroughPos;
-                    positionsInLine.push_back(cur);
-                    const Piece* pieceHere = this->getPieceAtPosition(cur);
-                    passComplete = !curIsThroughPos && pieceHere != nullptr;
-                    if (passComplete) {
-                        success = throughPos;
-                    } else {
-                        const BoardIndex nextInLineIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur, tempDirection);
-                        const short flapChange = PositionUtils::getFlapChange(prev, cur);
-                        tempDirection = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(tempDirection,
-                                                                                                                 flapChange);
-                        prev = cur;
-                        cur = this->getPosition(nextInLineIndex);
+                    t_line.push_back(this->getPosition(*square));
+                    if (!curIsThroughPos && m_occupancy.test(*square)) {
+                        // Only an enemy that can travel along this line opens up an attack
+                        if (throughPos) {
+                            const Piece* pieceHere = this->getPieceAtPosition(*square);
+                            success = !TeamUtils::isSameTeam(pieceHere->getOwner(), t_owner) &&
+                                      PositionUtils::canPieceMoveInDirection(pieceHere->getType(), direction);
+                        }
+                        break;
                     }
-
-
                 }
 
-                if (!success) {
-                    positionsInLine.clear();
-                } else {
-                    // We found a solution, break out of this for loop
-                    break;
+                if (success) {
+                    // We found a solution
+                    return;
                 }
+                t_line.clear();
             }
         }
 
     } else {
 
         short direction;
-        Position *prev = kingPosition;
         bool solutionFound = false;
         bool possibleSolutionsExhausted = false;
         // Loop through each direction
@@ -951,50 +1210,35 @@ std::vector<Position*> Board::getAttackingLineOnKingThroughPosition(const Positi
              direction <= PositionUtils::DIRECTION_OUT_ANTICLOCKWISE && !solutionFound && !possibleSolutionsExhausted;
              ++direction) {
 
-            short tempDirection = direction;
-            Position *cur = this->getPosition(PositionUtils::getIndexOfPositionInDirection(kingPosition, direction));
             // Have we passed through the target position?
             bool passedThroughPos = false;
-            // Do we know there's no point in continuing?
-            bool passComplete = false;
-            positionsInLine.push_back(kingPosition);
+            t_line.push_back(kingPosition);
             // If we pass through t_throughPosition in this direction (with no interference beforehand) and then hit an enemy piece
             // which can travel in that direction, we know that moving a piece away from t_throughPosition will open up a new attack
-            while (!cur->isOffBoard() && !solutionFound && !passComplete) {
-                positionsInLine.push_back(cur);
-                passedThroughPos = passedThroughPos || (*cur == *t_throughPosition);
-                if (!passedThroughPos) {
+            const BoardIndex* square;
+            for (square = PositionUtils::getRay(kingPosition->getBoardIndex(), direction); *square != 0; ++square) {
+                t_line.push_back(this->getPosition(*square));
+                passedThroughPos = passedThroughPos || *square == throughIndex;
+                if (m_occupancy.test(*square) && *square != throughIndex) {
                     // If there's a piece between the king and the target, we're done
-                    passComplete = (this->getPieceAtPosition(cur) != nullptr);
-                } else {
-                    const Piece *pieceHere = this->getPieceAtPosition(cur);
-                    if (pieceHere != nullptr) {
-                        passComplete = true;
-                        if (!TeamUtils::isSameTeam(pieceHere->getOwner(), t_owner)) {
-                            solutionFound = PositionUtils::canPieceMoveInDirection(pieceHere->getType(), tempDirection);
-                        }
+                    // Otherwise this is the first piece beyond the target, so see if it attacks along this line
+                    if (passedThroughPos) {
+                        const Piece* pieceHere = this->getPieceAtPosition(*square);
+                        solutionFound = !TeamUtils::isSameTeam(pieceHere->getOwner(), t_owner) &&
+                                        PositionUtils::canPieceMoveInDirection(pieceHere->getType(), direction);
                     }
+                    break;
                 }
-                const short flapChange = PositionUtils::getFlapChange(prev, cur);
-                tempDirection = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(tempDirection,
-                                                                                                         flapChange);
-                const BoardIndex nextInLineIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur,
-                                                                                                 tempDirection);
-                prev = cur;
-                cur = this->getPosition(nextInLineIndex);
-
             }
 
             if (!solutionFound) {
-                positionsInLine.clear();
+                t_line.clear();
             }
 
             possibleSolutionsExhausted = passedThroughPos;
 
         }
     }
-
-    return positionsInLine;
 }
 
 bool Board::isPlayerInCheck(const short t_player) const {
@@ -1002,6 +1246,77 @@ bool Board::isPlayerInCheck(const short t_player) const {
     return king->getPassiveAttackingVectors().size() > 0;
 }
 
+bool Board::doesQuietMoveGiveCheck(const Move& t_move) const {
+    if (t_move.isNull()) {
+        return false;
+    }
+    const Piece* mover = this->getPieceAtPosition(t_move.getFromPosition());
+    const PieceType moverType = mover->getType();
+    const BoardIndex fromIndex = t_move.getFromPosition()->getBoardIndex();
+    const BoardIndex toIndex = t_move.getToPosition()->getBoardIndex();
+    if (t_move.getFromPosition()->isVortex() || t_move.getToPosition()->isVortex()) {
+        return true;
+    }
+
+    // The players on the other team sit one, three and five seats round from the mover
+    short opponent;
+    for (opponent = mover->getOwner() % 2 == 0 ? 1 : 2; opponent <= 6; opponent += 2) {
+        const Position* kingPosition = this->getPiecesForPlayer(opponent)[12]->getPosition();
+        if (kingPosition->isOffBoard()) {
+            continue;
+        }
+        if (kingPosition->isVortex() || this->isPlayerInCheck(opponent)) {
+            return true;
+        }
+
+        // Nothing was attacking the king, so only the mover itself can step onto it...
+        if (moverType == PieceType::KNIGHT || moverType == PieceType::DUCHESS || moverType == PieceType::FORTRESS) {
+            for (auto const& square : PositionUtils::getKnightMovesFromPosition(kingPosition)) {
+                if (square == toIndex) {
+                    return true;
+                }
+            }
+        }
+        if (moverType == PieceType::PAWN || moverType == PieceType::KING || moverType == PieceType::WIZARD) {
+            for (auto const& square : PositionUtils::getDiagonalSquareIndices(kingPosition)) {
+                if (square == toIndex) {
+                    return true;
+                }
+            }
+        }
+        if (moverType == PieceType::KING || moverType == PieceType::WIZARD) {
+            for (auto const& square : PositionUtils::getAdjacentSquareIndices(kingPosition)) {
+                if (square == toIndex) {
+                    return true;
+                }
+            }
+        }
+
+        // ...and any line into the king is now either blocked by it, or opened up by it leaving t_move's from square
+        short direction;
+        for (direction = PositionUtils::DIRECTION_CLOCKWISE; direction <= PositionUtils::DIRECTION_OUT_ANTICLOCKWISE; ++direction) {
+            const BoardIndex* square;
+            for (square = PositionUtils::getRay(kingPosition->getBoardIndex(), direction); *square != 0; ++square) {
+                if (*square == toIndex) {
+                    if (PositionUtils::canPieceMoveInDirection(moverType, direction)) {
+                        return true;
+                    }
+                    break;
+                }
+                if (*square != fromIndex && m_occupancy.test(*square)) {
+                    const Piece* pieceHere = this->getPieceAtPosition(*square);
+                    if (!TeamUtils::isSameTeam(pieceHere->getOwner(), opponent) &&
+                        PositionUtils::canPieceMoveInDirection(pieceHere->getType(), direction)) {
+                        return true;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 void Board::applyMove(const Move *m, const EvaluationMode mode) {
     if (mode == EvaluationMode::CUMULATIVE) {
         this->applyMoveCumulative(m);
@@ -1046,7 +1361,9 @@ void Board::applyMoveDeNovo(const Move *m) {
 
     }
 
-    this->updateCheckmateRecords();
+    this->advanceSideToMove();
+    assert(m_hash == this->computeHashFromScratch());
+    this->invalidateCheckmateRecords();
 }
 
 void Board::applyMoveCumulative(const Move* m) {
@@ -1105,7 +1422,9 @@ void Board::applyMoveCumulative(const Move* m) {
 
     }
 
-    this->updateCheckmateRecords();
+    this->advanceSideToMove();
+    assert(m_hash == this->computeHashFromScratch());
+    this->invalidateCheckmateRecords();
 }
 
 // Check for rook-style and bishop style attacks by t_piece through t_position
@@ -1117,7 +1436,7 @@ void Board::initialiseActiveVectorsForPieceThroughPosition(Piece *t_piece, const
         for (auto const& attackingLine : attackingLinesFromVortex) {
             if (std::find(attackingLine.begin(), attackingLine.end(), t_position) != attackingLine.end()) {
                 Piece *passivePiece = this->getPieceAtPosition(attackingLine.back());
-                MoveVector *mv = new MoveVector(t_piece, passivePiece, attackingLine);
+                MoveVector* mv = m_moveVectorPool.create(t_piece, passivePiece, attackingLine);
                 mv->registerSelf();
             }
         }
@@ -1149,38 +1468,23 @@ void Board::initialiseActiveVectorsForPieceThroughPosition(Piece *t_piece, const
         }
 
 
+        const BoardIndex throughIndex = t_position->getBoardIndex();
         short direction;
         for (direction = directionRangeStart; direction <= directionRangeEnd && !throughPos; ++direction) {
-            short tempDirection = direction;
-            Position *prev = piecePosition;
-            Position *cur = this->getPosition(PositionUtils::getIndexOfPositionInDirection(piecePosition, direction));
-            // Do we know there's no point in continuing?
-            bool passComplete = false;
-
-            while (!cur->isOffBoard() && !passComplete) {
-                positionsInLine.push_back(cur);
-                const Piece *pieceHere = this->getPieceAtPosition(cur);
-                throughPos = throughPos || (*cur == *t_position);
-                if (pieceHere != nullptr) {
-                    passComplete = true;
-                    if (throughPos) {
-                        solutionFound = true;
-                    }
+            const BoardIndex* square;
+            for (square = PositionUtils::getRay(piecePosition->getBoardIndex(), direction); *square != 0; ++square) {
+                positionsInLine.push_back(this->getPosition(*square));
+                throughPos = throughPos || *square == throughIndex;
+                if (m_occupancy.test(*square)) {
+                    solutionFound = throughPos;
+                    break;
                 }
-                const BoardIndex nextInLineIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur,
-                                                                                                 tempDirection);
-                const short flapChange = PositionUtils::getFlapChange(prev, cur);
-                tempDirection = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(tempDirection,
-                                                                                                         flapChange);
-                prev = cur;
-                cur = this->getPosition(nextInLineIndex);
-
             }
 
             // If we've found a solution, make a mv out of it and register it
             if (solutionFound) {
                 Piece *passivePiece = this->getPieceAtPosition(positionsInLine.back());
-                MoveVector *mv = new MoveVector(t_piece, passivePiece, positionsInLine);
+                MoveVector* mv = m_moveVectorPool.create(t_piece, passivePiece, positionsInLine);
                 mv->registerSelf();
             } else {
                 // Otherwise, start again with a fresh vector
@@ -1190,24 +1494,10 @@ void Board::initialiseActiveVectorsForPieceThroughPosition(Piece *t_piece, const
     }
 }
 
-void Board::updateCheckmateRecords() {
-    // Update checkmate records
-    // For each player whose king has someone actively attacking it (i.e. in check), check if they have any legal moves
+void Board::invalidateCheckmateRecords() {
     short player;
     for (player = 1; player <= 6; ++player) {
-        bool isInCheckmate = false;
-        if (this->isPlayerInCheck(player)) {
-            const std::vector<Move>& moves = this->getLegalMoves(player);
-            if (moves.size() == 1) {
-                isInCheckmate = moves[0].isNull();
-            }
-        }
-
-        if (isInCheckmate) {
-            this->markPlayerInCheckmate(player);
-        } else {
-            this->markPlayerNotInCheckmate(player);
-        }
+        m_checkmateRecordsKnown[player - 1] = false;
     }
 }
 
@@ -1260,7 +1550,9 @@ void Board::undoMoveDeNovo(const Move* m) {
 
     }
 
-    this->updateCheckmateRecords();
+    this->retreatSideToMove();
+    assert(m_hash == this->computeHashFromScratch());
+    this->invalidateCheckmateRecords();
 
 }
 
@@ -1338,14 +1630,16 @@ void Board::undoMoveCumulative(const Move* m) {
 
     }
 
-    this->updateCheckmateRecords();
+    this->retreatSideToMove();
+    assert(m_hash == this->computeHashFromScratch());
+    this->invalidateCheckmateRecords();
 
 }
 
 bool Board::isLegalMove(const Move& t_move, const short t_player) const {
     // If it's a null move, check that we're in checkmate or that we're in stalemate
     if (t_move.isNull()) {
-        return this->isPlayerInCheckmate(t_player) || this->getLegalMoves(t_player)[0].isNull();
+        return this->isPlayerInCheckmate(t_player) || !this->hasAnyLegalMove(t_player);
     }
     const Position* fromPosition = t_move.getFromPosition();
     const Position* toPosition = t_move.getToPosition();
@@ -1361,12 +1655,14 @@ bool Board::isLegalMove(const Move& t_move, const short t_player) const {
                     (replacePiece->getOwner() == t_player &&
                     replacePiece->getPosition()->isOffBoard() &&
                     toPosition->isVortex())) &&
+            // Moves stored from other positions (e.g. killer moves) may not take what's actually there
+            this->getPieceAtPosition(toPosition) == takenPiece &&
             (takenPiece == nullptr ||
                     (!TeamUtils::isSameTeam(takenPiece->getOwner(), t_player) &&
                     (takenPiece->getPosition()->getBoardIndex() == toPosition->getBoardIndex())))) {
 
         // Now that the move seems legit, make sure it's a move that ensures we don't end in check
-        std::vector<Position*> blockableSquares;
+        Bitboard blockableSquares;
         const PieceType pieceType = movingPiece->getType();
         const Piece* myKing = this->getPiecesForPlayer(t_player)[12];
 
@@ -1375,34 +1671,29 @@ bool Board::isLegalMove(const Move& t_move, const short t_player) const {
         bool kingInCheck = attackingKingVectors.size() != 0;
 
         if (kingInCheck) {
-            blockableSquares = MoveVectorUtils::getCommonPositions(attackingKingVectors);
+            blockableSquares = MoveVectorUtils::getCommonSquares(attackingKingVectors);
         }
 
-        const std::vector<Position*>& accessibleSquares = this->getAccessibleSquares(this->getPieceAtPosition(fromPosition));
+        PositionList accessibleSquares;
+        this->getAccessibleSquares(this->getPieceAtPosition(fromPosition), accessibleSquares);
         // If the destination isn't accessible, return false
-        if (std::find(accessibleSquares.begin(), accessibleSquares.end(), toPosition) == accessibleSquares.end()) {
+        if (!accessibleSquares.contains(toPosition)) {
             return false;
         }
 
         // If our piece is blocking an attack on our king, the move has to be along that line
-        const std::vector<Position*>& attackingLineOnKingThroughThisPiece = this->getAttackingLineOnKingThroughPosition(fromPosition, movingPiece->getOwner());
-        if (attackingLineOnKingThroughThisPiece.size() > 0 &&
-                std::find(attackingLineOnKingThroughThisPiece.begin(), attackingLineOnKingThroughThisPiece.end(), toPosition) == attackingLineOnKingThroughThisPiece.end()) {
+        PositionList attackingLineOnKingThroughThisPiece;
+        this->getAttackingLineOnKingThroughPosition(fromPosition, movingPiece->getOwner(), attackingLineOnKingThroughThisPiece);
+        if (!attackingLineOnKingThroughThisPiece.empty() && !attackingLineOnKingThroughThisPiece.contains(toPosition)) {
             return false;
         }
 
         if (kingInCheck && pieceType != PieceType::KING) {
             // If the king is in check, make sure we're blocking that check AND that position is one we're allowed to go to
-            return std::find(blockableSquares.begin(), blockableSquares.end(), toPosition) != blockableSquares.end();
+            return blockableSquares.test(toPosition->getBoardIndex());
         } else if (pieceType == PieceType::KING) {
             // If the piece is a king, make sure it's not moving into the path of an attack
-            const std::vector<std::deque<Position*>>& attacksThroughPos = this->getLinesAttackingSquare(this->getPosition(toPosition));
-            bool anyoneAttacking = false;
-            for (auto const& positionDeque : attacksThroughPos) {
-                const Piece* attackingPiece = this->getPieceAtPosition(positionDeque[0]);
-                anyoneAttacking = anyoneAttacking || !TeamUtils::isSameTeam(movingPiece->getOwner(), attackingPiece->getOwner());
-            }
-            return !anyoneAttacking;
+            return this->isKingDestinationSafe(movingPiece, toPosition);
 
         } else {
             return true;
@@ -1414,6 +1705,83 @@ bool Board::isLegalMove(const Move& t_move, const short t_player) const {
     }
 }
 
+double Board::getStaticExchangeEvaluation(const Move& t_move, const double t_pieceValues[]) const {
+    const Piece* takenPiece = t_move.getPieceTaken();
+    if (t_move.isNull() || takenPiece == nullptr) {
+        return 0;
+    }
+    const Piece* movingPiece = this->getPieceAtPosition(t_move.getFromPosition());
+    const Piece* replacePiece = t_move.getReplacePiece();
+    // A vortex replacement leaves the replacing piece on the square rather than the pawn
+    const Piece* pieceOnSquare = replacePiece != nullptr ? replacePiece : movingPiece;
+
+    // Everything touching the square (apart from the piece taking), whichever side it's on
+    std::vector<const Piece*> capturers;
+    for (auto const& moveVector : takenPiece->getPassiveAttackingVectors()) {
+        if (moveVector->getActivePiece() != movingPiece) {
+            capturers.push_back(moveVector->getActivePiece());
+        }
+    }
+    for (auto const& moveVector : takenPiece->getPassiveDefendingVectors()) {
+        capturers.push_back(moveVector->getActivePiece());
+    }
+
+    // gains[i] is what the side making the ith capture has won if the exchange stops there
+    double gains[Board::MAX_EXCHANGE_LENGTH];
+    gains[0] = t_pieceValues[static_cast<int>(takenPiece->getType())];
+    if (replacePiece != nullptr) {
+        gains[0] += t_pieceValues[static_cast<int>(replacePiece->getType())] - t_pieceValues[static_cast<int>(movingPiece->getType())];
+    }
+    int numCaptures = 1;
+
+    // Go round the table from the player after the mover. Each player whose team doesn't hold the square retakes with
+    // their cheapest piece, keeping their king until last. Once a whole round passes without a capture, it's over
+    short player = movingPiece->getOwner();
+    int playersSinceCapture = 0;
+    while (playersSinceCapture < 6 && numCaptures < Board::MAX_EXCHANGE_LENGTH) {
+        player = player == 6 ? 1 : player + 1;
+        ++playersSinceCapture;
+        if (TeamUtils::isSameTeam(player, pieceOnSquare->getOwner())) {
+            continue;
+        }
+
+        std::size_t cheapest = capturers.size();
+        std::size_t i;
+        for (i = 0; i < capturers.size(); ++i) {
+            if (capturers[i]->getOwner() == player &&
+                    (cheapest == capturers.size() || capturers[cheapest]->getType() == PieceType::KING ||
+                     (capturers[i]->getType() != PieceType::KING &&
+                      t_pieceValues[static_cast<int>(capturers[i]->getType())] < t_pieceValues[static_cast<int>(capturers[cheapest]->getType())]))) {
+                cheapest = i;
+            }
+        }
+        if (cheapest == capturers.size()) {
+            continue;
+        }
+        const Piece* capturer = capturers[cheapest];
+        capturers.erase(capturers.begin() + cheapest);
+
+        // A king can't take into an attack, so only gets to if nobody on the other team is left to retake
+        if (capturer->getType() == PieceType::KING &&
+                std::any_of(capturers.begin(), capturers.end(), [&] (const Piece* t_piece) -> bool {
+                    return !TeamUtils::isSameTeam(t_piece->getOwner(), player);
+                })) {
+            continue;
+        }
+
+        gains[numCaptures] = t_pieceValues[static_cast<int>(pieceOnSquare->getType())] - gains[numCaptures - 1];
+        ++numCaptures;
+        pieceOnSquare = capturer;
+        playersSinceCapture = 0;
+    }
+
+    // Work back from the end, with each side stopping the exchange early if carrying on would lose them material
+    while (--numCaptures > 0) {
+        gains[numCaptures - 1] = -std::max(-gains[numCaptures - 1], gains[numCaptures]);
+    }
+    return gains[0];
+}
+
 int Board::getNumPieces() const {
     int num = 0;
     for (auto const& playerPieces : m_pieces) {
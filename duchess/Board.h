@@ -5,16 +5,25 @@
 #include <deque>
 #include "Position.h"
 #include "PositionUtils.h"
+#include "Bitboard.h"
 #include "Piece.h"
 #include "PieceType.h"
 #include "TeamType.h"
 #include "Move.h"
+#include "MoveList.h"
+#include "PositionList.h"
+#include "CompactMove.h"
+#include "MoveVectorPool.h"
+#include "ZobristUtils.h"
 #include "EvaluationMode.h"
 
 class Board {
 public:
     Board();
     Board(std::vector<std::vector<Piece>> t_pieces);
+    // Deep copy: the new board gets its own positions, pieces and move vectors, so it can be searched independently
+    Board(const Board& t_other);
+    Board& operator=(const Board&) = delete;
 
     ~Board();
 
@@ -30,19 +39,77 @@ public:
     Position* getPosition(const Position* t_position) const;
 
     std::vector<Piece*> getPiecesForPlayer(const short t_playerNumber) const;
+    // Returns the index of t_piece in getPiecesForPlayer(owner), or CompactMove::NO_PIECE if it isn't on this board
+    short getPieceSlot(const Piece* t_piece) const;
+
+    // Conversion between moves and their packed form. Only valid for moves made up of this board's pieces
+    CompactMove toCompactMove(const Move& t_move) const;
+    Move fromCompactMove(const CompactMove t_move) const;
 
     std::vector<Move> getLegalMoves(const short t_player) const;
-    std::vector<Move> getLegalMovesForPiece(const Piece* t_piece, bool t_kingInCheck, const std::vector<Position*>& t_blockableSquares) const;
+    // Fills t_moves (which is cleared first) with the legal moves for t_player
+    void getLegalMoves(const short t_player, MoveList& t_moves) const;
+    // Appends the legal moves for t_piece onto t_moves
+    void getLegalMovesForPiece(const Piece* t_piece, bool t_kingInCheck, const Bitboard& t_blockableSquares, MoveList& t_moves) const;
+    bool hasAnyLegalMove(const short t_player) const;
+    // Fills t_moves (which is cleared first) with the legal captures and vortex pawn replacements for t_player, without
+    // working out the quiet moves. If t_player is in check every legal move is an escape, so they're all included
+    // Unlike getLegalMoves, t_moves is left empty (rather than given the null move) if there are none
+    void getTacticalMoves(const short t_player, MoveList& t_moves) const;
     bool isLegalMove(const Move& t_move, const short t_player) const;
+    // Static exchange evaluation: how much material t_move wins once everyone has finished retaking on its destination,
+    // with t_pieceValues indexed by PieceType. Players retake in seat order, each with their cheapest piece, and each
+    // side stops once carrying on would lose it material. Only pieces already attacking or defending the piece taken
+    // are counted, so any lined up behind them are missed. Quiet moves are worth 0
+    double getStaticExchangeEvaluation(const Move& t_move, const double t_pieceValues[]) const;
 
     // Given a piece, returns the positions it can move to (not necessarily check-safe though)
     std::vector<Position*> getAccessibleSquares(const Piece* t_piece) const;
+    // As above, but into t_squares (which is cleared first), for move generation
+    void getAccessibleSquares(const Piece* t_piece, PositionList& t_squares) const;
     std::vector<Position*> getAccessibleSquaresAlongDirection(const Piece* t_piece, const short t_startDirection) const;
     std::vector<BoardIndex> getTeleportableSquares(const Piece* t_piece) const;
+    void getTeleportableSquares(const Piece* t_piece, PositionList& t_squares) const;
     bool doesSquareContainPiece(const Position* t_position) const;
     bool doesSquareContainEnemy(const Position* t_position, const Piece* t_piece) const;
     bool doesSquareContainAlly(const Position* t_position, const Piece* t_piece) const;
     bool isPieceWizardAdjacent(const Piece* t_piece) const;
+
+    // Occupancy masks. Pieces that are off board are never included
+    const Bitboard& getOccupancy() const {
+        return m_occupancy;
+    }
+
+    // Assumes 1 <= t_player <= 6
+    const Bitboard& getPlayerOccupancy(const short t_player) const {
+        return m_playerOccupancy[t_player - 1];
+    }
+
+    // Assumes t_team is ODDS or EVENS
+    const Bitboard& getTeamOccupancy(const TeamType t_team) const {
+        return m_teamOccupancy[t_team == TeamType::ODDS ? 1 : 0];
+    }
+
+    const Bitboard& getPieceTypeOccupancy(const PieceType t_type) const {
+        return m_pieceTypeOccupancy[static_cast<int>(t_type)];
+    }
+
+    // Zobrist hash of the pieces on the board and the side to move, kept up to date by setPiecePosition and apply/undo
+    ZobristKey getHash() const {
+        return m_hash;
+    }
+
+    // The player whose turn it is. Starts at 1 and moves round by one with every applied move (null moves included)
+    short getSideToMove() const {
+        return m_sideToMove;
+    }
+
+    // For boards set up part way through a game (e.g. by the server)
+    void setSideToMove(const short t_player);
+
+    // Slow. For checking the incrementally updated hash
+    ZobristKey computeHashFromScratch() const;
+
     std::vector<Piece*> getAdjacentPieces(const Piece* t_piece) const;
 
     // Returns a list of positions that if entered will block all incoming attacks on the player's king
@@ -52,10 +119,16 @@ public:
     void markPlayerNotInCheckmate(const short t_player);
     bool isPlayerInCheckmate(const short t_player) const;
     bool isPlayerInCheck(const short t_player) const;
+    // Whether the quiet move t_move (nothing taken or replaced) would put anyone on the other team to its mover in check,
+    // worked out without applying it. Errs towards yes: if any of them is in check already, or the move or their king
+    // involves the vortex, the answer is yes
+    bool doesQuietMoveGiveCheck(const Move& t_move) const;
     bool isTerminal() const;
     TeamType getWinner() const;
 
     std::vector<std::deque<Position*>> getLinesAttackingSquare(Position* t_position) const;
+    // The squares of the pieces at the far end of the lines getLinesAttackingSquare would give, without building the lines
+    Bitboard getPiecesTouchingSquare(const Position* t_position) const;
 
     void initialiseAttDefVectors();
     void initialiseActiveVectorsForPiece(Piece* t_piece);
@@ -65,6 +138,7 @@ public:
     std::vector<std::vector<Position*>> getActiveLinesFromVortex(const Piece* t_piece) const;
     std::vector<Position*> getAttackingOrDefendingVectorAlongLine(const Piece* t_piece, const short t_direction) const;
     std::vector<Position*> getAttackingLineOnKingThroughPosition(const Position* t_throughPosition, const short t_owner) const;
+    void getAttackingLineOnKingThroughPosition(const Position* t_throughPosition, const short t_owner, PositionList& t_line) const;
     std::vector<Piece*> getPawnReplaceOptionsForPlayer(const short t_player) const;
 
     void applyMove(const Move* m, const EvaluationMode mode);
@@ -76,10 +150,14 @@ public:
     void undoMove(const Move* m, const EvaluationMode mode);
     void undoMoveDeNovo(const Move* m);
     void undoMoveCumulative(const Move* m);
-    void updateCheckmateRecords();
+    // Forgets who is in checkmate, so it gets recomputed next time it's asked for. Called after every apply/undo
+    void invalidateCheckmateRecords();
 
     int getNumPieces() const;
 
+    // No exchange on one square can have more captures than this (there are only so many pieces that can reach it)
+    static const int MAX_EXCHANGE_LENGTH = 32;
+
 private:
     // Each element denotes a position (indexed 0 - 157)
     // These don't map to anything, but they're helpful for avoiding creating multiple copies of the same position in memory
@@ -105,7 +183,36 @@ private:
     //    14: Rook 2
     std::vector<std::vector<Piece*>> m_pieces;
 
-    std::vector<bool> m_checkmateRecords;
+    // Whether each player is in checkmate, filled in lazily by isPlayerInCheckmate
+    // A record is only meaningful if the matching entry of m_checkmateRecordsKnown is true
+    mutable std::vector<bool> m_checkmateRecords;
+    mutable std::vector<bool> m_checkmateRecordsKnown;
+
+    // Storage for every MoveVector between this board's pieces
+    MoveVectorPool m_moveVectorPool;
+
+    // Bitsets over board indices mirroring m_squares, maintained by setPiecePosition
+    // Team masks are indexed by player % 2 (so 0 = EVENS, 1 = ODDS), piece type masks by the PieceType value
+    Bitboard m_occupancy;
+    Bitboard m_playerOccupancy[6];
+    Bitboard m_teamOccupancy[2];
+    Bitboard m_pieceTypeOccupancy[9];
+
+    ZobristKey m_hash;
+    short m_sideToMove;
+
+    // Also keep m_hash in step, since these are called whenever a piece lands on or leaves a square
+    void addPieceToOccupancy(const Piece* t_piece, const BoardIndex t_positionIndex);
+    void removePieceFromOccupancy(const Piece* t_piece, const BoardIndex t_positionIndex);
+    void advanceSideToMove();
+    void retreatSideToMove();
+
+    // Whether t_king could move to t_destination without an enemy attacking it there
+    bool isKingDestinationSafe(const Piece* t_king, const Position* t_destination) const;
+
+    // Appends the squares t_piece can slide to along a line from PositionUtils::getRay or getVortexRay
+    void appendAccessibleSquaresAlongRay(const Piece* t_piece, const BoardIndex* t_ray,
+                                         PositionList& t_accessiblePositions) const;
 
 };
 
@@ -0,0 +1,45 @@
+#ifndef DUCHESS_CPP_BOARDINDEXLIST_H
+#define DUCHESS_CPP_BOARDINDEXLIST_H
+
+#include "Position.h"
+
+#include <vector>
+
+// A read-only view onto a fixed list of board indices (e.g. a row of one of the PositionUtils lookup tables)
+// Doesn't own its memory, so is cheap to copy and never allocates
+class BoardIndexList {
+public:
+    BoardIndexList(const BoardIndex* t_indices, const BoardIndex t_size) :
+            m_indices(t_indices), m_size(t_size)
+            { }
+
+    const BoardIndex* begin() const {
+        return m_indices;
+    }
+
+    const BoardIndex* end() const {
+        return m_indices + m_size;
+    }
+
+    BoardIndex size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    BoardIndex operator[](const BoardIndex t_i) const {
+        return m_indices[t_i];
+    }
+
+    std::vector<BoardIndex> toVector() const {
+        return std::vector<BoardIndex>(this->begin(), this->end());
+    }
+
+private:
+    const BoardIndex* m_indices;
+    BoardIndex m_size;
+};
+
+#endif //DUCHESS_CPP_BOARDINDEXLIST_H
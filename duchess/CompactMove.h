@@ -0,0 +1,127 @@
+#ifndef DUCHESS_CPP_COMPACTMOVE_H
+#define DUCHESS_CPP_COMPACTMOVE_H
+
+#include "Position.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+// A move packed into a single 32 bit integer, so it can be compared, ordered and hashed without touching memory
+// Laid out (most significant first) as:
+//    bits 24 - 31: from board index
+//    bits 16 - 23: to board index
+//    bits 8 - 15:  taken piece code
+//    bits 0 - 7:   replace piece code
+// A piece code is 0 for no piece, otherwise 1 + (owner - 1) * 15 + slot, where slot is the piece's index in
+// Board::getPiecesForPlayer(owner). The null move is 0 (nothing legal ever moves from off board)
+// Use Board::toCompactMove and Board::fromCompactMove to convert to and from Move
+class CompactMove {
+public:
+    static const short PIECES_PER_PLAYER = 15;
+    static const short NO_PIECE = -1;
+
+    // The null move
+    CompactMove() : m_value(0) { }
+
+    explicit CompactMove(const uint32_t t_value) : m_value(t_value) { }
+
+    // Slots are NO_PIECE if there is no taken/replace piece (in which case the owner is ignored)
+    CompactMove(const BoardIndex t_from, const BoardIndex t_to,
+                const short t_takenOwner = 0, const short t_takenSlot = NO_PIECE,
+                const short t_replaceOwner = 0, const short t_replaceSlot = NO_PIECE) :
+            m_value((uint32_t(t_from) << 24) | (uint32_t(t_to) << 16) |
+                    (uint32_t(CompactMove::toPieceCode(t_takenOwner, t_takenSlot)) << 8) |
+                    uint32_t(CompactMove::toPieceCode(t_replaceOwner, t_replaceSlot)))
+            { }
+
+    uint32_t getValue() const {
+        return m_value;
+    }
+
+    bool isNull() const {
+        return m_value == 0;
+    }
+
+    BoardIndex getFromIndex() const {
+        return BoardIndex(m_value >> 24);
+    }
+
+    BoardIndex getToIndex() const {
+        return BoardIndex(m_value >> 16);
+    }
+
+    bool hasPieceTaken() const {
+        return this->getTakenCode() != 0;
+    }
+
+    // Only valid if hasPieceTaken()
+    short getPieceTakenOwner() const {
+        return CompactMove::pieceCodeToOwner(this->getTakenCode());
+    }
+
+    short getPieceTakenSlot() const {
+        return CompactMove::pieceCodeToSlot(this->getTakenCode());
+    }
+
+    bool hasReplacePiece() const {
+        return this->getReplaceCode() != 0;
+    }
+
+    // Only valid if hasReplacePiece()
+    short getReplacePieceOwner() const {
+        return CompactMove::pieceCodeToOwner(this->getReplaceCode());
+    }
+
+    short getReplacePieceSlot() const {
+        return CompactMove::pieceCodeToSlot(this->getReplaceCode());
+    }
+
+    bool operator==(const CompactMove t_other) const {
+        return m_value == t_other.m_value;
+    }
+
+    bool operator!=(const CompactMove t_other) const {
+        return m_value != t_other.m_value;
+    }
+
+    // Null first, then by from index, to index, taken piece and replace piece
+    bool operator<(const CompactMove t_other) const {
+        return m_value < t_other.m_value;
+    }
+
+private:
+    uint32_t m_value;
+
+    unsigned char getTakenCode() const {
+        return (m_value >> 8) & 0xFF;
+    }
+
+    unsigned char getReplaceCode() const {
+        return m_value & 0xFF;
+    }
+
+    static unsigned char toPieceCode(const short t_owner, const short t_slot) {
+        return t_slot == NO_PIECE ? 0 : 1 + (t_owner - 1) * PIECES_PER_PLAYER + t_slot;
+    }
+
+    static short pieceCodeToOwner(const unsigned char t_code) {
+        return 1 + (t_code - 1) / PIECES_PER_PLAYER;
+    }
+
+    static short pieceCodeToSlot(const unsigned char t_code) {
+        return (t_code - 1) % PIECES_PER_PLAYER;
+    }
+};
+
+namespace std {
+    template <>
+    struct hash<CompactMove> {
+        std::size_t operator()(const CompactMove t_move) const {
+            // Multiplicative hash so that moves differing only in the low (piece) bits still spread across buckets
+            return std::size_t(t_move.getValue() * 2654435761u);
+        }
+    };
+}
+
+#endif //DUCHESS_CPP_COMPACTMOVE_H
@@ -0,0 +1,68 @@
+#ifndef DUCHESS_CPP_MOVELIST_H
+#define DUCHESS_CPP_MOVELIST_H
+
+#include "Move.h"
+
+#include <cassert>
+#include <vector>
+
+// A fixed capacity list of moves that lives wherever it's declared (usually on the stack)
+// Used by move generation and search so that expanding a node never touches the heap
+class MoveList {
+public:
+    // Comfortably above the largest branching factor a single player can have
+    static const unsigned int CAPACITY = 512;
+
+    MoveList() : m_size(0) { }
+
+    void push_back(const Move& t_move) {
+        assert(m_size < CAPACITY);
+        m_moves[m_size++] = t_move;
+    }
+
+    void clear() {
+        m_size = 0;
+    }
+
+    unsigned int size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    Move& operator[](const unsigned int t_i) {
+        return m_moves[t_i];
+    }
+
+    const Move& operator[](const unsigned int t_i) const {
+        return m_moves[t_i];
+    }
+
+    Move* begin() {
+        return m_moves;
+    }
+
+    Move* end() {
+        return m_moves + m_size;
+    }
+
+    const Move* begin() const {
+        return m_moves;
+    }
+
+    const Move* end() const {
+        return m_moves + m_size;
+    }
+
+    std::vector<Move> toVector() const {
+        return std::vector<Move>(this->begin(), this->end());
+    }
+
+private:
+    Move m_moves[CAPACITY];
+    unsigned int m_size;
+};
+
+#endif //DUCHESS_CPP_MOVELIST_H
@@ -1,6 +1,7 @@
 #include "MoveVector.h"
 #include "Position.h"
 #include "Piece.h"
+#include "PositionUtils.h"
 
 #include <string>
 #include <sstream>
@@ -12,12 +13,7 @@ bool MoveVector::doesInvolve(Piece* t_piece) const {
 
 // Does this move vector cross over a certain position?
 bool MoveVector::doesCrossOver(Position* t_position) const {
-    for (auto const& position : this->getPositions()) {
-        if (*position == *t_position) {
-            return true;
-        }
-    }
-    return false;
+    return m_pathMask.test(t_position->getBoardIndex());
 }
 
 void MoveVector::registerSelf() {
@@ -52,8 +48,11 @@ std::string MoveVector::toString() const {
 
     result << "Positions: {";
 
-    for (auto const& pos : this->getPositions()) {
+    unsigned char i;
+    for (i = 0; i < m_pathLength; ++i) {
+        const Position* pos = PositionUtils::boardIndexToPositionSixPlayer(m_path[i]);
         result << " " << pos->toString();
+        delete pos;
     }
 
     result << " }\n";
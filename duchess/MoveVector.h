@@ -2,23 +2,54 @@
 #define DUCHESS_CPP_MOVEVECTOR_H
 
 #include <vector>
+#include <deque>
 #include <cassert>
+#include <algorithm>
 
+#include "Bitboard.h"
 #include "MoveVectorType.h"
 #include "Piece.h"
 #include "PieceType.h"
 #include "Position.h"
 #include "TeamUtils.h"
 
+class MoveVectorPool;
+
 class MoveVector {
 public:
-    MoveVector(Piece* t_activePiece, Piece* t_passivePiece, const std::vector<Position*> t_positions) :
-            m_activePiece(t_activePiece), m_passivePiece(t_passivePiece), m_positions(t_positions),
-            m_moveVectorType(TeamUtils::isSameTeam(t_activePiece->getOwner(), t_passivePiece->getOwner()) ? MoveVectorType::DEFENDING : MoveVectorType::ATTACKING)
+    MoveVector(Piece* t_activePiece, Piece* t_passivePiece, const std::vector<Position*>& t_positions) :
+            m_activePiece(t_activePiece), m_passivePiece(t_passivePiece),
+            m_moveVectorType(TeamUtils::isSameTeam(t_activePiece->getOwner(), t_passivePiece->getOwner()) ? MoveVectorType::DEFENDING : MoveVectorType::ATTACKING),
+            m_activeSlot(0), m_passiveSlot(0), m_pool(nullptr), m_poolSlot(0)
             {
                 assert(*t_activePiece != *t_passivePiece);
+                this->setPath(t_positions.begin(), t_positions.end());
             }
 
+    MoveVector(Piece* t_activePiece, Piece* t_passivePiece, const std::deque<Position*>& t_positions) :
+            m_activePiece(t_activePiece), m_passivePiece(t_passivePiece),
+            m_moveVectorType(TeamUtils::isSameTeam(t_activePiece->getOwner(), t_passivePiece->getOwner()) ? MoveVectorType::DEFENDING : MoveVectorType::ATTACKING),
+            m_activeSlot(0), m_passiveSlot(0), m_pool(nullptr), m_poolSlot(0)
+            {
+                assert(*t_activePiece != *t_passivePiece);
+                this->setPath(t_positions.begin(), t_positions.end());
+            }
+
+    // Same path as t_pathSource but between a different pair of pieces (e.g. the equivalent pieces on a copied board)
+    MoveVector(Piece* t_activePiece, Piece* t_passivePiece, const MoveVector& t_pathSource) :
+            m_activePiece(t_activePiece), m_passivePiece(t_passivePiece),
+            m_pathLength(t_pathSource.m_pathLength), m_pathMask(t_pathSource.m_pathMask),
+            m_moveVectorType(t_pathSource.m_moveVectorType),
+            m_activeSlot(0), m_passiveSlot(0), m_pool(nullptr), m_poolSlot(0)
+            {
+                assert(*t_activePiece != *t_passivePiece);
+                std::copy(t_pathSource.m_path, t_pathSource.m_path + m_pathLength, m_path);
+            }
+
+    // A path runs from the active piece to the passive piece along a single line, so can never be longer than
+    // a full ray plus the squares at either end
+    static const unsigned char MAX_PATH_LENGTH = 16;
+
     // Does this move vector involve t_piece as an active or passive piece?
     bool doesInvolve(Piece* t_piece) const;
 
@@ -41,14 +72,46 @@ public:
         return m_passivePiece;
     }
 
-    const std::vector<Position*>& getPositions() const {
-        return m_positions;
+    unsigned char getPathLength() const {
+        return m_pathLength;
+    }
+
+    // The board indices of the squares from the active piece to the passive piece
+    const BoardIndex* getPath() const {
+        return m_path;
+    }
+
+    // The same squares as getPath, as a set
+    const Bitboard& getPathMask() const {
+        return m_pathMask;
+    }
+
+    std::vector<BoardIndex> getPathAsVector() const {
+        return std::vector<BoardIndex>(m_path, m_path + m_pathLength);
     }
 
     MoveVectorType getMoveVectorType() const {
         return m_moveVectorType;
     }
 
+    // Where this sits in the active/passive piece's list of vectors, maintained by Piece::addMoveVector and
+    // Piece::eraseMoveVector so that removal doesn't need a search
+    unsigned int getActiveSlot() const {
+        return m_activeSlot;
+    }
+
+    void setActiveSlot(const unsigned int t_slot) {
+        m_activeSlot = t_slot;
+    }
+
+    unsigned int getPassiveSlot() const {
+        return m_passiveSlot;
+    }
+
+    void setPassiveSlot(const unsigned int t_slot) {
+        m_passiveSlot = t_slot;
+    }
+
     // Adds itself to the lists maintained by each affected piece
     void registerSelf();
     // Removes itself from the lists maintained by each affected piece
@@ -64,12 +127,34 @@ private:
     Piece* m_activePiece;
     Piece* m_passivePiece;
 
-    // A vector of positions leading from the active piece to the passive piece
+    // The squares leading from the active piece to the passive piece
     // e.g. representing a diagonal line connecting a bishop to a knight
-    const std::vector<Position*> m_positions;
+    // Stored inline (rather than as Position*s on the heap) so that a move vector owns no memory
+    BoardIndex m_path[MAX_PATH_LENGTH];
+    unsigned char m_pathLength;
+    Bitboard m_pathMask;
 
     const MoveVectorType m_moveVectorType;
 
+    unsigned int m_activeSlot;
+    unsigned int m_passiveSlot;
+
+    // The pool this was allocated from, or nullptr if it was created with new
+    friend class MoveVectorPool;
+    MoveVectorPool* m_pool;
+    unsigned int m_poolSlot;
+
+    template <typename PositionIterator>
+    void setPath(PositionIterator t_begin, PositionIterator t_end) {
+        m_pathLength = 0;
+        for (PositionIterator it = t_begin; it != t_end; ++it) {
+            assert(m_pathLength < MAX_PATH_LENGTH);
+            const BoardIndex index = (*it)->getBoardIndex();
+            m_path[m_pathLength++] = index;
+            m_pathMask.set(index);
+        }
+    }
+
 };
 
 #endif //DUCHESS_CPP_MOVEVECTOR_H
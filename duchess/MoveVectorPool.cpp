@@ -0,0 +1,83 @@
+#define NDEBUG
+
+#include "MoveVectorPool.h"
+#include "MoveVector.h"
+
+#include <cassert>
+#include <new>
+#include <deque>
+#include <vector>
+
+MoveVectorPool::~MoveVectorPool() {
+    this->reset();
+}
+
+MoveVector* MoveVectorPool::create(Piece* t_activePiece, Piece* t_passivePiece, const std::vector<Position*>& t_positions) {
+    const unsigned int slot = this->claimSlot();
+    return this->finishCreate(new (this->getSlot(slot)) MoveVector(t_activePiece, t_passivePiece, t_positions), slot);
+}
+
+MoveVector* MoveVectorPool::create(Piece* t_activePiece, Piece* t_passivePiece, const std::deque<Position*>& t_positions) {
+    const unsigned int slot = this->claimSlot();
+    return this->finishCreate(new (this->getSlot(slot)) MoveVector(t_activePiece, t_passivePiece, t_positions), slot);
+}
+
+MoveVector* MoveVectorPool::create(Piece* t_activePiece, Piece* t_passivePiece, const MoveVector& t_pathSource) {
+    const unsigned int slot = this->claimSlot();
+    return this->finishCreate(new (this->getSlot(slot)) MoveVector(t_activePiece, t_passivePiece, t_pathSource), slot);
+}
+
+unsigned int MoveVectorPool::claimSlot() {
+    unsigned int slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        if (m_numSlots == m_chunks.size() * CHUNK_SIZE) {
+            m_chunks.emplace_back(new Slot[CHUNK_SIZE]);
+            m_live.resize(m_chunks.size() * CHUNK_SIZE, false);
+        }
+        slot = m_numSlots++;
+    }
+    return slot;
+}
+
+MoveVector* MoveVectorPool::finishCreate(MoveVector* t_moveVector, const unsigned int t_slot) {
+    t_moveVector->m_pool = this;
+    t_moveVector->m_poolSlot = t_slot;
+    m_live[t_slot] = true;
+    ++m_numLive;
+    return t_moveVector;
+}
+
+void MoveVectorPool::release(MoveVector* t_moveVector) {
+    assert(t_moveVector->m_pool == this && m_live[t_moveVector->m_poolSlot]);
+    const unsigned int slot = t_moveVector->m_poolSlot;
+    t_moveVector->~MoveVector();
+    m_live[slot] = false;
+    m_freeSlots.push_back(slot);
+    --m_numLive;
+}
+
+void MoveVectorPool::reset() {
+    unsigned int slot;
+    for (slot = 0; slot < m_numSlots; ++slot) {
+        if (m_live[slot]) {
+            this->getSlot(slot)->~MoveVector();
+            m_live[slot] = false;
+        }
+    }
+
+    // Hand slots out from the start again, so a fresh set of vectors is laid out contiguously
+    m_freeSlots.clear();
+    m_numSlots = 0;
+    m_numLive = 0;
+}
+
+void MoveVectorPool::destroy(MoveVector* t_moveVector) {
+    if (t_moveVector->m_pool == nullptr) {
+        delete t_moveVector;
+    } else {
+        t_moveVector->m_pool->release(t_moveVector);
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef DUCHESS_CPP_MOVEVECTORPOOL_H
+#define DUCHESS_CPP_MOVEVECTORPOOL_H
+
+#include "MoveVector.h"
+#include "Piece.h"
+#include "Position.h"
+
+#include <deque>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Hands out MoveVectors from chunks of storage owned by a Board, recycling released ones through a free list
+// so that applying and undoing moves doesn't go through malloc/free for every attack/defence relation
+class MoveVectorPool {
+public:
+    MoveVectorPool() : m_numSlots(0), m_numLive(0) { }
+    ~MoveVectorPool();
+
+    // Pools own raw storage, so can't be shared between boards
+    MoveVectorPool(const MoveVectorPool&) = delete;
+    MoveVectorPool& operator=(const MoveVectorPool&) = delete;
+
+    MoveVector* create(Piece* t_activePiece, Piece* t_passivePiece, const std::vector<Position*>& t_positions);
+    MoveVector* create(Piece* t_activePiece, Piece* t_passivePiece, const std::deque<Position*>& t_positions);
+    MoveVector* create(Piece* t_activePiece, Piece* t_passivePiece, const MoveVector& t_pathSource);
+
+    // Destroys t_moveVector and makes its slot available again
+    // The move vector must have come from this pool, and be deregistered from its pieces already
+    void release(MoveVector* t_moveVector);
+
+    // Destroys every live move vector at once
+    // Only safe once no piece holds a pointer to any of them (see Piece::forgetAllMoveVectors)
+    void reset();
+
+    // Returns t_moveVector to the pool it came from, or deletes it if it was created with new
+    static void destroy(MoveVector* t_moveVector);
+
+    unsigned int getNumLive() const {
+        return m_numLive;
+    }
+
+    unsigned int getNumSlots() const {
+        return m_numSlots;
+    }
+
+    static const unsigned int CHUNK_SIZE = 512;
+
+private:
+    typedef std::aligned_storage<sizeof(MoveVector), alignof(MoveVector)>::type Slot;
+
+    // Finds a free slot and marks it live, ready to construct into
+    unsigned int claimSlot();
+    MoveVector* finishCreate(MoveVector* t_moveVector, const unsigned int t_slot);
+
+    MoveVector* getSlot(const unsigned int t_slot) const {
+        return reinterpret_cast<MoveVector*>(&m_chunks[t_slot / CHUNK_SIZE][t_slot % CHUNK_SIZE]);
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;
+    // Whether each slot currently holds a constructed move vector
+    std::vector<bool> m_live;
+    // Slots that have been used before and are free again
+    std::vector<unsigned int> m_freeSlots;
+    // Slots handed out at least once (everything at or beyond this index is untouched)
+    unsigned int m_numSlots;
+    unsigned int m_numLive;
+};
+
+#endif //DUCHESS_CPP_MOVEVECTORPOOL_H
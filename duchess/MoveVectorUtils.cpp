@@ -1,24 +1,22 @@
 #include "MoveVectorUtils.h"
 #include "MoveVector.h"
 #include "Position.h"
+#include "Bitboard.h"
 
 #include <vector>
 #include <algorithm>
 
-std::vector<Position*> MoveVectorUtils::getCommonPositions(const std::vector<MoveVector*>& t_moveVectors) {
-    std::vector<Position*> positions;
+Bitboard MoveVectorUtils::getCommonSquares(const std::vector<MoveVector*>& t_moveVectors) {
+    Bitboard squares;
     if (t_moveVectors.size() > 0) {
-        positions = t_moveVectors[0]->getPositions();
+        squares = t_moveVectors[0]->getPathMask();
 
         for (std::vector<MoveVector*>::const_iterator it = t_moveVectors.begin() + 1; it != t_moveVectors.end(); ++it) {
-            auto mv = *it;
-            positions = MoveVectorUtils::getCommonPositions(positions, mv->getPositions());
+            squares &= (*it)->getPathMask();
         }
-
     }
 
-
-    return positions;
+    return squares;
 }
 
 std::vector<Position*> MoveVectorUtils::getCommonPositions(const std::vector<Position*>& t_positions1, const std::vector<Position*>& t_positions2) {
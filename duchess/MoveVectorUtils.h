@@ -3,13 +3,14 @@
 
 #include "MoveVector.h"
 #include "Position.h"
+#include "Bitboard.h"
 
 #include <vector>
 
 class MoveVectorUtils {
 public:
-    // Given a list of move vectors, which Positions do they all contain (if any)?
-    static std::vector<Position*> getCommonPositions(const std::vector<MoveVector*>& t_moveVectors);
+    // Given a list of move vectors, which squares do they all contain (if any)?
+    static Bitboard getCommonSquares(const std::vector<MoveVector*>& t_moveVectors);
     static std::vector<Position*> getCommonPositions(const std::vector<Position*>& t_positions1, const std::vector<Position*>& t_positions2);
 };
 
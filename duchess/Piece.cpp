@@ -2,6 +2,7 @@
 #include "Piece.h"
 #include "PieceType.h"
 #include "MoveVector.h"
+#include "MoveVectorPool.h"
 #include <algorithm>
 #include <sstream>
 #include <iostream>
@@ -108,12 +109,12 @@ std::string Piece::getMoveVectorsAsString() const {
 void Piece::clearActiveMoveVectors() {
     for (auto& mv : m_activeAttackingVectors) {
         mv->deregisterSelfFromPassivePiece();
-        delete mv;
+        MoveVectorPool::destroy(mv);
     }
 
     for (auto& mv : m_activeDefendingVectors) {
         mv->deregisterSelfFromPassivePiece();
-        delete mv;
+        MoveVectorPool::destroy(mv);
     }
 
     m_activeAttackingVectors.clear();
@@ -123,12 +124,12 @@ void Piece::clearActiveMoveVectors() {
 void Piece::clearPassiveMoveVectors() {
     for (auto& mv : m_passiveBeingAttacked) {
         mv->deregisterSelfFromActivePiece();
-        delete mv;
+        MoveVectorPool::destroy(mv);
     }
 
     for (auto& mv : m_passiveBeingDefended) {
         mv->deregisterSelfFromActivePiece();
-        delete mv;
+        MoveVectorPool::destroy(mv);
     }
 
     m_passiveBeingAttacked.clear();
@@ -148,56 +149,50 @@ void Piece::clearActiveMoveVectorsThatPassThroughPosition(Position* t_position)
     for (auto& mv : activeAttVecs) {
         if (mv->doesCrossOver(t_position)) {
             mv->deregisterSelf();
-            delete mv;
+            MoveVectorPool::destroy(mv);
         }
     }
 
     for (auto& mv : activeDefVecs) {
         if (mv->doesCrossOver(t_position)) {
             mv->deregisterSelf();
-            delete mv;
+            MoveVectorPool::destroy(mv);
         }
     }
 
 }
 
+void Piece::forgetAllMoveVectors() {
+    m_activeAttackingVectors.clear();
+    m_activeDefendingVectors.clear();
+    m_passiveBeingAttacked.clear();
+    m_passiveBeingDefended.clear();
+}
+
 void Piece::deleteActiveMoveVectors() {
     for (auto mv : m_activeAttackingVectors) {
-        delete mv;
+        MoveVectorPool::destroy(mv);
     }
 
     for (auto mv : m_activeDefendingVectors) {
-        delete mv;
+        MoveVectorPool::destroy(mv);
     }
 }
 
 void Piece::eraseMoveVector(MoveVector* t_moveVector) {
     const bool amIActive = t_moveVector->getActivePiece() == this;
     const MoveVectorType moveVectorType = t_moveVector->getMoveVectorType();
-    std::vector<MoveVector*>::iterator it;
     if (amIActive) {
         if (moveVectorType == MoveVectorType::ATTACKING) {
-            it = std::find(m_activeAttackingVectors.begin(), m_activeAttackingVectors.end(), t_moveVector);
-            if (it != m_activeAttackingVectors.end()) {
-                m_activeAttackingVectors.erase(it);
-            }
+            Piece::eraseFromMoveVectorList(m_activeAttackingVectors, t_moveVector, true);
         } else {
-            it = std::find(m_activeDefendingVectors.begin(), m_activeDefendingVectors.end(), t_moveVector);
-            if (it != m_activeDefendingVectors.end()) {
-                m_activeDefendingVectors.erase(it);
-            }
+            Piece::eraseFromMoveVectorList(m_activeDefendingVectors, t_moveVector, true);
         }
     } else {
         if (moveVectorType == MoveVectorType::ATTACKING) {
-            it = std::find(m_passiveBeingAttacked.begin(), m_passiveBeingAttacked.end(), t_moveVector);
-            if (it != m_passiveBeingAttacked.end()) {
-                m_passiveBeingAttacked.erase(it);
-            }
+            Piece::eraseFromMoveVectorList(m_passiveBeingAttacked, t_moveVector, false);
         } else {
-            it = std::find(m_passiveBeingDefended.begin(), m_passiveBeingDefended.end(), t_moveVector);
-            if (it != m_passiveBeingDefended.end()) {
-                m_passiveBeingDefended.erase(it);
-            }
+            Piece::eraseFromMoveVectorList(m_passiveBeingDefended, t_moveVector, false);
         }
     }
 
@@ -208,19 +203,41 @@ void Piece::addMoveVector(MoveVector* t_moveVector) {
     const MoveVectorType moveVectorType = t_moveVector->getMoveVectorType();
     if (amIActive) {
         if (moveVectorType == MoveVectorType::ATTACKING) {
+            t_moveVector->setActiveSlot(m_activeAttackingVectors.size());
             m_activeAttackingVectors.push_back(t_moveVector);
         } else {
+            t_moveVector->setActiveSlot(m_activeDefendingVectors.size());
             m_activeDefendingVectors.push_back(t_moveVector);
         }
     } else {
         if (moveVectorType == MoveVectorType::ATTACKING) {
+            t_moveVector->setPassiveSlot(m_passiveBeingAttacked.size());
             m_passiveBeingAttacked.push_back(t_moveVector);
         } else {
+            t_moveVector->setPassiveSlot(m_passiveBeingDefended.size());
             m_passiveBeingDefended.push_back(t_moveVector);
         }
     }
 }
 
+// Swaps t_moveVector with the last element of t_list and pops it, fixing up the slot of the vector that moved
+// Does nothing if t_moveVector isn't in the list (its recorded slot won't point back at it)
+void Piece::eraseFromMoveVectorList(std::vector<MoveVector*>& t_list, MoveVector* t_moveVector, const bool t_isActiveList) {
+    const unsigned int slot = t_isActiveList ? t_moveVector->getActiveSlot() : t_moveVector->getPassiveSlot();
+    if (slot >= t_list.size() || t_list[slot] != t_moveVector) {
+        return;
+    }
+
+    MoveVector* last = t_list.back();
+    t_list[slot] = last;
+    if (t_isActiveList) {
+        last->setActiveSlot(slot);
+    } else {
+        last->setPassiveSlot(slot);
+    }
+    t_list.pop_back();
+}
+
 std::vector<Piece*> Piece::getPiecesActivelyTouchingThis() const {
     std::vector<Piece*> pieces;
 
@@ -66,6 +66,10 @@ public:
     // Deletes all its move vectors that pass through a square. To be used when a piece effectively blocks off an old vector
     void clearActiveMoveVectorsThatPassThroughPosition(Position* t_position);
 
+    // Drops every move vector reference without deregistering or deleting anything
+    // Only for use when the owning MoveVectorPool is about to be reset in bulk
+    void forgetAllMoveVectors();
+
     // Just deletes my active vectors
     // To be used by Piece destructor only
     void deleteActiveMoveVectors();
@@ -80,6 +84,8 @@ public:
 
 
 private:
+    static void eraseFromMoveVectorList(std::vector<MoveVector*>& t_list, MoveVector* t_moveVector, const bool t_isActiveList);
+
     // TODO: Can I indicate that the value inside this pointer won't change, just that the pointer address might?
     Position* m_position;
     const PieceType m_type;
@@ -0,0 +1,62 @@
+#ifndef DUCHESS_CPP_POSITIONLIST_H
+#define DUCHESS_CPP_POSITIONLIST_H
+
+#include "Position.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+// A fixed capacity list of positions that lives wherever it's declared (usually on the stack)
+// Used for the squares a piece can reach, so that generating moves for a piece never touches the heap
+class PositionList {
+public:
+    // Comfortably above the most squares a single piece can reach: a queen's rays out of the vortex come to 144,
+    // and knight moves and teleports add a few dozen more
+    static const unsigned int CAPACITY = 256;
+
+    PositionList() : m_size(0) { }
+
+    void push_back(Position* t_position) {
+        assert(m_size < CAPACITY);
+        m_positions[m_size++] = t_position;
+    }
+
+    void clear() {
+        m_size = 0;
+    }
+
+    unsigned int size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    bool contains(const Position* t_position) const {
+        return std::find(this->begin(), this->end(), t_position) != this->end();
+    }
+
+    Position* operator[](const unsigned int t_i) const {
+        return m_positions[t_i];
+    }
+
+    Position* const* begin() const {
+        return m_positions;
+    }
+
+    Position* const* end() const {
+        return m_positions + m_size;
+    }
+
+    std::vector<Position*> toVector() const {
+        return std::vector<Position*>(this->begin(), this->end());
+    }
+
+private:
+    Position* m_positions[CAPACITY];
+    unsigned int m_size;
+};
+
+#endif //DUCHESS_CPP_POSITIONLIST_H
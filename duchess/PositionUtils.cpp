@@ -82,29 +82,16 @@ Position* PositionUtils::boardIndexToPositionSixPlayer(const BoardIndex t_boardI
 }
 
 
-std::vector<BoardIndex> PositionUtils::getAdjacentSquareIndices(const Position* t_position) {
+BoardIndexList PositionUtils::getAdjacentSquareIndices(const Position* t_position) {
     assert(!t_position->isOffBoard());
-    if (!t_position->isVortex()) {
-        return getAdjacentSquareIndicesLookup(t_position);
-//        return getAdjacentSquareIndicesSlow(t_position);
-    } else {
-        std::vector<BoardIndex> adjacents {124, 130, 136, 142, 148, 154};
-        return adjacents;
-    }
+    return getAdjacentSquareIndicesLookup(t_position);
+//    return getAdjacentSquareIndicesSlow(t_position);
 }
 
-std::vector<BoardIndex> PositionUtils::getAdjacentSquareIndicesLookup(const Position* t_position) {
-    assert(!t_position->isVortex());
-    std::vector<BoardIndex> adjacents;
-    const BoardIndex index = positionToBoardIndexSixPlayer(t_position) - 1;
-    int i;
-    for (i = DIRECTION_CLOCKWISE; i <= DIRECTION_OUT; ++i) {
-        const BoardIndex boardIndex = tablePositionAndDirectionToPosition[index][i];
-        if (boardIndex != 0) {
-            adjacents.push_back(boardIndex);
-        }
-    }
-    return adjacents;
+// Rows of the neighbour tables hold the number of entries followed by the entries themselves
+BoardIndexList PositionUtils::getAdjacentSquareIndicesLookup(const Position* t_position) {
+    const BoardIndex* row = tablePositionToAdjacentSquares[positionToBoardIndexSixPlayer(t_position) - 1];
+    return BoardIndexList(row + 1, row[0]);
 }
 
 std::vector<BoardIndex> PositionUtils::getAdjacentSquareIndicesSlow(const Position* t_position) {
@@ -144,29 +131,15 @@ std::vector<BoardIndex> PositionUtils::getAdjacentSquareIndicesSlow(const Positi
     return adjacentSquares;
 }
 
-std::vector<BoardIndex> PositionUtils::getDiagonalSquareIndices(const Position* t_position) {
+BoardIndexList PositionUtils::getDiagonalSquareIndices(const Position* t_position) {
     assert(!t_position->isOffBoard());
-    if (!t_position->isVortex()) {
-        return getDiagonalSquareIndicesLookup(t_position);
-//        return getDiagonalSquareIndicesSlow(t_position);
-    } else {
-        std::vector<BoardIndex> adjacents {125, 131, 137, 143, 149, 155};
-        return adjacents;
-    }
+    return getDiagonalSquareIndicesLookup(t_position);
+//    return getDiagonalSquareIndicesSlow(t_position);
 }
 
-std::vector<BoardIndex> PositionUtils::getDiagonalSquareIndicesLookup(const Position* t_position) {
-    assert(!t_position->isVortex());
-    std::vector<BoardIndex> adjacents;
-    const BoardIndex index = positionToBoardIndexSixPlayer(t_position) - 1;
-    int i;
-    for (i = DIRECTION_IN_CLOCKWISE; i <= DIRECTION_OUT_ANTICLOCKWISE; ++i) {
-        const BoardIndex boardIndex = tablePositionAndDirectionToPosition[index][i];
-        if (boardIndex != 0) {
-            adjacents.push_back(boardIndex);
-        }
-    }
-    return adjacents;
+BoardIndexList PositionUtils::getDiagonalSquareIndicesLookup(const Position* t_position) {
+    const BoardIndex* row = tablePositionToDiagonalSquares[positionToBoardIndexSixPlayer(t_position) - 1];
+    return BoardIndexList(row + 1, row[0]);
 }
 
 std::vector<BoardIndex> PositionUtils::getDiagonalSquareIndicesSlow(const Position* t_position) {
@@ -199,34 +172,20 @@ std::vector<BoardIndex> PositionUtils::getDiagonalSquareIndicesSlow(const Positi
     return diagonalSquares;
 }
 
-std::vector<BoardIndex> PositionUtils::getAdjacentAndDiagonalSquareIndices(const Position* t_position) {
+BoardIndexList PositionUtils::getAdjacentAndDiagonalSquareIndices(const Position* t_position) {
     assert(!t_position->isOffBoard());
-    if (!t_position->isVortex()) {
-        return getAdjacentAndDiagonalSquareIndicesLookup(t_position);
-//        return getAdjacentAndDiagonalSquareIndicesSlow(t_position);
-    } else {
-        std::vector<BoardIndex> adjacents {124, 130, 136, 142, 148, 154, 125, 131, 137, 143, 149, 155};
-        return adjacents;
-    }
+    return getAdjacentAndDiagonalSquareIndicesLookup(t_position);
+//    return getAdjacentAndDiagonalSquareIndicesSlow(t_position);
 }
 
-std::vector<BoardIndex> PositionUtils::getAdjacentAndDiagonalSquareIndicesLookup(const Position* t_position) {
-    assert(!t_position->isVortex());
-    std::vector<BoardIndex> adjacents;
-    const BoardIndex index = positionToBoardIndexSixPlayer(t_position) - 1;
-    int i;
-    for (i = DIRECTION_CLOCKWISE; i <= DIRECTION_OUT_ANTICLOCKWISE; ++i) {
-        const BoardIndex boardIndex = tablePositionAndDirectionToPosition[index][i];
-        if (boardIndex != 0) {
-            adjacents.push_back(boardIndex);
-        }
-    }
-    return adjacents;
+BoardIndexList PositionUtils::getAdjacentAndDiagonalSquareIndicesLookup(const Position* t_position) {
+    const BoardIndex* row = tablePositionToAdjacentAndDiagonalSquares[positionToBoardIndexSixPlayer(t_position) - 1];
+    return BoardIndexList(row + 1, row[0]);
 }
 
 std::vector<BoardIndex> PositionUtils::getAdjacentAndDiagonalSquareIndicesSlow(const Position* t_position) {
-    const std::vector<BoardIndex> adjacent = PositionUtils::getAdjacentSquareIndices(t_position);
-    const std::vector<BoardIndex> diagonal = PositionUtils::getDiagonalSquareIndices(t_position);
+    const std::vector<BoardIndex> adjacent = PositionUtils::getAdjacentSquareIndices(t_position).toVector();
+    const std::vector<BoardIndex> diagonal = PositionUtils::getDiagonalSquareIndices(t_position).toVector();
 
     return GeneralUtils::mergeArrays(adjacent, diagonal);
 }
@@ -525,6 +484,16 @@ BoardIndex PositionUtils::getIndexOfNextSquareInLine(const Position *t_pos1, con
     return result;
 }
 
+const BoardIndex* PositionUtils::getRay(const BoardIndex t_positionIndex, const short t_direction) {
+    assert(t_positionIndex != 0 && t_positionIndex != NUM_BOARD_INDICES_SIX_PLAYER - 1);
+    return tablePositionAndDirectionToRay[t_positionIndex - 1][t_direction];
+}
+
+const BoardIndex* PositionUtils::getVortexRay(const short t_rayIndex) {
+    assert(t_rayIndex >= 0 && t_rayIndex < NUM_VORTEX_RAYS);
+    return tableVortexRays[t_rayIndex];
+}
+
 BoardIndex PositionUtils::getIndexOfPositionInDirection(const Position* t_position, const short t_direction) {
     assert(!t_position->isVortex() && !t_position->isOffBoard());
     return getIndexOfPositionInDirectionLookup(t_position, t_direction);
@@ -615,15 +584,16 @@ short PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(c
     return directionOfNextSquare;
 }
 
-std::vector<BoardIndex> PositionUtils::getKnightMovesFromPosition(const Position* t_position) {
+BoardIndexList PositionUtils::getKnightMovesFromPosition(const Position* t_position) {
     assert(!t_position->isOffBoard());
     return getKnightMovesFromPositionLookup(t_position);
 //    return getKnightMovesFromPositionSlow(t_position);
 }
 
 
-std::vector<BoardIndex> PositionUtils::getKnightMovesFromPositionLookup(const Position* t_position) {
-    return PositionUtils::tablePositionToKnightMoves[positionToBoardIndexSixPlayer(t_position) - 1];
+BoardIndexList PositionUtils::getKnightMovesFromPositionLookup(const Position* t_position) {
+    const BoardIndex* row = tablePositionToKnightMoves[positionToBoardIndexSixPlayer(t_position) - 1];
+    return BoardIndexList(row + 1, row[0]);
 }
 
 std::vector<BoardIndex> PositionUtils::getKnightMovesFromPositionSlow(const Position* t_position) {
@@ -634,14 +604,14 @@ std::vector<BoardIndex> PositionUtils::getKnightMovesFromPositionSlow(const Posi
 
     } else {
 
-        std::vector<BoardIndex> diagonals = getDiagonalSquareIndices(t_position);
-        std::vector<BoardIndex> adjacents = getAdjacentSquareIndices(t_position);
+        std::vector<BoardIndex> diagonals = getDiagonalSquareIndices(t_position).toVector();
+        std::vector<BoardIndex> adjacents = getAdjacentSquareIndices(t_position).toVector();
 
         // For each adjacent square, get the squares diagonal to it. If they're not in adjacents, add them to moves
         for (std::vector<BoardIndex>::iterator it = adjacents.begin(); it != adjacents.end(); ++it) {
             if (*it != 0) {
                 const Position* p = boardIndexToPositionSixPlayer(*it);
-                std::vector<BoardIndex> diagonalFromAdjacent = getDiagonalSquareIndices(p);
+                std::vector<BoardIndex> diagonalFromAdjacent = getDiagonalSquareIndices(p).toVector();
                 for (std::vector<BoardIndex>::iterator dfaIt = diagonalFromAdjacent.begin(); dfaIt != diagonalFromAdjacent.end(); ++dfaIt) {
                     // If this square is not adjacent to t_position and it's not in moves, add it
                     const BoardIndex boardIndex = *dfaIt;
@@ -660,7 +630,7 @@ std::vector<BoardIndex> PositionUtils::getKnightMovesFromPositionSlow(const Posi
         for (std::vector<BoardIndex>::iterator it = diagonals.begin(); it != diagonals.end(); ++it) {
             if (*it != 0) {
                 const Position* p = boardIndexToPositionSixPlayer(*it);
-                std::vector<BoardIndex> adjacentToDiagonal = getAdjacentSquareIndices(p);
+                std::vector<BoardIndex> adjacentToDiagonal = getAdjacentSquareIndices(p).toVector();
                 for (std::vector<BoardIndex>::iterator atdIt = adjacentToDiagonal.begin(); atdIt != adjacentToDiagonal.end(); ++atdIt) {
                     // If this square is not adjacent to t_position and it's not in moves, add it
                     const BoardIndex boardIndex = *atdIt;
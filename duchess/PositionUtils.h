@@ -5,6 +5,7 @@
 
 #include "Position.h"
 #include "PieceType.h"
+#include "BoardIndexList.h"
 // Forward declare position so we can use pointers to it
 // class Position;
 
@@ -14,24 +15,25 @@ public:
     static BoardIndex positionToBoardIndexSixPlayer(const Position* t_position);
     static BoardIndex positionToBoardIndexSixPlayerSlow(const Position* t_position);
 
+    // The non-Slow versions of these neighbourhood lookups return views into static tables, so they never allocate
     // Given a position, return a board index relating to the positions adjacent (not diagonal) to that position
-    static std::vector<BoardIndex> getAdjacentSquareIndices(const Position* t_position);
-    static std::vector<BoardIndex> getAdjacentSquareIndicesLookup(const Position* t_position);
+    static BoardIndexList getAdjacentSquareIndices(const Position* t_position);
+    static BoardIndexList getAdjacentSquareIndicesLookup(const Position* t_position);
     static std::vector<BoardIndex> getAdjacentSquareIndicesSlow(const Position* t_position);
 
     // Given a position, return a board index relating to the positions adjacent (not diagonal) to that position
-    static std::vector<BoardIndex> getDiagonalSquareIndices(const Position* t_position);
-    static std::vector<BoardIndex> getDiagonalSquareIndicesLookup(const Position* t_position);
+    static BoardIndexList getDiagonalSquareIndices(const Position* t_position);
+    static BoardIndexList getDiagonalSquareIndicesLookup(const Position* t_position);
     static std::vector<BoardIndex> getDiagonalSquareIndicesSlow(const Position* t_position);
 
-    static std::vector<BoardIndex> getAdjacentAndDiagonalSquareIndices(const Position* t_position);
-    static std::vector<BoardIndex> getAdjacentAndDiagonalSquareIndicesLookup(const Position* t_position);
+    static BoardIndexList getAdjacentAndDiagonalSquareIndices(const Position* t_position);
+    static BoardIndexList getAdjacentAndDiagonalSquareIndicesLookup(const Position* t_position);
     static std::vector<BoardIndex> getAdjacentAndDiagonalSquareIndicesSlow(const Position* t_position);
 
     // Given a position, return a board index relating to the nearby knight moves from that position
-    static std::vector<BoardIndex> getKnightMovesFromPosition(const Position* t_position);
+    static BoardIndexList getKnightMovesFromPosition(const Position* t_position);
     static std::vector<BoardIndex> getKnightMovesFromPositionSlow(const Position* t_position);
-    static std::vector<BoardIndex> getKnightMovesFromPositionLookup(const Position* t_position);
+    static BoardIndexList getKnightMovesFromPositionLookup(const Position* t_position);
 
     static BoardIndex getIndexOfInnerAdjacentColumn(const Position* t_position);
     static BoardIndex getIndexOfInnerAdjacentColumnSlow(const Position* t_position);
@@ -66,6 +68,13 @@ public:
     static BoardIndex getIndexOfPositionInDirectionLookup(const Position* t_position, const short t_direction);
     static BoardIndex getIndexOfNextSquareInLine(const Position* t_pos1, const Position* t_pos2, const short t_directionUsed);
 
+    // Returns the full line of board indices travelled through from t_positionIndex (exclusive) in t_direction, with flap
+    // changes and vortex crossings already resolved. The line is terminated by a 0 (off board). Not valid for the vortex
+    static const BoardIndex* getRay(const BoardIndex t_positionIndex, const short t_direction);
+    // Returns one of the lines out of the vortex (terminated by a 0)
+    // Rays 0 - 5 go OUT through the adjacent squares, rays 6 - 11 go OUT_ANTICLOCKWISE through the diagonal squares
+    static const BoardIndex* getVortexRay(const short t_rayIndex);
+
     static bool canPieceMoveInDirection(const PieceType t_pieceType, const short t_direction);
 
     static int distanceToVortex(const Position* t_position);
@@ -74,6 +83,17 @@ public:
     static const BoardIndex NUM_BOARD_INDICES_SIX_PLAYER = 158;
     static const BoardIndex NUM_VALID_POSITIONS_SIX_PLAYER = 182;
 
+    // Largest neighbourhoods of any square (all reached on the vortex)
+    static const BoardIndex MAX_ADJACENT_SQUARES = 6;
+    static const BoardIndex MAX_DIAGONAL_SQUARES = 6;
+    static const BoardIndex MAX_ADJACENT_AND_DIAGONAL_SQUARES = 12;
+    static const BoardIndex MAX_KNIGHT_MOVES = 12;
+
+    // Longest line (excluding the starting square) on the board
+    static const short MAX_RAY_LENGTH = 12;
+    static const short NUM_VORTEX_RAYS = 12;
+    static const short NUM_VORTEX_ADJACENT_RAYS = 6;
+
     static const short DIRECTION_CLOCKWISE = 0;
     static const short DIRECTION_ANTICLOCKWISE = 1;
     static const short DIRECTION_IN = 2;
@@ -87,8 +107,13 @@ private:
     static const BoardIndex sixPlayerPositionToIndex[];
     static const char sixPlayerIndexToPosition[];
     static const BoardIndex tablePositionAndDirectionToPosition[][8];
+    static const BoardIndex tablePositionAndDirectionToRay[][8][MAX_RAY_LENGTH + 1];
+    static const BoardIndex tableVortexRays[NUM_VORTEX_RAYS][MAX_RAY_LENGTH + 1];
     static const short tablePositionStepsToPosition[8][NUM_BOARD_INDICES_SIX_PLAYER - 1][NUM_BOARD_INDICES_SIX_PLAYER - 1]; // [NUM_PIECES - 1][NUM_POSITIONS][NUM_POSITIONS]
-    static const std::vector<std::vector<BoardIndex>> tablePositionToKnightMoves;
+    static const BoardIndex tablePositionToAdjacentSquares[][MAX_ADJACENT_SQUARES + 1];
+    static const BoardIndex tablePositionToDiagonalSquares[][MAX_DIAGONAL_SQUARES + 1];
+    static const BoardIndex tablePositionToAdjacentAndDiagonalSquares[][MAX_ADJACENT_AND_DIAGONAL_SQUARES + 1];
+    static const BoardIndex tablePositionToKnightMoves[][MAX_KNIGHT_MOVES + 1];
 };
 
 
@@ -194,164 +194,1914 @@ const BoardIndex PositionUtils::tablePositionAndDirectionToPosition[PositionUtil
         {155, 97, 145, 153, 148, 152, 98, 96}
 };
 
-const std::vector<std::vector<BoardIndex>> PositionUtils::tablePositionToKnightMoves {
-        {12, 8},
-        {11, 13, 9},
-        {12, 14, 6, 10},
-        {13, 15, 7},
-        {14, 8},
-        {17, 13, 3},
-        {16, 18, 14, 4},
-        {17, 19, 11, 1, 15, 5},
-        {18, 20, 12, 2},
-        {19, 13, 3},
-        {2, 40, 132, 18, 8},
-        {1, 3, 129, 121, 19, 9},
-        {2, 4, 132, 122, 16, 6, 20, 10},
-        {3, 5, 121, 123, 17, 7},
-        {4, 122, 116, 18, 8},
-        {7, 131, 39, 121, 13, 35},
-        {6, 8, 124, 128, 40, 122, 14},
-        {7, 9, 131, 125, 129, 11, 123, 15},
-        {8, 10, 124, 126, 132, 12, 116},
-        {9, 125, 117, 121, 13, 111},
-        {32, 28},
-        {31, 33, 29},
-        {32, 34, 26, 30},
-        {33, 35, 27},
-        {34, 28},
-        {37, 33, 23},
-        {36, 38, 34, 24},
-        {37, 39, 31, 21, 35, 25},
-        {38, 40, 32, 22},
-        {39, 33, 23},
-        {22, 60, 138, 38, 28},
-        {21, 23, 135, 127, 39, 29},
-        {22, 24, 138, 128, 36, 26, 40, 30},
-        {23, 25, 127, 129, 37, 27},
-        {24, 128, 16, 38, 28},
-        {27, 137, 59, 127, 33, 55},
-        {26, 28, 130, 134, 60, 128, 34},
-        {27, 29, 137, 131, 135, 31, 129, 35},
-        {28, 30, 130, 132, 138, 32, 16},
-        {29, 131, 17, 127, 33, 11},
-        {52, 48},
-        {51, 53, 49},
-        {52, 54, 46, 50},
-        {53, 55, 47},
-        {54, 48},
-        {57, 53, 43},
-        {56, 58, 54, 44},
-        {57, 59, 51, 41, 55, 45},
-        {58, 60, 52, 42},
-        {59, 53, 43},
-        {42, 80, 144, 58, 48},
-        {41, 43, 141, 133, 59, 49},
-        {42, 44, 144, 134, 56, 46, 60, 50},
-        {43, 45, 133, 135, 57, 47},
-        {44, 134, 36, 58, 48},
-        {47, 143, 79, 133, 53, 75},
-        {46, 48, 136, 140, 80, 134, 54},
-        {47, 49, 143, 137, 141, 51, 135, 55},
-        {48, 50, 136, 138, 144, 52, 36},
-        {49, 137, 37, 133, 53, 31},
-        {72, 68},
-        {71, 73, 69},
-        {72, 74, 66, 70},
-        {73, 75, 67},
-        {74, 68},
-        {77, 73, 63},
-        {76, 78, 74, 64},
-        {77, 79, 71, 61, 75, 65},
-        {78, 80, 72, 62},
-        {79, 73, 63},
-        {62, 100, 150, 78, 68},
-        {61, 63, 147, 139, 79, 69},
-        {62, 64, 150, 140, 76, 66, 80, 70},
-        {63, 65, 139, 141, 77, 67},
-        {64, 140, 56, 78, 68},
-        {67, 149, 99, 139, 73, 95},
-        {66, 68, 142, 146, 100, 140, 74},
-        {67, 69, 149, 143, 147, 71, 141, 75},
-        {68, 70, 142, 144, 150, 72, 56},
-        {69, 143, 57, 139, 73, 51},
-        {92, 88},
-        {91, 93, 89},
-        {92, 94, 86, 90},
-        {93, 95, 87},
-        {94, 88},
-        {97, 93, 83},
-        {96, 98, 94, 84},
-        {97, 99, 91, 81, 95, 85},
-        {98, 100, 92, 82},
-        {99, 93, 83},
-        {82, 120, 156, 98, 88},
-        {81, 83, 153, 145, 99, 89},
-        {82, 84, 156, 146, 96, 86, 100, 90},
-        {83, 85, 145, 147, 97, 87},
-        {84, 146, 76, 98, 88},
-        {87, 155, 119, 145, 93, 115},
-        {86, 88, 148, 152, 120, 146, 94},
-        {87, 89, 155, 149, 153, 91, 147, 95},
-        {88, 90, 148, 150, 156, 92, 76},
-        {89, 149, 77, 145, 93, 71},
-        {112, 108},
-        {111, 113, 109},
-        {112, 114, 106, 110},
-        {113, 115, 107},
-        {114, 108},
-        {117, 113, 103},
-        {116, 118, 114, 104},
-        {117, 119, 111, 101, 115, 105},
-        {118, 120, 112, 102},
-        {119, 113, 103},
-        {102, 20, 126, 118, 108},
-        {101, 103, 123, 151, 119, 109},
-        {102, 104, 126, 152, 116, 106, 120, 110},
-        {103, 105, 151, 153, 117, 107},
-        {104, 152, 96, 118, 108},
-        {107, 125, 19, 151, 113, 15},
-        {106, 108, 154, 122, 20, 152, 114},
-        {107, 109, 125, 155, 123, 111, 153, 115},
-        {108, 110, 154, 156, 126, 112, 96},
-        {109, 155, 97, 151, 113, 91},
-        {12, 14, 130, 154, 128, 16, 126, 20, 148, 136},
-        {13, 15, 157, 151, 131, 17, 117},
-        {14, 154, 118, 124, 18, 112},
-        {17, 19, 137, 143, 149, 155, 127, 129, 151, 123, 145, 133},
-        {18, 20, 148, 152, 130, 132, 118, 116, 136, 142},
-        {19, 155, 119, 157, 121, 111, 113},
-        {32, 34, 136, 124, 134, 36, 132, 40, 154, 142},
-        {33, 35, 157, 121, 137, 37, 17},
-        {34, 124, 18, 130, 38, 12},
-        {37, 39, 125, 143, 149, 155, 133, 135, 121, 129, 151, 139},
-        {38, 40, 154, 122, 136, 138, 18, 16, 142, 148},
-        {39, 125, 19, 157, 127, 11, 13},
-        {52, 54, 142, 130, 140, 56, 138, 60, 124, 148},
-        {53, 55, 157, 127, 143, 57, 37},
-        {54, 130, 38, 136, 58, 32},
-        {57, 59, 125, 131, 149, 155, 139, 141, 127, 135, 121, 145},
-        {58, 60, 124, 128, 142, 144, 38, 36, 148, 154},
-        {59, 131, 39, 157, 133, 31, 33},
-        {72, 74, 148, 136, 146, 76, 144, 80, 130, 154},
-        {73, 75, 157, 133, 149, 77, 57},
-        {74, 136, 58, 142, 78, 52},
-        {77, 79, 125, 131, 137, 155, 145, 147, 133, 141, 127, 151},
-        {78, 80, 130, 134, 148, 150, 58, 56, 124, 154},
-        {79, 137, 59, 157, 139, 51, 53},
-        {92, 94, 154, 142, 152, 96, 150, 100, 136, 124},
-        {93, 95, 157, 139, 155, 97, 77},
-        {94, 142, 78, 148, 98, 72},
-        {97, 99, 125, 131, 137, 143, 151, 153, 139, 147, 133, 121},
-        {98, 100, 136, 140, 154, 156, 78, 76, 124, 130},
-        {99, 143, 79, 157, 145, 71, 73},
-        {112, 114, 124, 148, 122, 116, 156, 120, 142, 130},
-        {113, 115, 157, 145, 125, 117, 97},
-        {114, 148, 98, 154, 118, 92},
-        {117, 119, 131, 137, 143, 149, 121, 123, 145, 153, 139, 127},
-        {118, 120, 142, 146, 124, 126, 98, 96, 130, 136},
-        {119, 149, 99, 157, 151, 91, 93},
-        {126, 122, 132, 128, 138, 134, 144, 140, 150, 146, 156, 152}
+// Given a position (excluding the vortex) and a direction, the full line of positions travelled through in that direction
+// Flap changes and crossings of the vortex are already resolved. Each line is terminated (and padded) with 0s
+const BoardIndex PositionUtils::tablePositionAndDirectionToRay[PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER - 2][8][PositionUtils::MAX_RAY_LENGTH + 1] =
+{{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{2, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{6, 11, 16, 129, 128, 127, 138, 135, 60, 55, 50, 45, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{7, 13, 19, 123, 117, 113, 109, 105, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{7, 12, 17, 132, 131, 130, 137, 134, 59, 54, 49, 44, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{8, 14, 20, 116, 112, 108, 104, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{8, 13, 18, 121, 124, 157, 142, 139, 78, 73, 68, 63, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{7, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{9, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{9, 14, 19, 122, 125, 154, 155, 156, 97, 92, 87, 82, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{8, 12, 16, 40, 34, 28, 22, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{4, 3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{10, 15, 20, 123, 126, 151, 152, 153, 96, 91, 86, 81, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{9, 13, 17, 129, 39, 33, 27, 21, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{7, 8, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{11, 16, 129, 128, 127, 138, 135, 60, 55, 50, 45, 0, 0}, 
+{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{12, 18, 122, 126, 118, 114, 110, 0, 0, 0, 0, 0, 0}, 
+{2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{8, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{12, 17, 132, 131, 130, 137, 134, 59, 54, 49, 44, 0, 0}, 
+{2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{13, 19, 123, 117, 113, 109, 105, 0, 0, 0, 0, 0, 0}, 
+{3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{7, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{9, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{13, 18, 121, 124, 157, 142, 139, 78, 73, 68, 63, 0, 0}, 
+{3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{12, 16, 40, 34, 28, 22, 0, 0, 0, 0, 0, 0, 0}, 
+{2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{14, 20, 116, 112, 108, 104, 0, 0, 0, 0, 0, 0, 0}, 
+{4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{8, 7, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{14, 19, 122, 125, 154, 155, 156, 97, 92, 87, 82, 0, 0}, 
+{4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{13, 17, 129, 39, 33, 27, 21, 0, 0, 0, 0, 0, 0}, 
+{3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{9, 8, 7, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{15, 20, 123, 126, 151, 152, 153, 96, 91, 86, 81, 0, 0}, 
+{5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{14, 18, 132, 128, 38, 32, 26, 0, 0, 0, 0, 0, 0}, 
+{4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{12, 13, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{16, 129, 128, 127, 138, 135, 60, 55, 50, 45, 0, 0, 0}, 
+{6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{17, 121, 125, 151, 119, 115, 0, 0, 0, 0, 0, 0, 0}, 
+{7, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{13, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{17, 132, 131, 130, 137, 134, 59, 54, 49, 44, 0, 0, 0}, 
+{7, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{16, 40, 34, 28, 22, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{18, 122, 126, 118, 114, 110, 0, 0, 0, 0, 0, 0, 0}, 
+{8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{12, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{18, 121, 124, 157, 142, 139, 78, 73, 68, 63, 0, 0, 0}, 
+{8, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{17, 129, 39, 33, 27, 21, 0, 0, 0, 0, 0, 0, 0}, 
+{7, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{19, 123, 117, 113, 109, 105, 0, 0, 0, 0, 0, 0, 0}, 
+{9, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{13, 12, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{19, 122, 125, 154, 155, 156, 97, 92, 87, 82, 0, 0, 0}, 
+{9, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{18, 132, 128, 38, 32, 26, 0, 0, 0, 0, 0, 0, 0}, 
+{8, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{20, 116, 112, 108, 104, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{14, 13, 12, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{20, 123, 126, 151, 152, 153, 96, 91, 86, 81, 0, 0, 0}, 
+{10, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{19, 121, 131, 127, 37, 31, 0, 0, 0, 0, 0, 0, 0}, 
+{9, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{17, 18, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{129, 128, 127, 138, 135, 60, 55, 50, 45, 0, 0, 0, 0}, 
+{11, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{40, 34, 28, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{132, 124, 154, 152, 120, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{12, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{18, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{132, 131, 130, 137, 134, 59, 54, 49, 44, 0, 0, 0, 0}, 
+{12, 7, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{129, 39, 33, 27, 21, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{121, 125, 151, 119, 115, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{13, 9, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{121, 124, 157, 142, 139, 78, 73, 68, 63, 0, 0, 0, 0}, 
+{13, 8, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{132, 128, 38, 32, 26, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{12, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{122, 126, 118, 114, 110, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{14, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{18, 17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{122, 125, 154, 155, 156, 97, 92, 87, 82, 0, 0, 0, 0}, 
+{14, 9, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{121, 131, 127, 37, 31, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{13, 7, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{123, 117, 113, 109, 105, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{19, 18, 17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{123, 126, 151, 152, 153, 96, 91, 86, 81, 0, 0, 0, 0}, 
+{15, 10, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{122, 124, 130, 138, 36, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{14, 8, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{116, 112, 108, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{22, 23, 24, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{26, 31, 36, 135, 134, 133, 144, 141, 80, 75, 70, 65, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{27, 33, 39, 129, 17, 13, 9, 5, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{23, 24, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{27, 32, 37, 138, 137, 136, 143, 140, 79, 74, 69, 64, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{28, 34, 40, 16, 12, 8, 4, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{22, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{24, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{28, 33, 38, 127, 130, 157, 148, 145, 98, 93, 88, 83, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{27, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{29, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{23, 22, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{29, 34, 39, 128, 131, 124, 125, 126, 117, 112, 107, 102, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{28, 32, 36, 60, 54, 48, 42, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{24, 23, 22, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{30, 35, 40, 129, 132, 121, 122, 123, 116, 111, 106, 101, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{29, 33, 37, 135, 59, 53, 47, 41, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{27, 28, 29, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{31, 36, 135, 134, 133, 144, 141, 80, 75, 70, 65, 0, 0}, 
+{21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{32, 38, 128, 132, 18, 14, 10, 0, 0, 0, 0, 0, 0}, 
+{22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{28, 29, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{32, 37, 138, 137, 136, 143, 140, 79, 74, 69, 64, 0, 0}, 
+{22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{33, 39, 129, 17, 13, 9, 5, 0, 0, 0, 0, 0, 0}, 
+{23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{27, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{29, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{33, 38, 127, 130, 157, 148, 145, 98, 93, 88, 83, 0, 0}, 
+{23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{32, 36, 60, 54, 48, 42, 0, 0, 0, 0, 0, 0, 0}, 
+{22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{34, 40, 16, 12, 8, 4, 0, 0, 0, 0, 0, 0, 0}, 
+{24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{28, 27, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{34, 39, 128, 131, 124, 125, 126, 117, 112, 107, 102, 0, 0}, 
+{24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{33, 37, 135, 59, 53, 47, 41, 0, 0, 0, 0, 0, 0}, 
+{23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{29, 28, 27, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{35, 40, 129, 132, 121, 122, 123, 116, 111, 106, 101, 0, 0}, 
+{25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{34, 38, 138, 134, 58, 52, 46, 0, 0, 0, 0, 0, 0}, 
+{24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{32, 33, 34, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{36, 135, 134, 133, 144, 141, 80, 75, 70, 65, 0, 0, 0}, 
+{26, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{37, 127, 131, 121, 19, 15, 0, 0, 0, 0, 0, 0, 0}, 
+{27, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{33, 34, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{37, 138, 137, 136, 143, 140, 79, 74, 69, 64, 0, 0, 0}, 
+{27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{36, 60, 54, 48, 42, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{38, 128, 132, 18, 14, 10, 0, 0, 0, 0, 0, 0, 0}, 
+{28, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{32, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{34, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{38, 127, 130, 157, 148, 145, 98, 93, 88, 83, 0, 0, 0}, 
+{28, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{37, 135, 59, 53, 47, 41, 0, 0, 0, 0, 0, 0, 0}, 
+{27, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{39, 129, 17, 13, 9, 5, 0, 0, 0, 0, 0, 0, 0}, 
+{29, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{33, 32, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{39, 128, 131, 124, 125, 126, 117, 112, 107, 102, 0, 0, 0}, 
+{29, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{38, 138, 134, 58, 52, 46, 0, 0, 0, 0, 0, 0, 0}, 
+{28, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{40, 16, 12, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{34, 33, 32, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{40, 129, 132, 121, 122, 123, 116, 111, 106, 101, 0, 0, 0}, 
+{30, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{39, 127, 137, 133, 57, 51, 0, 0, 0, 0, 0, 0, 0}, 
+{29, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{37, 38, 39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{135, 134, 133, 144, 141, 80, 75, 70, 65, 0, 0, 0, 0}, 
+{31, 26, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{60, 54, 48, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{138, 130, 124, 122, 20, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{32, 28, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{38, 39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{138, 137, 136, 143, 140, 79, 74, 69, 64, 0, 0, 0, 0}, 
+{32, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{135, 59, 53, 47, 41, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{127, 131, 121, 19, 15, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{33, 29, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{37, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{127, 130, 157, 148, 145, 98, 93, 88, 83, 0, 0, 0, 0}, 
+{33, 28, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{138, 134, 58, 52, 46, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{32, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{128, 132, 18, 14, 10, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{34, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{38, 37, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{128, 131, 124, 125, 126, 117, 112, 107, 102, 0, 0, 0, 0}, 
+{34, 29, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{127, 137, 133, 57, 51, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{33, 27, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{129, 17, 13, 9, 5, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{39, 38, 37, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{129, 132, 121, 122, 123, 116, 111, 106, 101, 0, 0, 0, 0}, 
+{35, 30, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{128, 130, 136, 144, 56, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{34, 28, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{16, 12, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{42, 43, 44, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{46, 51, 56, 141, 140, 139, 150, 147, 100, 95, 90, 85, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{47, 53, 59, 135, 37, 33, 29, 25, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{43, 44, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{47, 52, 57, 144, 143, 142, 149, 146, 99, 94, 89, 84, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{48, 54, 60, 36, 32, 28, 24, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{42, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{44, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{48, 53, 58, 133, 136, 157, 154, 151, 118, 113, 108, 103, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{47, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{49, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{43, 42, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{49, 54, 59, 134, 137, 130, 131, 132, 17, 12, 7, 2, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{48, 52, 56, 80, 74, 68, 62, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{44, 43, 42, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{50, 55, 60, 135, 138, 127, 128, 129, 16, 11, 6, 1, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{49, 53, 57, 141, 79, 73, 67, 61, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{47, 48, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{51, 56, 141, 140, 139, 150, 147, 100, 95, 90, 85, 0, 0}, 
+{41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{52, 58, 134, 138, 38, 34, 30, 0, 0, 0, 0, 0, 0}, 
+{42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{48, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{52, 57, 144, 143, 142, 149, 146, 99, 94, 89, 84, 0, 0}, 
+{42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{53, 59, 135, 37, 33, 29, 25, 0, 0, 0, 0, 0, 0}, 
+{43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{47, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{53, 58, 133, 136, 157, 154, 151, 118, 113, 108, 103, 0, 0}, 
+{43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{52, 56, 80, 74, 68, 62, 0, 0, 0, 0, 0, 0, 0}, 
+{42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{54, 60, 36, 32, 28, 24, 0, 0, 0, 0, 0, 0, 0}, 
+{44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{48, 47, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{54, 59, 134, 137, 130, 131, 132, 17, 12, 7, 2, 0, 0}, 
+{44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{53, 57, 141, 79, 73, 67, 61, 0, 0, 0, 0, 0, 0}, 
+{43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{49, 48, 47, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{55, 60, 135, 138, 127, 128, 129, 16, 11, 6, 1, 0, 0}, 
+{45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{54, 58, 144, 140, 78, 72, 66, 0, 0, 0, 0, 0, 0}, 
+{44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{52, 53, 54, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{56, 141, 140, 139, 150, 147, 100, 95, 90, 85, 0, 0, 0}, 
+{46, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{57, 133, 137, 127, 39, 35, 0, 0, 0, 0, 0, 0, 0}, 
+{47, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{53, 54, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{57, 144, 143, 142, 149, 146, 99, 94, 89, 84, 0, 0, 0}, 
+{47, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{56, 80, 74, 68, 62, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{58, 134, 138, 38, 34, 30, 0, 0, 0, 0, 0, 0, 0}, 
+{48, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{52, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{54, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{58, 133, 136, 157, 154, 151, 118, 113, 108, 103, 0, 0, 0}, 
+{48, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{57, 141, 79, 73, 67, 61, 0, 0, 0, 0, 0, 0, 0}, 
+{47, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{59, 135, 37, 33, 29, 25, 0, 0, 0, 0, 0, 0, 0}, 
+{49, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{53, 52, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{59, 134, 137, 130, 131, 132, 17, 12, 7, 2, 0, 0, 0}, 
+{49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{58, 144, 140, 78, 72, 66, 0, 0, 0, 0, 0, 0, 0}, 
+{48, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{60, 36, 32, 28, 24, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{54, 53, 52, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{60, 135, 138, 127, 128, 129, 16, 11, 6, 1, 0, 0, 0}, 
+{50, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{59, 133, 143, 139, 77, 71, 0, 0, 0, 0, 0, 0, 0}, 
+{49, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{57, 58, 59, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{141, 140, 139, 150, 147, 100, 95, 90, 85, 0, 0, 0, 0}, 
+{51, 46, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{80, 74, 68, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{144, 136, 130, 128, 40, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{52, 48, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{58, 59, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{144, 143, 142, 149, 146, 99, 94, 89, 84, 0, 0, 0, 0}, 
+{52, 47, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{141, 79, 73, 67, 61, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{133, 137, 127, 39, 35, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{53, 49, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{57, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{59, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{133, 136, 157, 154, 151, 118, 113, 108, 103, 0, 0, 0, 0}, 
+{53, 48, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{144, 140, 78, 72, 66, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{52, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{134, 138, 38, 34, 30, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{54, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{58, 57, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{134, 137, 130, 131, 132, 17, 12, 7, 2, 0, 0, 0, 0}, 
+{54, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{133, 143, 139, 77, 71, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{53, 47, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{135, 37, 33, 29, 25, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{59, 58, 57, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{135, 138, 127, 128, 129, 16, 11, 6, 1, 0, 0, 0, 0}, 
+{55, 50, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{134, 136, 142, 150, 76, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{54, 48, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{36, 32, 28, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{62, 63, 64, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{66, 71, 76, 147, 146, 145, 156, 153, 120, 115, 110, 105, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{67, 73, 79, 141, 57, 53, 49, 45, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{63, 64, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{67, 72, 77, 150, 149, 148, 155, 152, 119, 114, 109, 104, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{68, 74, 80, 56, 52, 48, 44, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{62, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{64, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{68, 73, 78, 139, 142, 157, 124, 121, 18, 13, 8, 3, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{67, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{69, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{63, 62, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{69, 74, 79, 140, 143, 136, 137, 138, 37, 32, 27, 22, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{68, 72, 76, 100, 94, 88, 82, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{64, 63, 62, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{70, 75, 80, 141, 144, 133, 134, 135, 36, 31, 26, 21, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{69, 73, 77, 147, 99, 93, 87, 81, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{67, 68, 69, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{71, 76, 147, 146, 145, 156, 153, 120, 115, 110, 105, 0, 0}, 
+{61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{72, 78, 140, 144, 58, 54, 50, 0, 0, 0, 0, 0, 0}, 
+{62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{68, 69, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{72, 77, 150, 149, 148, 155, 152, 119, 114, 109, 104, 0, 0}, 
+{62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{73, 79, 141, 57, 53, 49, 45, 0, 0, 0, 0, 0, 0}, 
+{63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{67, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{69, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{73, 78, 139, 142, 157, 124, 121, 18, 13, 8, 3, 0, 0}, 
+{63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{72, 76, 100, 94, 88, 82, 0, 0, 0, 0, 0, 0, 0}, 
+{62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{74, 80, 56, 52, 48, 44, 0, 0, 0, 0, 0, 0, 0}, 
+{64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{68, 67, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{74, 79, 140, 143, 136, 137, 138, 37, 32, 27, 22, 0, 0}, 
+{64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{73, 77, 147, 99, 93, 87, 81, 0, 0, 0, 0, 0, 0}, 
+{63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{69, 68, 67, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{75, 80, 141, 144, 133, 134, 135, 36, 31, 26, 21, 0, 0}, 
+{65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{74, 78, 150, 146, 98, 92, 86, 0, 0, 0, 0, 0, 0}, 
+{64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{72, 73, 74, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{76, 147, 146, 145, 156, 153, 120, 115, 110, 105, 0, 0, 0}, 
+{66, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{77, 139, 143, 133, 59, 55, 0, 0, 0, 0, 0, 0, 0}, 
+{67, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{73, 74, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{77, 150, 149, 148, 155, 152, 119, 114, 109, 104, 0, 0, 0}, 
+{67, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{76, 100, 94, 88, 82, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{78, 140, 144, 58, 54, 50, 0, 0, 0, 0, 0, 0, 0}, 
+{68, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{72, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{74, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{78, 139, 142, 157, 124, 121, 18, 13, 8, 3, 0, 0, 0}, 
+{68, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{77, 147, 99, 93, 87, 81, 0, 0, 0, 0, 0, 0, 0}, 
+{67, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{79, 141, 57, 53, 49, 45, 0, 0, 0, 0, 0, 0, 0}, 
+{69, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{73, 72, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{79, 140, 143, 136, 137, 138, 37, 32, 27, 22, 0, 0, 0}, 
+{69, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{78, 150, 146, 98, 92, 86, 0, 0, 0, 0, 0, 0, 0}, 
+{68, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{80, 56, 52, 48, 44, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{74, 73, 72, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{80, 141, 144, 133, 134, 135, 36, 31, 26, 21, 0, 0, 0}, 
+{70, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{79, 139, 149, 145, 97, 91, 0, 0, 0, 0, 0, 0, 0}, 
+{69, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{77, 78, 79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{147, 146, 145, 156, 153, 120, 115, 110, 105, 0, 0, 0, 0}, 
+{71, 66, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{100, 94, 88, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{150, 142, 136, 134, 60, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{72, 68, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{78, 79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{150, 149, 148, 155, 152, 119, 114, 109, 104, 0, 0, 0, 0}, 
+{72, 67, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{147, 99, 93, 87, 81, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{139, 143, 133, 59, 55, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{73, 69, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{77, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{139, 142, 157, 124, 121, 18, 13, 8, 3, 0, 0, 0, 0}, 
+{73, 68, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{150, 146, 98, 92, 86, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{72, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{140, 144, 58, 54, 50, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{74, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{78, 77, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{140, 143, 136, 137, 138, 37, 32, 27, 22, 0, 0, 0, 0}, 
+{74, 69, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{139, 149, 145, 97, 91, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{73, 67, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{141, 57, 53, 49, 45, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{79, 78, 77, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{141, 144, 133, 134, 135, 36, 31, 26, 21, 0, 0, 0, 0}, 
+{75, 70, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{140, 142, 148, 156, 96, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{74, 68, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{56, 52, 48, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{82, 83, 84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{86, 91, 96, 153, 152, 151, 126, 123, 20, 15, 10, 5, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{87, 93, 99, 147, 77, 73, 69, 65, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{83, 84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{87, 92, 97, 156, 155, 154, 125, 122, 19, 14, 9, 4, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{88, 94, 100, 76, 72, 68, 64, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{82, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{88, 93, 98, 145, 148, 157, 130, 127, 38, 33, 28, 23, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{87, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{89, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{83, 82, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{89, 94, 99, 146, 149, 142, 143, 144, 57, 52, 47, 42, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{88, 92, 96, 120, 114, 108, 102, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{84, 83, 82, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{90, 95, 100, 147, 150, 139, 140, 141, 56, 51, 46, 41, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{89, 93, 97, 153, 119, 113, 107, 101, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{87, 88, 89, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{91, 96, 153, 152, 151, 126, 123, 20, 15, 10, 5, 0, 0}, 
+{81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{92, 98, 146, 150, 78, 74, 70, 0, 0, 0, 0, 0, 0}, 
+{82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{88, 89, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{92, 97, 156, 155, 154, 125, 122, 19, 14, 9, 4, 0, 0}, 
+{82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{93, 99, 147, 77, 73, 69, 65, 0, 0, 0, 0, 0, 0}, 
+{83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{87, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{89, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{93, 98, 145, 148, 157, 130, 127, 38, 33, 28, 23, 0, 0}, 
+{83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{92, 96, 120, 114, 108, 102, 0, 0, 0, 0, 0, 0, 0}, 
+{82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{94, 100, 76, 72, 68, 64, 0, 0, 0, 0, 0, 0, 0}, 
+{84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{88, 87, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{94, 99, 146, 149, 142, 143, 144, 57, 52, 47, 42, 0, 0}, 
+{84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{93, 97, 153, 119, 113, 107, 101, 0, 0, 0, 0, 0, 0}, 
+{83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{89, 88, 87, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{95, 100, 147, 150, 139, 140, 141, 56, 51, 46, 41, 0, 0}, 
+{85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{94, 98, 156, 152, 118, 112, 106, 0, 0, 0, 0, 0, 0}, 
+{84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{92, 93, 94, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{96, 153, 152, 151, 126, 123, 20, 15, 10, 5, 0, 0, 0}, 
+{86, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{97, 145, 149, 139, 79, 75, 0, 0, 0, 0, 0, 0, 0}, 
+{87, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{93, 94, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{97, 156, 155, 154, 125, 122, 19, 14, 9, 4, 0, 0, 0}, 
+{87, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{96, 120, 114, 108, 102, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{98, 146, 150, 78, 74, 70, 0, 0, 0, 0, 0, 0, 0}, 
+{88, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{92, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{94, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{98, 145, 148, 157, 130, 127, 38, 33, 28, 23, 0, 0, 0}, 
+{88, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{97, 153, 119, 113, 107, 101, 0, 0, 0, 0, 0, 0, 0}, 
+{87, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{99, 147, 77, 73, 69, 65, 0, 0, 0, 0, 0, 0, 0}, 
+{89, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{93, 92, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{99, 146, 149, 142, 143, 144, 57, 52, 47, 42, 0, 0, 0}, 
+{89, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{98, 156, 152, 118, 112, 106, 0, 0, 0, 0, 0, 0, 0}, 
+{88, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{100, 76, 72, 68, 64, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{94, 93, 92, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{100, 147, 150, 139, 140, 141, 56, 51, 46, 41, 0, 0, 0}, 
+{90, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{99, 145, 155, 151, 117, 111, 0, 0, 0, 0, 0, 0, 0}, 
+{89, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{97, 98, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{153, 152, 151, 126, 123, 20, 15, 10, 5, 0, 0, 0, 0}, 
+{91, 86, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{120, 114, 108, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{156, 148, 142, 140, 80, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{92, 88, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{98, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{156, 155, 154, 125, 122, 19, 14, 9, 4, 0, 0, 0, 0}, 
+{92, 87, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{153, 119, 113, 107, 101, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{145, 149, 139, 79, 75, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{93, 89, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{97, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{145, 148, 157, 130, 127, 38, 33, 28, 23, 0, 0, 0, 0}, 
+{93, 88, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{156, 152, 118, 112, 106, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{92, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{146, 150, 78, 74, 70, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{94, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{98, 97, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{146, 149, 142, 143, 144, 57, 52, 47, 42, 0, 0, 0, 0}, 
+{94, 89, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{145, 155, 151, 117, 111, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{93, 87, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{147, 77, 73, 69, 65, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{99, 98, 97, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{147, 150, 139, 140, 141, 56, 51, 46, 41, 0, 0, 0, 0}, 
+{95, 90, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{146, 148, 154, 126, 116, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{94, 88, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{76, 72, 68, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{102, 103, 104, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{106, 111, 116, 123, 122, 121, 132, 129, 40, 35, 30, 25, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{107, 113, 119, 153, 97, 93, 89, 85, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{103, 104, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{107, 112, 117, 126, 125, 124, 131, 128, 39, 34, 29, 24, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{108, 114, 120, 96, 92, 88, 84, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{102, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{104, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{108, 113, 118, 151, 154, 157, 136, 133, 58, 53, 48, 43, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{107, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{109, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{103, 102, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{109, 114, 119, 152, 155, 148, 149, 150, 77, 72, 67, 62, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{108, 112, 116, 20, 14, 8, 2, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{104, 103, 102, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{110, 115, 120, 153, 156, 145, 146, 147, 76, 71, 66, 61, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{109, 113, 117, 123, 19, 13, 7, 1, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{107, 108, 109, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{111, 116, 123, 122, 121, 132, 129, 40, 35, 30, 25, 0, 0}, 
+{101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{112, 118, 152, 156, 98, 94, 90, 0, 0, 0, 0, 0, 0}, 
+{102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{108, 109, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{112, 117, 126, 125, 124, 131, 128, 39, 34, 29, 24, 0, 0}, 
+{102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{113, 119, 153, 97, 93, 89, 85, 0, 0, 0, 0, 0, 0}, 
+{103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{107, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{109, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{113, 118, 151, 154, 157, 136, 133, 58, 53, 48, 43, 0, 0}, 
+{103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{112, 116, 20, 14, 8, 2, 0, 0, 0, 0, 0, 0, 0}, 
+{102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{114, 120, 96, 92, 88, 84, 0, 0, 0, 0, 0, 0, 0}, 
+{104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{108, 107, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{114, 119, 152, 155, 148, 149, 150, 77, 72, 67, 62, 0, 0}, 
+{104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{113, 117, 123, 19, 13, 7, 1, 0, 0, 0, 0, 0, 0}, 
+{103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{109, 108, 107, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{115, 120, 153, 156, 145, 146, 147, 76, 71, 66, 61, 0, 0}, 
+{105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{114, 118, 126, 122, 18, 12, 6, 0, 0, 0, 0, 0, 0}, 
+{104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{112, 113, 114, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{116, 123, 122, 121, 132, 129, 40, 35, 30, 25, 0, 0, 0}, 
+{106, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{117, 151, 155, 145, 99, 95, 0, 0, 0, 0, 0, 0, 0}, 
+{107, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{113, 114, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{117, 126, 125, 124, 131, 128, 39, 34, 29, 24, 0, 0, 0}, 
+{107, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{116, 20, 14, 8, 2, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{118, 152, 156, 98, 94, 90, 0, 0, 0, 0, 0, 0, 0}, 
+{108, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{112, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{114, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{118, 151, 154, 157, 136, 133, 58, 53, 48, 43, 0, 0, 0}, 
+{108, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{117, 123, 19, 13, 7, 1, 0, 0, 0, 0, 0, 0, 0}, 
+{107, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{119, 153, 97, 93, 89, 85, 0, 0, 0, 0, 0, 0, 0}, 
+{109, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{113, 112, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{119, 152, 155, 148, 149, 150, 77, 72, 67, 62, 0, 0, 0}, 
+{109, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{118, 126, 122, 18, 12, 6, 0, 0, 0, 0, 0, 0, 0}, 
+{108, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{120, 96, 92, 88, 84, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{114, 113, 112, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{120, 153, 156, 145, 146, 147, 76, 71, 66, 61, 0, 0, 0}, 
+{110, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{119, 151, 125, 121, 17, 11, 0, 0, 0, 0, 0, 0, 0}, 
+{109, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{117, 118, 119, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{123, 122, 121, 132, 129, 40, 35, 30, 25, 0, 0, 0, 0}, 
+{111, 106, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{20, 14, 8, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{126, 154, 148, 146, 100, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{112, 108, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{118, 119, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{126, 125, 124, 131, 128, 39, 34, 29, 24, 0, 0, 0, 0}, 
+{112, 107, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{123, 19, 13, 7, 1, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{151, 155, 145, 99, 95, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{113, 109, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{117, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{119, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{151, 154, 157, 136, 133, 58, 53, 48, 43, 0, 0, 0, 0}, 
+{113, 108, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{126, 122, 18, 12, 6, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{112, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{152, 156, 98, 94, 90, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{114, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{118, 117, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{152, 155, 148, 149, 150, 77, 72, 67, 62, 0, 0, 0, 0}, 
+{114, 109, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{151, 125, 121, 17, 11, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{113, 107, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{153, 97, 93, 89, 85, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{119, 118, 117, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{153, 156, 145, 146, 147, 76, 71, 66, 61, 0, 0, 0, 0}, 
+{115, 110, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{152, 154, 124, 132, 16, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{114, 108, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{96, 92, 88, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{132, 129, 40, 35, 30, 25, 0, 0, 0, 0, 0, 0, 0}, 
+{122, 123, 116, 111, 106, 101, 0, 0, 0, 0, 0, 0, 0}, 
+{124, 157, 142, 139, 78, 73, 68, 63, 0, 0, 0, 0, 0}, 
+{18, 13, 8, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{131, 127, 37, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{17, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{125, 151, 119, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{19, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{121, 132, 129, 40, 35, 30, 25, 0, 0, 0, 0, 0, 0}, 
+{123, 116, 111, 106, 101, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{125, 154, 155, 156, 97, 92, 87, 82, 0, 0, 0, 0, 0}, 
+{19, 14, 9, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{124, 130, 138, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{18, 12, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{126, 118, 114, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{122, 121, 132, 129, 40, 35, 30, 25, 0, 0, 0, 0, 0}, 
+{116, 111, 106, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{126, 151, 152, 153, 96, 91, 86, 81, 0, 0, 0, 0, 0}, 
+{20, 15, 10, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{125, 157, 143, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{19, 13, 7, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{117, 113, 109, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{131, 128, 39, 34, 29, 24, 0, 0, 0, 0, 0, 0, 0}, 
+{125, 126, 117, 112, 107, 102, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 142, 139, 78, 73, 68, 63, 0, 0, 0, 0, 0, 0}, 
+{121, 18, 13, 8, 3, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{130, 138, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{132, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{154, 152, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{122, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{124, 131, 128, 39, 34, 29, 24, 0, 0, 0, 0, 0, 0}, 
+{126, 117, 112, 107, 102, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{154, 155, 156, 97, 92, 87, 82, 0, 0, 0, 0, 0, 0}, 
+{122, 19, 14, 9, 4, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 143, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{121, 17, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{151, 119, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{125, 124, 131, 128, 39, 34, 29, 24, 0, 0, 0, 0, 0}, 
+{117, 112, 107, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{151, 152, 153, 96, 91, 86, 81, 0, 0, 0, 0, 0, 0}, 
+{123, 20, 15, 10, 5, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{154, 148, 146, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{122, 18, 12, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{118, 114, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{138, 135, 60, 55, 50, 45, 0, 0, 0, 0, 0, 0, 0}, 
+{128, 129, 16, 11, 6, 1, 0, 0, 0, 0, 0, 0, 0}, 
+{130, 157, 148, 145, 98, 93, 88, 83, 0, 0, 0, 0, 0}, 
+{38, 33, 28, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{137, 133, 57, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{37, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{131, 121, 19, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{39, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{127, 138, 135, 60, 55, 50, 45, 0, 0, 0, 0, 0, 0}, 
+{129, 16, 11, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{131, 124, 125, 126, 117, 112, 107, 102, 0, 0, 0, 0, 0}, 
+{39, 34, 29, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{130, 136, 144, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{38, 32, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{132, 18, 14, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{128, 127, 138, 135, 60, 55, 50, 45, 0, 0, 0, 0, 0}, 
+{16, 11, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{132, 121, 122, 123, 116, 111, 106, 101, 0, 0, 0, 0, 0}, 
+{40, 35, 30, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{131, 157, 149, 147, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{39, 33, 27, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{17, 13, 9, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{137, 134, 59, 54, 49, 44, 0, 0, 0, 0, 0, 0, 0}, 
+{131, 132, 17, 12, 7, 2, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 148, 145, 98, 93, 88, 83, 0, 0, 0, 0, 0, 0}, 
+{127, 38, 33, 28, 23, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{136, 144, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{138, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{124, 122, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{128, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{130, 137, 134, 59, 54, 49, 44, 0, 0, 0, 0, 0, 0}, 
+{132, 17, 12, 7, 2, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{124, 125, 126, 117, 112, 107, 102, 0, 0, 0, 0, 0, 0}, 
+{128, 39, 34, 29, 24, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 149, 147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{127, 37, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{121, 19, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{131, 130, 137, 134, 59, 54, 49, 44, 0, 0, 0, 0, 0}, 
+{17, 12, 7, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{121, 122, 123, 116, 111, 106, 101, 0, 0, 0, 0, 0, 0}, 
+{129, 40, 35, 30, 25, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{124, 154, 152, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{128, 38, 32, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{18, 14, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{144, 141, 80, 75, 70, 65, 0, 0, 0, 0, 0, 0, 0}, 
+{134, 135, 36, 31, 26, 21, 0, 0, 0, 0, 0, 0, 0}, 
+{136, 157, 154, 151, 118, 113, 108, 103, 0, 0, 0, 0, 0}, 
+{58, 53, 48, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{143, 139, 77, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{57, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{137, 127, 39, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{59, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{133, 144, 141, 80, 75, 70, 65, 0, 0, 0, 0, 0, 0}, 
+{135, 36, 31, 26, 21, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{137, 130, 131, 132, 17, 12, 7, 2, 0, 0, 0, 0, 0}, 
+{59, 54, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{136, 142, 150, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{58, 52, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{138, 38, 34, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{134, 133, 144, 141, 80, 75, 70, 65, 0, 0, 0, 0, 0}, 
+{36, 31, 26, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{138, 127, 128, 129, 16, 11, 6, 1, 0, 0, 0, 0, 0}, 
+{60, 55, 50, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{137, 157, 155, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{59, 53, 47, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{37, 33, 29, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{143, 140, 79, 74, 69, 64, 0, 0, 0, 0, 0, 0, 0}, 
+{137, 138, 37, 32, 27, 22, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 154, 151, 118, 113, 108, 103, 0, 0, 0, 0, 0, 0}, 
+{133, 58, 53, 48, 43, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{142, 150, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{144, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{130, 128, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{134, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{136, 143, 140, 79, 74, 69, 64, 0, 0, 0, 0, 0, 0}, 
+{138, 37, 32, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{130, 131, 132, 17, 12, 7, 2, 0, 0, 0, 0, 0, 0}, 
+{134, 59, 54, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 155, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{133, 57, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{127, 39, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{137, 136, 143, 140, 79, 74, 69, 64, 0, 0, 0, 0, 0}, 
+{37, 32, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{127, 128, 129, 16, 11, 6, 1, 0, 0, 0, 0, 0, 0}, 
+{135, 60, 55, 50, 45, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{130, 124, 122, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{134, 58, 52, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{38, 34, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{150, 147, 100, 95, 90, 85, 0, 0, 0, 0, 0, 0, 0}, 
+{140, 141, 56, 51, 46, 41, 0, 0, 0, 0, 0, 0, 0}, 
+{142, 157, 124, 121, 18, 13, 8, 3, 0, 0, 0, 0, 0}, 
+{78, 73, 68, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{149, 145, 97, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{77, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{143, 133, 59, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{79, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{139, 150, 147, 100, 95, 90, 85, 0, 0, 0, 0, 0, 0}, 
+{141, 56, 51, 46, 41, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{143, 136, 137, 138, 37, 32, 27, 22, 0, 0, 0, 0, 0}, 
+{79, 74, 69, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{142, 148, 156, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{78, 72, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{144, 58, 54, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{140, 139, 150, 147, 100, 95, 90, 85, 0, 0, 0, 0, 0}, 
+{56, 51, 46, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{144, 133, 134, 135, 36, 31, 26, 21, 0, 0, 0, 0, 0}, 
+{80, 75, 70, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{143, 157, 125, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{79, 73, 67, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{57, 53, 49, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{149, 146, 99, 94, 89, 84, 0, 0, 0, 0, 0, 0, 0}, 
+{143, 144, 57, 52, 47, 42, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 124, 121, 18, 13, 8, 3, 0, 0, 0, 0, 0, 0}, 
+{139, 78, 73, 68, 63, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{148, 156, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{150, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{136, 134, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{140, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{142, 149, 146, 99, 94, 89, 84, 0, 0, 0, 0, 0, 0}, 
+{144, 57, 52, 47, 42, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{136, 137, 138, 37, 32, 27, 22, 0, 0, 0, 0, 0, 0}, 
+{140, 79, 74, 69, 64, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 125, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{139, 77, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{133, 59, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{143, 142, 149, 146, 99, 94, 89, 84, 0, 0, 0, 0, 0}, 
+{57, 52, 47, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{133, 134, 135, 36, 31, 26, 21, 0, 0, 0, 0, 0, 0}, 
+{141, 80, 75, 70, 65, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{136, 130, 128, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{140, 78, 72, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{58, 54, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{156, 153, 120, 115, 110, 105, 0, 0, 0, 0, 0, 0, 0}, 
+{146, 147, 76, 71, 66, 61, 0, 0, 0, 0, 0, 0, 0}, 
+{148, 157, 130, 127, 38, 33, 28, 23, 0, 0, 0, 0, 0}, 
+{98, 93, 88, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{155, 151, 117, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{97, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{149, 139, 79, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{99, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{145, 156, 153, 120, 115, 110, 105, 0, 0, 0, 0, 0, 0}, 
+{147, 76, 71, 66, 61, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{149, 142, 143, 144, 57, 52, 47, 42, 0, 0, 0, 0, 0}, 
+{99, 94, 89, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{148, 154, 126, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{98, 92, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{150, 78, 74, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{146, 145, 156, 153, 120, 115, 110, 105, 0, 0, 0, 0, 0}, 
+{76, 71, 66, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{150, 139, 140, 141, 56, 51, 46, 41, 0, 0, 0, 0, 0}, 
+{100, 95, 90, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{149, 157, 131, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{99, 93, 87, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{77, 73, 69, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{155, 152, 119, 114, 109, 104, 0, 0, 0, 0, 0, 0, 0}, 
+{149, 150, 77, 72, 67, 62, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 130, 127, 38, 33, 28, 23, 0, 0, 0, 0, 0, 0}, 
+{145, 98, 93, 88, 83, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{154, 126, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{156, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{142, 140, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{146, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{148, 155, 152, 119, 114, 109, 104, 0, 0, 0, 0, 0, 0}, 
+{150, 77, 72, 67, 62, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{142, 143, 144, 57, 52, 47, 42, 0, 0, 0, 0, 0, 0}, 
+{146, 99, 94, 89, 84, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 131, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{145, 97, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{139, 79, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{149, 148, 155, 152, 119, 114, 109, 104, 0, 0, 0, 0, 0}, 
+{77, 72, 67, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{139, 140, 141, 56, 51, 46, 41, 0, 0, 0, 0, 0, 0}, 
+{147, 100, 95, 90, 85, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{142, 136, 134, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{146, 98, 92, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{78, 74, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{126, 123, 20, 15, 10, 5, 0, 0, 0, 0, 0, 0, 0}, 
+{152, 153, 96, 91, 86, 81, 0, 0, 0, 0, 0, 0, 0}, 
+{154, 157, 136, 133, 58, 53, 48, 43, 0, 0, 0, 0, 0}, 
+{118, 113, 108, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{125, 121, 17, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{117, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{155, 145, 99, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{119, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{151, 126, 123, 20, 15, 10, 5, 0, 0, 0, 0, 0, 0}, 
+{153, 96, 91, 86, 81, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{155, 148, 149, 150, 77, 72, 67, 62, 0, 0, 0, 0, 0}, 
+{119, 114, 109, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{154, 124, 132, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{118, 112, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{156, 98, 94, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{152, 151, 126, 123, 20, 15, 10, 5, 0, 0, 0, 0, 0}, 
+{96, 91, 86, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{156, 145, 146, 147, 76, 71, 66, 61, 0, 0, 0, 0, 0}, 
+{120, 115, 110, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{155, 157, 137, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{119, 113, 107, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{97, 93, 89, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{125, 122, 19, 14, 9, 4, 0, 0, 0, 0, 0, 0, 0}, 
+{155, 156, 97, 92, 87, 82, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 136, 133, 58, 53, 48, 43, 0, 0, 0, 0, 0, 0}, 
+{151, 118, 113, 108, 103, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{124, 132, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{126, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{148, 146, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{152, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{154, 125, 122, 19, 14, 9, 4, 0, 0, 0, 0, 0, 0}, 
+{156, 97, 92, 87, 82, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{148, 149, 150, 77, 72, 67, 62, 0, 0, 0, 0, 0, 0}, 
+{152, 119, 114, 109, 104, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{157, 137, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{151, 117, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{145, 99, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}, 
+{{155, 154, 125, 122, 19, 14, 9, 4, 0, 0, 0, 0, 0}, 
+{97, 92, 87, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{145, 146, 147, 76, 71, 66, 61, 0, 0, 0, 0, 0, 0}, 
+{153, 120, 115, 110, 105, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{148, 142, 140, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{152, 118, 112, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{98, 94, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}};
+
+// The lines out of the vortex. The first 6 go OUT through each adjacent square, the last 6 go OUT_ANTICLOCKWISE through
+// each diagonal square
+const BoardIndex PositionUtils::tableVortexRays[PositionUtils::NUM_VORTEX_RAYS][PositionUtils::MAX_RAY_LENGTH + 1] =
+{{124, 121, 18, 13, 8, 3, 0, 0, 0, 0, 0, 0, 0}, 
+{130, 127, 38, 33, 28, 23, 0, 0, 0, 0, 0, 0, 0}, 
+{136, 133, 58, 53, 48, 43, 0, 0, 0, 0, 0, 0, 0}, 
+{142, 139, 78, 73, 68, 63, 0, 0, 0, 0, 0, 0, 0}, 
+{148, 145, 98, 93, 88, 83, 0, 0, 0, 0, 0, 0, 0}, 
+{154, 151, 118, 113, 108, 103, 0, 0, 0, 0, 0, 0, 0}, 
+{125, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{131, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{137, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{143, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{149, 147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 
+{155, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+
+// Given a position (including the vortex), the squares around it
+// Each row is the number of squares, followed by the squares themselves, padded with 0s
+const BoardIndex PositionUtils::tablePositionToAdjacentSquares[PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER - 1][PositionUtils::MAX_ADJACENT_SQUARES + 1] = {
+        {2, 2, 6, 0, 0, 0, 0},
+        {3, 1, 3, 7, 0, 0, 0},
+        {3, 2, 4, 8, 0, 0, 0},
+        {3, 3, 5, 9, 0, 0, 0},
+        {2, 4, 10, 0, 0, 0, 0},
+        {3, 7, 11, 1, 0, 0, 0},
+        {4, 6, 8, 12, 2, 0, 0},
+        {4, 7, 9, 13, 3, 0, 0},
+        {4, 8, 10, 14, 4, 0, 0},
+        {3, 9, 15, 5, 0, 0, 0},
+        {3, 12, 16, 6, 0, 0, 0},
+        {4, 11, 13, 17, 7, 0, 0},
+        {4, 12, 14, 18, 8, 0, 0},
+        {4, 13, 15, 19, 9, 0, 0},
+        {3, 14, 20, 10, 0, 0, 0},
+        {3, 17, 129, 11, 0, 0, 0},
+        {4, 16, 18, 132, 12, 0, 0},
+        {4, 17, 19, 121, 13, 0, 0},
+        {4, 18, 20, 122, 14, 0, 0},
+        {3, 19, 123, 15, 0, 0, 0},
+        {2, 22, 26, 0, 0, 0, 0},
+        {3, 21, 23, 27, 0, 0, 0},
+        {3, 22, 24, 28, 0, 0, 0},
+        {3, 23, 25, 29, 0, 0, 0},
+        {2, 24, 30, 0, 0, 0, 0},
+        {3, 27, 31, 21, 0, 0, 0},
+        {4, 26, 28, 32, 22, 0, 0},
+        {4, 27, 29, 33, 23, 0, 0},
+        {4, 28, 30, 34, 24, 0, 0},
+        {3, 29, 35, 25, 0, 0, 0},
+        {3, 32, 36, 26, 0, 0, 0},
+        {4, 31, 33, 37, 27, 0, 0},
+        {4, 32, 34, 38, 28, 0, 0},
+        {4, 33, 35, 39, 29, 0, 0},
+        {3, 34, 40, 30, 0, 0, 0},
+        {3, 37, 135, 31, 0, 0, 0},
+        {4, 36, 38, 138, 32, 0, 0},
+        {4, 37, 39, 127, 33, 0, 0},
+        {4, 38, 40, 128, 34, 0, 0},
+        {3, 39, 129, 35, 0, 0, 0},
+        {2, 42, 46, 0, 0, 0, 0},
+        {3, 41, 43, 47, 0, 0, 0},
+        {3, 42, 44, 48, 0, 0, 0},
+        {3, 43, 45, 49, 0, 0, 0},
+        {2, 44, 50, 0, 0, 0, 0},
+        {3, 47, 51, 41, 0, 0, 0},
+        {4, 46, 48, 52, 42, 0, 0},
+        {4, 47, 49, 53, 43, 0, 0},
+        {4, 48, 50, 54, 44, 0, 0},
+        {3, 49, 55, 45, 0, 0, 0},
+        {3, 52, 56, 46, 0, 0, 0},
+        {4, 51, 53, 57, 47, 0, 0},
+        {4, 52, 54, 58, 48, 0, 0},
+        {4, 53, 55, 59, 49, 0, 0},
+        {3, 54, 60, 50, 0, 0, 0},
+        {3, 57, 141, 51, 0, 0, 0},
+        {4, 56, 58, 144, 52, 0, 0},
+        {4, 57, 59, 133, 53, 0, 0},
+        {4, 58, 60, 134, 54, 0, 0},
+        {3, 59, 135, 55, 0, 0, 0},
+        {2, 62, 66, 0, 0, 0, 0},
+        {3, 61, 63, 67, 0, 0, 0},
+        {3, 62, 64, 68, 0, 0, 0},
+        {3, 63, 65, 69, 0, 0, 0},
+        {2, 64, 70, 0, 0, 0, 0},
+        {3, 67, 71, 61, 0, 0, 0},
+        {4, 66, 68, 72, 62, 0, 0},
+        {4, 67, 69, 73, 63, 0, 0},
+        {4, 68, 70, 74, 64, 0, 0},
+        {3, 69, 75, 65, 0, 0, 0},
+        {3, 72, 76, 66, 0, 0, 0},
+        {4, 71, 73, 77, 67, 0, 0},
+        {4, 72, 74, 78, 68, 0, 0},
+        {4, 73, 75, 79, 69, 0, 0},
+        {3, 74, 80, 70, 0, 0, 0},
+        {3, 77, 147, 71, 0, 0, 0},
+        {4, 76, 78, 150, 72, 0, 0},
+        {4, 77, 79, 139, 73, 0, 0},
+        {4, 78, 80, 140, 74, 0, 0},
+        {3, 79, 141, 75, 0, 0, 0},
+        {2, 82, 86, 0, 0, 0, 0},
+        {3, 81, 83, 87, 0, 0, 0},
+        {3, 82, 84, 88, 0, 0, 0},
+        {3, 83, 85, 89, 0, 0, 0},
+        {2, 84, 90, 0, 0, 0, 0},
+        {3, 87, 91, 81, 0, 0, 0},
+        {4, 86, 88, 92, 82, 0, 0},
+        {4, 87, 89, 93, 83, 0, 0},
+        {4, 88, 90, 94, 84, 0, 0},
+        {3, 89, 95, 85, 0, 0, 0},
+        {3, 92, 96, 86, 0, 0, 0},
+        {4, 91, 93, 97, 87, 0, 0},
+        {4, 92, 94, 98, 88, 0, 0},
+        {4, 93, 95, 99, 89, 0, 0},
+        {3, 94, 100, 90, 0, 0, 0},
+        {3, 97, 153, 91, 0, 0, 0},
+        {4, 96, 98, 156, 92, 0, 0},
+        {4, 97, 99, 145, 93, 0, 0},
+        {4, 98, 100, 146, 94, 0, 0},
+        {3, 99, 147, 95, 0, 0, 0},
+        {2, 102, 106, 0, 0, 0, 0},
+        {3, 101, 103, 107, 0, 0, 0},
+        {3, 102, 104, 108, 0, 0, 0},
+        {3, 103, 105, 109, 0, 0, 0},
+        {2, 104, 110, 0, 0, 0, 0},
+        {3, 107, 111, 101, 0, 0, 0},
+        {4, 106, 108, 112, 102, 0, 0},
+        {4, 107, 109, 113, 103, 0, 0},
+        {4, 108, 110, 114, 104, 0, 0},
+        {3, 109, 115, 105, 0, 0, 0},
+        {3, 112, 116, 106, 0, 0, 0},
+        {4, 111, 113, 117, 107, 0, 0},
+        {4, 112, 114, 118, 108, 0, 0},
+        {4, 113, 115, 119, 109, 0, 0},
+        {3, 114, 120, 110, 0, 0, 0},
+        {3, 117, 123, 111, 0, 0, 0},
+        {4, 116, 118, 126, 112, 0, 0},
+        {4, 117, 119, 151, 113, 0, 0},
+        {4, 118, 120, 152, 114, 0, 0},
+        {3, 119, 153, 115, 0, 0, 0},
+        {4, 132, 122, 124, 18, 0, 0},
+        {4, 121, 123, 125, 19, 0, 0},
+        {4, 122, 116, 126, 20, 0, 0},
+        {4, 131, 125, 157, 121, 0, 0},
+        {4, 124, 126, 154, 122, 0, 0},
+        {4, 125, 117, 151, 123, 0, 0},
+        {4, 138, 128, 130, 38, 0, 0},
+        {4, 127, 129, 131, 39, 0, 0},
+        {4, 128, 16, 132, 40, 0, 0},
+        {4, 137, 131, 157, 127, 0, 0},
+        {4, 130, 132, 124, 128, 0, 0},
+        {4, 131, 17, 121, 129, 0, 0},
+        {4, 144, 134, 136, 58, 0, 0},
+        {4, 133, 135, 137, 59, 0, 0},
+        {4, 134, 36, 138, 60, 0, 0},
+        {4, 143, 137, 157, 133, 0, 0},
+        {4, 136, 138, 130, 134, 0, 0},
+        {4, 137, 37, 127, 135, 0, 0},
+        {4, 150, 140, 142, 78, 0, 0},
+        {4, 139, 141, 143, 79, 0, 0},
+        {4, 140, 56, 144, 80, 0, 0},
+        {4, 149, 143, 157, 139, 0, 0},
+        {4, 142, 144, 136, 140, 0, 0},
+        {4, 143, 57, 133, 141, 0, 0},
+        {4, 156, 146, 148, 98, 0, 0},
+        {4, 145, 147, 149, 99, 0, 0},
+        {4, 146, 76, 150, 100, 0, 0},
+        {4, 155, 149, 157, 145, 0, 0},
+        {4, 148, 150, 142, 146, 0, 0},
+        {4, 149, 77, 139, 147, 0, 0},
+        {4, 126, 152, 154, 118, 0, 0},
+        {4, 151, 153, 155, 119, 0, 0},
+        {4, 152, 96, 156, 120, 0, 0},
+        {4, 125, 155, 157, 151, 0, 0},
+        {4, 154, 156, 148, 152, 0, 0},
+        {4, 155, 97, 145, 153, 0, 0},
+        {6, 124, 130, 136, 142, 148, 154}
+};
+
+const BoardIndex PositionUtils::tablePositionToDiagonalSquares[PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER - 1][PositionUtils::MAX_DIAGONAL_SQUARES + 1] = {
+        {1, 7, 0, 0, 0, 0, 0},
+        {2, 6, 8, 0, 0, 0, 0},
+        {2, 7, 9, 0, 0, 0, 0},
+        {2, 8, 10, 0, 0, 0, 0},
+        {1, 9, 0, 0, 0, 0, 0},
+        {2, 12, 2, 0, 0, 0, 0},
+        {4, 11, 1, 13, 3, 0, 0},
+        {4, 12, 2, 14, 4, 0, 0},
+        {4, 13, 3, 15, 5, 0, 0},
+        {2, 14, 4, 0, 0, 0, 0},
+        {2, 17, 7, 0, 0, 0, 0},
+        {4, 16, 6, 18, 8, 0, 0},
+        {4, 17, 7, 19, 9, 0, 0},
+        {4, 18, 8, 20, 10, 0, 0},
+        {2, 19, 9, 0, 0, 0, 0},
+        {3, 40, 132, 12, 0, 0, 0},
+        {4, 129, 11, 121, 13, 0, 0},
+        {4, 132, 12, 122, 14, 0, 0},
+        {4, 121, 13, 123, 15, 0, 0},
+        {3, 122, 14, 116, 0, 0, 0},
+        {1, 27, 0, 0, 0, 0, 0},
+        {2, 26, 28, 0, 0, 0, 0},
+        {2, 27, 29, 0, 0, 0, 0},
+        {2, 28, 30, 0, 0, 0, 0},
+        {1, 29, 0, 0, 0, 0, 0},
+        {2, 32, 22, 0, 0, 0, 0},
+        {4, 31, 21, 33, 23, 0, 0},
+        {4, 32, 22, 34, 24, 0, 0},
+        {4, 33, 23, 35, 25, 0, 0},
+        {2, 34, 24, 0, 0, 0, 0},
+        {2, 37, 27, 0, 0, 0, 0},
+        {4, 36, 26, 38, 28, 0, 0},
+        {4, 37, 27, 39, 29, 0, 0},
+        {4, 38, 28, 40, 30, 0, 0},
+        {2, 39, 29, 0, 0, 0, 0},
+        {3, 60, 138, 32, 0, 0, 0},
+        {4, 135, 31, 127, 33, 0, 0},
+        {4, 138, 32, 128, 34, 0, 0},
+        {4, 127, 33, 129, 35, 0, 0},
+        {3, 128, 34, 16, 0, 0, 0},
+        {1, 47, 0, 0, 0, 0, 0},
+        {2, 46, 48, 0, 0, 0, 0},
+        {2, 47, 49, 0, 0, 0, 0},
+        {2, 48, 50, 0, 0, 0, 0},
+        {1, 49, 0, 0, 0, 0, 0},
+        {2, 52, 42, 0, 0, 0, 0},
+        {4, 51, 41, 53, 43, 0, 0},
+        {4, 52, 42, 54, 44, 0, 0},
+        {4, 53, 43, 55, 45, 0, 0},
+        {2, 54, 44, 0, 0, 0, 0},
+        {2, 57, 47, 0, 0, 0, 0},
+        {4, 56, 46, 58, 48, 0, 0},
+        {4, 57, 47, 59, 49, 0, 0},
+        {4, 58, 48, 60, 50, 0, 0},
+        {2, 59, 49, 0, 0, 0, 0},
+        {3, 80, 144, 52, 0, 0, 0},
+        {4, 141, 51, 133, 53, 0, 0},
+        {4, 144, 52, 134, 54, 0, 0},
+        {4, 133, 53, 135, 55, 0, 0},
+        {3, 134, 54, 36, 0, 0, 0},
+        {1, 67, 0, 0, 0, 0, 0},
+        {2, 66, 68, 0, 0, 0, 0},
+        {2, 67, 69, 0, 0, 0, 0},
+        {2, 68, 70, 0, 0, 0, 0},
+        {1, 69, 0, 0, 0, 0, 0},
+        {2, 72, 62, 0, 0, 0, 0},
+        {4, 71, 61, 73, 63, 0, 0},
+        {4, 72, 62, 74, 64, 0, 0},
+        {4, 73, 63, 75, 65, 0, 0},
+        {2, 74, 64, 0, 0, 0, 0},
+        {2, 77, 67, 0, 0, 0, 0},
+        {4, 76, 66, 78, 68, 0, 0},
+        {4, 77, 67, 79, 69, 0, 0},
+        {4, 78, 68, 80, 70, 0, 0},
+        {2, 79, 69, 0, 0, 0, 0},
+        {3, 100, 150, 72, 0, 0, 0},
+        {4, 147, 71, 139, 73, 0, 0},
+        {4, 150, 72, 140, 74, 0, 0},
+        {4, 139, 73, 141, 75, 0, 0},
+        {3, 140, 74, 56, 0, 0, 0},
+        {1, 87, 0, 0, 0, 0, 0},
+        {2, 86, 88, 0, 0, 0, 0},
+        {2, 87, 89, 0, 0, 0, 0},
+        {2, 88, 90, 0, 0, 0, 0},
+        {1, 89, 0, 0, 0, 0, 0},
+        {2, 92, 82, 0, 0, 0, 0},
+        {4, 91, 81, 93, 83, 0, 0},
+        {4, 92, 82, 94, 84, 0, 0},
+        {4, 93, 83, 95, 85, 0, 0},
+        {2, 94, 84, 0, 0, 0, 0},
+        {2, 97, 87, 0, 0, 0, 0},
+        {4, 96, 86, 98, 88, 0, 0},
+        {4, 97, 87, 99, 89, 0, 0},
+        {4, 98, 88, 100, 90, 0, 0},
+        {2, 99, 89, 0, 0, 0, 0},
+        {3, 120, 156, 92, 0, 0, 0},
+        {4, 153, 91, 145, 93, 0, 0},
+        {4, 156, 92, 146, 94, 0, 0},
+        {4, 145, 93, 147, 95, 0, 0},
+        {3, 146, 94, 76, 0, 0, 0},
+        {1, 107, 0, 0, 0, 0, 0},
+        {2, 106, 108, 0, 0, 0, 0},
+        {2, 107, 109, 0, 0, 0, 0},
+        {2, 108, 110, 0, 0, 0, 0},
+        {1, 109, 0, 0, 0, 0, 0},
+        {2, 112, 102, 0, 0, 0, 0},
+        {4, 111, 101, 113, 103, 0, 0},
+        {4, 112, 102, 114, 104, 0, 0},
+        {4, 113, 103, 115, 105, 0, 0},
+        {2, 114, 104, 0, 0, 0, 0},
+        {2, 117, 107, 0, 0, 0, 0},
+        {4, 116, 106, 118, 108, 0, 0},
+        {4, 117, 107, 119, 109, 0, 0},
+        {4, 118, 108, 120, 110, 0, 0},
+        {2, 119, 109, 0, 0, 0, 0},
+        {3, 20, 126, 112, 0, 0, 0},
+        {4, 123, 111, 151, 113, 0, 0},
+        {4, 126, 112, 152, 114, 0, 0},
+        {4, 151, 113, 153, 115, 0, 0},
+        {3, 152, 114, 96, 0, 0, 0},
+        {4, 131, 17, 125, 19, 0, 0},
+        {4, 124, 18, 126, 20, 0, 0},
+        {3, 125, 19, 117, 0, 0, 0},
+        {4, 130, 132, 154, 122, 0, 0},
+        {4, 157, 121, 151, 123, 0, 0},
+        {4, 154, 122, 118, 116, 0, 0},
+        {4, 137, 37, 131, 39, 0, 0},
+        {4, 130, 38, 132, 40, 0, 0},
+        {3, 131, 39, 17, 0, 0, 0},
+        {4, 136, 138, 124, 128, 0, 0},
+        {4, 157, 127, 121, 129, 0, 0},
+        {4, 124, 128, 18, 16, 0, 0},
+        {4, 143, 57, 137, 59, 0, 0},
+        {4, 136, 58, 138, 60, 0, 0},
+        {3, 137, 59, 37, 0, 0, 0},
+        {4, 142, 144, 130, 134, 0, 0},
+        {4, 157, 133, 127, 135, 0, 0},
+        {4, 130, 134, 38, 36, 0, 0},
+        {4, 149, 77, 143, 79, 0, 0},
+        {4, 142, 78, 144, 80, 0, 0},
+        {3, 143, 79, 57, 0, 0, 0},
+        {4, 148, 150, 136, 140, 0, 0},
+        {4, 157, 139, 133, 141, 0, 0},
+        {4, 136, 140, 58, 56, 0, 0},
+        {4, 155, 97, 149, 99, 0, 0},
+        {4, 148, 98, 150, 100, 0, 0},
+        {3, 149, 99, 77, 0, 0, 0},
+        {4, 154, 156, 142, 146, 0, 0},
+        {4, 157, 145, 139, 147, 0, 0},
+        {4, 142, 146, 78, 76, 0, 0},
+        {4, 125, 117, 155, 119, 0, 0},
+        {4, 154, 118, 156, 120, 0, 0},
+        {3, 155, 119, 97, 0, 0, 0},
+        {4, 124, 126, 148, 152, 0, 0},
+        {4, 157, 151, 145, 153, 0, 0},
+        {4, 148, 152, 98, 96, 0, 0},
+        {6, 125, 131, 137, 143, 149, 155}
+};
+
+const BoardIndex PositionUtils::tablePositionToAdjacentAndDiagonalSquares[PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER - 1][PositionUtils::MAX_ADJACENT_AND_DIAGONAL_SQUARES + 1] = {
+        {3, 2, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 1, 3, 7, 6, 8, 0, 0, 0, 0, 0, 0, 0},
+        {5, 2, 4, 8, 7, 9, 0, 0, 0, 0, 0, 0, 0},
+        {5, 3, 5, 9, 8, 10, 0, 0, 0, 0, 0, 0, 0},
+        {3, 4, 10, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 7, 11, 1, 12, 2, 0, 0, 0, 0, 0, 0, 0},
+        {8, 6, 8, 12, 2, 11, 1, 13, 3, 0, 0, 0, 0},
+        {8, 7, 9, 13, 3, 12, 2, 14, 4, 0, 0, 0, 0},
+        {8, 8, 10, 14, 4, 13, 3, 15, 5, 0, 0, 0, 0},
+        {5, 9, 15, 5, 14, 4, 0, 0, 0, 0, 0, 0, 0},
+        {5, 12, 16, 6, 17, 7, 0, 0, 0, 0, 0, 0, 0},
+        {8, 11, 13, 17, 7, 16, 6, 18, 8, 0, 0, 0, 0},
+        {8, 12, 14, 18, 8, 17, 7, 19, 9, 0, 0, 0, 0},
+        {8, 13, 15, 19, 9, 18, 8, 20, 10, 0, 0, 0, 0},
+        {5, 14, 20, 10, 19, 9, 0, 0, 0, 0, 0, 0, 0},
+        {6, 17, 129, 11, 40, 132, 12, 0, 0, 0, 0, 0, 0},
+        {8, 16, 18, 132, 12, 129, 11, 121, 13, 0, 0, 0, 0},
+        {8, 17, 19, 121, 13, 132, 12, 122, 14, 0, 0, 0, 0},
+        {8, 18, 20, 122, 14, 121, 13, 123, 15, 0, 0, 0, 0},
+        {6, 19, 123, 15, 122, 14, 116, 0, 0, 0, 0, 0, 0},
+        {3, 22, 26, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 21, 23, 27, 26, 28, 0, 0, 0, 0, 0, 0, 0},
+        {5, 22, 24, 28, 27, 29, 0, 0, 0, 0, 0, 0, 0},
+        {5, 23, 25, 29, 28, 30, 0, 0, 0, 0, 0, 0, 0},
+        {3, 24, 30, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 27, 31, 21, 32, 22, 0, 0, 0, 0, 0, 0, 0},
+        {8, 26, 28, 32, 22, 31, 21, 33, 23, 0, 0, 0, 0},
+        {8, 27, 29, 33, 23, 32, 22, 34, 24, 0, 0, 0, 0},
+        {8, 28, 30, 34, 24, 33, 23, 35, 25, 0, 0, 0, 0},
+        {5, 29, 35, 25, 34, 24, 0, 0, 0, 0, 0, 0, 0},
+        {5, 32, 36, 26, 37, 27, 0, 0, 0, 0, 0, 0, 0},
+        {8, 31, 33, 37, 27, 36, 26, 38, 28, 0, 0, 0, 0},
+        {8, 32, 34, 38, 28, 37, 27, 39, 29, 0, 0, 0, 0},
+        {8, 33, 35, 39, 29, 38, 28, 40, 30, 0, 0, 0, 0},
+        {5, 34, 40, 30, 39, 29, 0, 0, 0, 0, 0, 0, 0},
+        {6, 37, 135, 31, 60, 138, 32, 0, 0, 0, 0, 0, 0},
+        {8, 36, 38, 138, 32, 135, 31, 127, 33, 0, 0, 0, 0},
+        {8, 37, 39, 127, 33, 138, 32, 128, 34, 0, 0, 0, 0},
+        {8, 38, 40, 128, 34, 127, 33, 129, 35, 0, 0, 0, 0},
+        {6, 39, 129, 35, 128, 34, 16, 0, 0, 0, 0, 0, 0},
+        {3, 42, 46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 41, 43, 47, 46, 48, 0, 0, 0, 0, 0, 0, 0},
+        {5, 42, 44, 48, 47, 49, 0, 0, 0, 0, 0, 0, 0},
+        {5, 43, 45, 49, 48, 50, 0, 0, 0, 0, 0, 0, 0},
+        {3, 44, 50, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 47, 51, 41, 52, 42, 0, 0, 0, 0, 0, 0, 0},
+        {8, 46, 48, 52, 42, 51, 41, 53, 43, 0, 0, 0, 0},
+        {8, 47, 49, 53, 43, 52, 42, 54, 44, 0, 0, 0, 0},
+        {8, 48, 50, 54, 44, 53, 43, 55, 45, 0, 0, 0, 0},
+        {5, 49, 55, 45, 54, 44, 0, 0, 0, 0, 0, 0, 0},
+        {5, 52, 56, 46, 57, 47, 0, 0, 0, 0, 0, 0, 0},
+        {8, 51, 53, 57, 47, 56, 46, 58, 48, 0, 0, 0, 0},
+        {8, 52, 54, 58, 48, 57, 47, 59, 49, 0, 0, 0, 0},
+        {8, 53, 55, 59, 49, 58, 48, 60, 50, 0, 0, 0, 0},
+        {5, 54, 60, 50, 59, 49, 0, 0, 0, 0, 0, 0, 0},
+        {6, 57, 141, 51, 80, 144, 52, 0, 0, 0, 0, 0, 0},
+        {8, 56, 58, 144, 52, 141, 51, 133, 53, 0, 0, 0, 0},
+        {8, 57, 59, 133, 53, 144, 52, 134, 54, 0, 0, 0, 0},
+        {8, 58, 60, 134, 54, 133, 53, 135, 55, 0, 0, 0, 0},
+        {6, 59, 135, 55, 134, 54, 36, 0, 0, 0, 0, 0, 0},
+        {3, 62, 66, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 61, 63, 67, 66, 68, 0, 0, 0, 0, 0, 0, 0},
+        {5, 62, 64, 68, 67, 69, 0, 0, 0, 0, 0, 0, 0},
+        {5, 63, 65, 69, 68, 70, 0, 0, 0, 0, 0, 0, 0},
+        {3, 64, 70, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 67, 71, 61, 72, 62, 0, 0, 0, 0, 0, 0, 0},
+        {8, 66, 68, 72, 62, 71, 61, 73, 63, 0, 0, 0, 0},
+        {8, 67, 69, 73, 63, 72, 62, 74, 64, 0, 0, 0, 0},
+        {8, 68, 70, 74, 64, 73, 63, 75, 65, 0, 0, 0, 0},
+        {5, 69, 75, 65, 74, 64, 0, 0, 0, 0, 0, 0, 0},
+        {5, 72, 76, 66, 77, 67, 0, 0, 0, 0, 0, 0, 0},
+        {8, 71, 73, 77, 67, 76, 66, 78, 68, 0, 0, 0, 0},
+        {8, 72, 74, 78, 68, 77, 67, 79, 69, 0, 0, 0, 0},
+        {8, 73, 75, 79, 69, 78, 68, 80, 70, 0, 0, 0, 0},
+        {5, 74, 80, 70, 79, 69, 0, 0, 0, 0, 0, 0, 0},
+        {6, 77, 147, 71, 100, 150, 72, 0, 0, 0, 0, 0, 0},
+        {8, 76, 78, 150, 72, 147, 71, 139, 73, 0, 0, 0, 0},
+        {8, 77, 79, 139, 73, 150, 72, 140, 74, 0, 0, 0, 0},
+        {8, 78, 80, 140, 74, 139, 73, 141, 75, 0, 0, 0, 0},
+        {6, 79, 141, 75, 140, 74, 56, 0, 0, 0, 0, 0, 0},
+        {3, 82, 86, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 81, 83, 87, 86, 88, 0, 0, 0, 0, 0, 0, 0},
+        {5, 82, 84, 88, 87, 89, 0, 0, 0, 0, 0, 0, 0},
+        {5, 83, 85, 89, 88, 90, 0, 0, 0, 0, 0, 0, 0},
+        {3, 84, 90, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 87, 91, 81, 92, 82, 0, 0, 0, 0, 0, 0, 0},
+        {8, 86, 88, 92, 82, 91, 81, 93, 83, 0, 0, 0, 0},
+        {8, 87, 89, 93, 83, 92, 82, 94, 84, 0, 0, 0, 0},
+        {8, 88, 90, 94, 84, 93, 83, 95, 85, 0, 0, 0, 0},
+        {5, 89, 95, 85, 94, 84, 0, 0, 0, 0, 0, 0, 0},
+        {5, 92, 96, 86, 97, 87, 0, 0, 0, 0, 0, 0, 0},
+        {8, 91, 93, 97, 87, 96, 86, 98, 88, 0, 0, 0, 0},
+        {8, 92, 94, 98, 88, 97, 87, 99, 89, 0, 0, 0, 0},
+        {8, 93, 95, 99, 89, 98, 88, 100, 90, 0, 0, 0, 0},
+        {5, 94, 100, 90, 99, 89, 0, 0, 0, 0, 0, 0, 0},
+        {6, 97, 153, 91, 120, 156, 92, 0, 0, 0, 0, 0, 0},
+        {8, 96, 98, 156, 92, 153, 91, 145, 93, 0, 0, 0, 0},
+        {8, 97, 99, 145, 93, 156, 92, 146, 94, 0, 0, 0, 0},
+        {8, 98, 100, 146, 94, 145, 93, 147, 95, 0, 0, 0, 0},
+        {6, 99, 147, 95, 146, 94, 76, 0, 0, 0, 0, 0, 0},
+        {3, 102, 106, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 101, 103, 107, 106, 108, 0, 0, 0, 0, 0, 0, 0},
+        {5, 102, 104, 108, 107, 109, 0, 0, 0, 0, 0, 0, 0},
+        {5, 103, 105, 109, 108, 110, 0, 0, 0, 0, 0, 0, 0},
+        {3, 104, 110, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 107, 111, 101, 112, 102, 0, 0, 0, 0, 0, 0, 0},
+        {8, 106, 108, 112, 102, 111, 101, 113, 103, 0, 0, 0, 0},
+        {8, 107, 109, 113, 103, 112, 102, 114, 104, 0, 0, 0, 0},
+        {8, 108, 110, 114, 104, 113, 103, 115, 105, 0, 0, 0, 0},
+        {5, 109, 115, 105, 114, 104, 0, 0, 0, 0, 0, 0, 0},
+        {5, 112, 116, 106, 117, 107, 0, 0, 0, 0, 0, 0, 0},
+        {8, 111, 113, 117, 107, 116, 106, 118, 108, 0, 0, 0, 0},
+        {8, 112, 114, 118, 108, 117, 107, 119, 109, 0, 0, 0, 0},
+        {8, 113, 115, 119, 109, 118, 108, 120, 110, 0, 0, 0, 0},
+        {5, 114, 120, 110, 119, 109, 0, 0, 0, 0, 0, 0, 0},
+        {6, 117, 123, 111, 20, 126, 112, 0, 0, 0, 0, 0, 0},
+        {8, 116, 118, 126, 112, 123, 111, 151, 113, 0, 0, 0, 0},
+        {8, 117, 119, 151, 113, 126, 112, 152, 114, 0, 0, 0, 0},
+        {8, 118, 120, 152, 114, 151, 113, 153, 115, 0, 0, 0, 0},
+        {6, 119, 153, 115, 152, 114, 96, 0, 0, 0, 0, 0, 0},
+        {8, 132, 122, 124, 18, 131, 17, 125, 19, 0, 0, 0, 0},
+        {8, 121, 123, 125, 19, 124, 18, 126, 20, 0, 0, 0, 0},
+        {7, 122, 116, 126, 20, 125, 19, 117, 0, 0, 0, 0, 0},
+        {8, 131, 125, 157, 121, 130, 132, 154, 122, 0, 0, 0, 0},
+        {8, 124, 126, 154, 122, 157, 121, 151, 123, 0, 0, 0, 0},
+        {8, 125, 117, 151, 123, 154, 122, 118, 116, 0, 0, 0, 0},
+        {8, 138, 128, 130, 38, 137, 37, 131, 39, 0, 0, 0, 0},
+        {8, 127, 129, 131, 39, 130, 38, 132, 40, 0, 0, 0, 0},
+        {7, 128, 16, 132, 40, 131, 39, 17, 0, 0, 0, 0, 0},
+        {8, 137, 131, 157, 127, 136, 138, 124, 128, 0, 0, 0, 0},
+        {8, 130, 132, 124, 128, 157, 127, 121, 129, 0, 0, 0, 0},
+        {8, 131, 17, 121, 129, 124, 128, 18, 16, 0, 0, 0, 0},
+        {8, 144, 134, 136, 58, 143, 57, 137, 59, 0, 0, 0, 0},
+        {8, 133, 135, 137, 59, 136, 58, 138, 60, 0, 0, 0, 0},
+        {7, 134, 36, 138, 60, 137, 59, 37, 0, 0, 0, 0, 0},
+        {8, 143, 137, 157, 133, 142, 144, 130, 134, 0, 0, 0, 0},
+        {8, 136, 138, 130, 134, 157, 133, 127, 135, 0, 0, 0, 0},
+        {8, 137, 37, 127, 135, 130, 134, 38, 36, 0, 0, 0, 0},
+        {8, 150, 140, 142, 78, 149, 77, 143, 79, 0, 0, 0, 0},
+        {8, 139, 141, 143, 79, 142, 78, 144, 80, 0, 0, 0, 0},
+        {7, 140, 56, 144, 80, 143, 79, 57, 0, 0, 0, 0, 0},
+        {8, 149, 143, 157, 139, 148, 150, 136, 140, 0, 0, 0, 0},
+        {8, 142, 144, 136, 140, 157, 139, 133, 141, 0, 0, 0, 0},
+        {8, 143, 57, 133, 141, 136, 140, 58, 56, 0, 0, 0, 0},
+        {8, 156, 146, 148, 98, 155, 97, 149, 99, 0, 0, 0, 0},
+        {8, 145, 147, 149, 99, 148, 98, 150, 100, 0, 0, 0, 0},
+        {7, 146, 76, 150, 100, 149, 99, 77, 0, 0, 0, 0, 0},
+        {8, 155, 149, 157, 145, 154, 156, 142, 146, 0, 0, 0, 0},
+        {8, 148, 150, 142, 146, 157, 145, 139, 147, 0, 0, 0, 0},
+        {8, 149, 77, 139, 147, 142, 146, 78, 76, 0, 0, 0, 0},
+        {8, 126, 152, 154, 118, 125, 117, 155, 119, 0, 0, 0, 0},
+        {8, 151, 153, 155, 119, 154, 118, 156, 120, 0, 0, 0, 0},
+        {7, 152, 96, 156, 120, 155, 119, 97, 0, 0, 0, 0, 0},
+        {8, 125, 155, 157, 151, 124, 126, 148, 152, 0, 0, 0, 0},
+        {8, 154, 156, 148, 152, 157, 151, 145, 153, 0, 0, 0, 0},
+        {8, 155, 97, 145, 153, 148, 152, 98, 96, 0, 0, 0, 0},
+        {12, 124, 130, 136, 142, 148, 154, 125, 131, 137, 143, 149, 155}
+};
+
+const BoardIndex PositionUtils::tablePositionToKnightMoves[PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER - 1][PositionUtils::MAX_KNIGHT_MOVES + 1] = {
+        {2, 12, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 11, 13, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 12, 14, 6, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 13, 15, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 14, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 17, 13, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 16, 18, 14, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {6, 17, 19, 11, 1, 15, 5, 0, 0, 0, 0, 0, 0},
+        {4, 18, 20, 12, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 19, 13, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 2, 40, 132, 18, 8, 0, 0, 0, 0, 0, 0, 0},
+        {6, 1, 3, 129, 121, 19, 9, 0, 0, 0, 0, 0, 0},
+        {8, 2, 4, 132, 122, 16, 6, 20, 10, 0, 0, 0, 0},
+        {6, 3, 5, 121, 123, 17, 7, 0, 0, 0, 0, 0, 0},
+        {5, 4, 122, 116, 18, 8, 0, 0, 0, 0, 0, 0, 0},
+        {6, 7, 131, 39, 121, 13, 35, 0, 0, 0, 0, 0, 0},
+        {7, 6, 8, 124, 128, 40, 122, 14, 0, 0, 0, 0, 0},
+        {8, 7, 9, 131, 125, 129, 11, 123, 15, 0, 0, 0, 0},
+        {7, 8, 10, 124, 126, 132, 12, 116, 0, 0, 0, 0, 0},
+        {6, 9, 125, 117, 121, 13, 111, 0, 0, 0, 0, 0, 0},
+        {2, 32, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 31, 33, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 32, 34, 26, 30, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 33, 35, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 34, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 37, 33, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 36, 38, 34, 24, 0, 0, 0, 0, 0, 0, 0, 0},
+        {6, 37, 39, 31, 21, 35, 25, 0, 0, 0, 0, 0, 0},
+        {4, 38, 40, 32, 22, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 39, 33, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 22, 60, 138, 38, 28, 0, 0, 0, 0, 0, 0, 0},
+        {6, 21, 23, 135, 127, 39, 29, 0, 0, 0, 0, 0, 0},
+        {8, 22, 24, 138, 128, 36, 26, 40, 30, 0, 0, 0, 0},
+        {6, 23, 25, 127, 129, 37, 27, 0, 0, 0, 0, 0, 0},
+        {5, 24, 128, 16, 38, 28, 0, 0, 0, 0, 0, 0, 0},
+        {6, 27, 137, 59, 127, 33, 55, 0, 0, 0, 0, 0, 0},
+        {7, 26, 28, 130, 134, 60, 128, 34, 0, 0, 0, 0, 0},
+        {8, 27, 29, 137, 131, 135, 31, 129, 35, 0, 0, 0, 0},
+        {7, 28, 30, 130, 132, 138, 32, 16, 0, 0, 0, 0, 0},
+        {6, 29, 131, 17, 127, 33, 11, 0, 0, 0, 0, 0, 0},
+        {2, 52, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 51, 53, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 52, 54, 46, 50, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 53, 55, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 54, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 57, 53, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 56, 58, 54, 44, 0, 0, 0, 0, 0, 0, 0, 0},
+        {6, 57, 59, 51, 41, 55, 45, 0, 0, 0, 0, 0, 0},
+        {4, 58, 60, 52, 42, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 59, 53, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 42, 80, 144, 58, 48, 0, 0, 0, 0, 0, 0, 0},
+        {6, 41, 43, 141, 133, 59, 49, 0, 0, 0, 0, 0, 0},
+        {8, 42, 44, 144, 134, 56, 46, 60, 50, 0, 0, 0, 0},
+        {6, 43, 45, 133, 135, 57, 47, 0, 0, 0, 0, 0, 0},
+        {5, 44, 134, 36, 58, 48, 0, 0, 0, 0, 0, 0, 0},
+        {6, 47, 143, 79, 133, 53, 75, 0, 0, 0, 0, 0, 0},
+        {7, 46, 48, 136, 140, 80, 134, 54, 0, 0, 0, 0, 0},
+        {8, 47, 49, 143, 137, 141, 51, 135, 55, 0, 0, 0, 0},
+        {7, 48, 50, 136, 138, 144, 52, 36, 0, 0, 0, 0, 0},
+        {6, 49, 137, 37, 133, 53, 31, 0, 0, 0, 0, 0, 0},
+        {2, 72, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 71, 73, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 72, 74, 66, 70, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 73, 75, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 74, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 77, 73, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 76, 78, 74, 64, 0, 0, 0, 0, 0, 0, 0, 0},
+        {6, 77, 79, 71, 61, 75, 65, 0, 0, 0, 0, 0, 0},
+        {4, 78, 80, 72, 62, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 79, 73, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 62, 100, 150, 78, 68, 0, 0, 0, 0, 0, 0, 0},
+        {6, 61, 63, 147, 139, 79, 69, 0, 0, 0, 0, 0, 0},
+        {8, 62, 64, 150, 140, 76, 66, 80, 70, 0, 0, 0, 0},
+        {6, 63, 65, 139, 141, 77, 67, 0, 0, 0, 0, 0, 0},
+        {5, 64, 140, 56, 78, 68, 0, 0, 0, 0, 0, 0, 0},
+        {6, 67, 149, 99, 139, 73, 95, 0, 0, 0, 0, 0, 0},
+        {7, 66, 68, 142, 146, 100, 140, 74, 0, 0, 0, 0, 0},
+        {8, 67, 69, 149, 143, 147, 71, 141, 75, 0, 0, 0, 0},
+        {7, 68, 70, 142, 144, 150, 72, 56, 0, 0, 0, 0, 0},
+        {6, 69, 143, 57, 139, 73, 51, 0, 0, 0, 0, 0, 0},
+        {2, 92, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 91, 93, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 92, 94, 86, 90, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 93, 95, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 94, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 97, 93, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 96, 98, 94, 84, 0, 0, 0, 0, 0, 0, 0, 0},
+        {6, 97, 99, 91, 81, 95, 85, 0, 0, 0, 0, 0, 0},
+        {4, 98, 100, 92, 82, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 99, 93, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 82, 120, 156, 98, 88, 0, 0, 0, 0, 0, 0, 0},
+        {6, 81, 83, 153, 145, 99, 89, 0, 0, 0, 0, 0, 0},
+        {8, 82, 84, 156, 146, 96, 86, 100, 90, 0, 0, 0, 0},
+        {6, 83, 85, 145, 147, 97, 87, 0, 0, 0, 0, 0, 0},
+        {5, 84, 146, 76, 98, 88, 0, 0, 0, 0, 0, 0, 0},
+        {6, 87, 155, 119, 145, 93, 115, 0, 0, 0, 0, 0, 0},
+        {7, 86, 88, 148, 152, 120, 146, 94, 0, 0, 0, 0, 0},
+        {8, 87, 89, 155, 149, 153, 91, 147, 95, 0, 0, 0, 0},
+        {7, 88, 90, 148, 150, 156, 92, 76, 0, 0, 0, 0, 0},
+        {6, 89, 149, 77, 145, 93, 71, 0, 0, 0, 0, 0, 0},
+        {2, 112, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 111, 113, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 112, 114, 106, 110, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 113, 115, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 114, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 117, 113, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {4, 116, 118, 114, 104, 0, 0, 0, 0, 0, 0, 0, 0},
+        {6, 117, 119, 111, 101, 115, 105, 0, 0, 0, 0, 0, 0},
+        {4, 118, 120, 112, 102, 0, 0, 0, 0, 0, 0, 0, 0},
+        {3, 119, 113, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {5, 102, 20, 126, 118, 108, 0, 0, 0, 0, 0, 0, 0},
+        {6, 101, 103, 123, 151, 119, 109, 0, 0, 0, 0, 0, 0},
+        {8, 102, 104, 126, 152, 116, 106, 120, 110, 0, 0, 0, 0},
+        {6, 103, 105, 151, 153, 117, 107, 0, 0, 0, 0, 0, 0},
+        {5, 104, 152, 96, 118, 108, 0, 0, 0, 0, 0, 0, 0},
+        {6, 107, 125, 19, 151, 113, 15, 0, 0, 0, 0, 0, 0},
+        {7, 106, 108, 154, 122, 20, 152, 114, 0, 0, 0, 0, 0},
+        {8, 107, 109, 125, 155, 123, 111, 153, 115, 0, 0, 0, 0},
+        {7, 108, 110, 154, 156, 126, 112, 96, 0, 0, 0, 0, 0},
+        {6, 109, 155, 97, 151, 113, 91, 0, 0, 0, 0, 0, 0},
+        {10, 12, 14, 130, 154, 128, 16, 126, 20, 148, 136, 0, 0},
+        {7, 13, 15, 157, 151, 131, 17, 117, 0, 0, 0, 0, 0},
+        {6, 14, 154, 118, 124, 18, 112, 0, 0, 0, 0, 0, 0},
+        {12, 17, 19, 137, 143, 149, 155, 127, 129, 151, 123, 145, 133},
+        {10, 18, 20, 148, 152, 130, 132, 118, 116, 136, 142, 0, 0},
+        {7, 19, 155, 119, 157, 121, 111, 113, 0, 0, 0, 0, 0},
+        {10, 32, 34, 136, 124, 134, 36, 132, 40, 154, 142, 0, 0},
+        {7, 33, 35, 157, 121, 137, 37, 17, 0, 0, 0, 0, 0},
+        {6, 34, 124, 18, 130, 38, 12, 0, 0, 0, 0, 0, 0},
+        {12, 37, 39, 125, 143, 149, 155, 133, 135, 121, 129, 151, 139},
+        {10, 38, 40, 154, 122, 136, 138, 18, 16, 142, 148, 0, 0},
+        {7, 39, 125, 19, 157, 127, 11, 13, 0, 0, 0, 0, 0},
+        {10, 52, 54, 142, 130, 140, 56, 138, 60, 124, 148, 0, 0},
+        {7, 53, 55, 157, 127, 143, 57, 37, 0, 0, 0, 0, 0},
+        {6, 54, 130, 38, 136, 58, 32, 0, 0, 0, 0, 0, 0},
+        {12, 57, 59, 125, 131, 149, 155, 139, 141, 127, 135, 121, 145},
+        {10, 58, 60, 124, 128, 142, 144, 38, 36, 148, 154, 0, 0},
+        {7, 59, 131, 39, 157, 133, 31, 33, 0, 0, 0, 0, 0},
+        {10, 72, 74, 148, 136, 146, 76, 144, 80, 130, 154, 0, 0},
+        {7, 73, 75, 157, 133, 149, 77, 57, 0, 0, 0, 0, 0},
+        {6, 74, 136, 58, 142, 78, 52, 0, 0, 0, 0, 0, 0},
+        {12, 77, 79, 125, 131, 137, 155, 145, 147, 133, 141, 127, 151},
+        {10, 78, 80, 130, 134, 148, 150, 58, 56, 124, 154, 0, 0},
+        {7, 79, 137, 59, 157, 139, 51, 53, 0, 0, 0, 0, 0},
+        {10, 92, 94, 154, 142, 152, 96, 150, 100, 136, 124, 0, 0},
+        {7, 93, 95, 157, 139, 155, 97, 77, 0, 0, 0, 0, 0},
+        {6, 94, 142, 78, 148, 98, 72, 0, 0, 0, 0, 0, 0},
+        {12, 97, 99, 125, 131, 137, 143, 151, 153, 139, 147, 133, 121},
+        {10, 98, 100, 136, 140, 154, 156, 78, 76, 124, 130, 0, 0},
+        {7, 99, 143, 79, 157, 145, 71, 73, 0, 0, 0, 0, 0},
+        {10, 112, 114, 124, 148, 122, 116, 156, 120, 142, 130, 0, 0},
+        {7, 113, 115, 157, 145, 125, 117, 97, 0, 0, 0, 0, 0},
+        {6, 114, 148, 98, 154, 118, 92, 0, 0, 0, 0, 0, 0},
+        {12, 117, 119, 131, 137, 143, 149, 121, 123, 145, 153, 139, 127},
+        {10, 118, 120, 142, 146, 124, 126, 98, 96, 130, 136, 0, 0},
+        {7, 119, 149, 99, 157, 151, 91, 93, 0, 0, 0, 0, 0},
+        {12, 126, 122, 132, 128, 138, 134, 144, 140, 150, 146, 156, 152}
 };
 
 const short PositionUtils::tablePositionStepsToPosition[8][PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER - 1][PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER - 1] =
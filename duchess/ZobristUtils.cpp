@@ -0,0 +1,48 @@
+#define NDEBUG
+
+#include "ZobristUtils.h"
+#include "PieceType.h"
+
+#include <cassert>
+
+// SplitMix64: small, fast and good enough to fill a key table
+ZobristKey ZobristUtils::nextRandom(ZobristKey& t_state) {
+    ZobristKey z = (t_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+ZobristUtils::Keys::Keys() {
+    ZobristKey state = 0x6475636865737321ULL;
+    short owner;
+    short pieceType;
+    short square;
+    for (owner = 0; owner < NUM_PLAYERS; ++owner) {
+        for (pieceType = 0; pieceType < NUM_PIECE_TYPES; ++pieceType) {
+            for (square = 0; square < NUM_SQUARES; ++square) {
+                pieceKeys[owner][pieceType][square] = ZobristUtils::nextRandom(state);
+            }
+        }
+    }
+
+    for (owner = 0; owner < NUM_PLAYERS; ++owner) {
+        sideToMoveKeys[owner] = ZobristUtils::nextRandom(state);
+    }
+}
+
+// Built on first use, so there's no static initialisation order to worry about
+const ZobristUtils::Keys& ZobristUtils::getKeys() {
+    static const Keys keys;
+    return keys;
+}
+
+ZobristKey ZobristUtils::getPieceKey(const short t_owner, const PieceType t_pieceType, const BoardIndex t_positionIndex) {
+    assert(t_owner >= 1 && t_owner <= NUM_PLAYERS && t_positionIndex < NUM_SQUARES);
+    return getKeys().pieceKeys[t_owner - 1][static_cast<int>(t_pieceType)][t_positionIndex];
+}
+
+ZobristKey ZobristUtils::getSideToMoveKey(const short t_player) {
+    assert(t_player >= 1 && t_player <= NUM_PLAYERS);
+    return getKeys().sideToMoveKeys[t_player - 1];
+}
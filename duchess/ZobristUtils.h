@@ -0,0 +1,35 @@
+#ifndef DUCHESS_CPP_ZOBRISTUTILS_H
+#define DUCHESS_CPP_ZOBRISTUTILS_H
+
+#include "Position.h"
+#include "PieceType.h"
+
+#include <cstdint>
+
+typedef uint64_t ZobristKey;
+
+// Random keys for Zobrist hashing a board
+// A board's hash is the XOR of the key for every (owner, piece type, square) on the board and the key for the side to move
+// Keys are generated from a fixed seed, so hashes are the same from run to run
+class ZobristUtils {
+public:
+    // Assumes 1 <= t_owner <= 6
+    static ZobristKey getPieceKey(const short t_owner, const PieceType t_pieceType, const BoardIndex t_positionIndex);
+    static ZobristKey getSideToMoveKey(const short t_player);
+
+    static const short NUM_PLAYERS = 6;
+    static const short NUM_PIECE_TYPES = 9;
+    static const short NUM_SQUARES = 158;
+
+private:
+    struct Keys {
+        Keys();
+        ZobristKey pieceKeys[NUM_PLAYERS][NUM_PIECE_TYPES][NUM_SQUARES];
+        ZobristKey sideToMoveKeys[NUM_PLAYERS];
+    };
+
+    static const Keys& getKeys();
+    static ZobristKey nextRandom(ZobristKey& t_state);
+};
+
+#endif //DUCHESS_CPP_ZOBRISTUTILS_H
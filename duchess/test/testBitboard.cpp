@@ -0,0 +1,108 @@
+#include "testBitboard.h"
+#include "../Bitboard.h"
+
+#include <cassert>
+#include <vector>
+
+void TestBitboard::runTests() {
+    TestBitboard::test_setClearTest();
+    TestBitboard::test_wordBoundaries();
+    TestBitboard::test_operators();
+    TestBitboard::test_popLowest();
+    TestBitboard::test_toString();
+}
+
+void TestBitboard::test_setClearTest() {
+    Bitboard b;
+    assert(b.isEmpty());
+    assert(b.count() == 0);
+
+    b.set(1);
+    b.set(80);
+    b.set(157);
+    assert(!b.isEmpty());
+    assert(b.count() == 3);
+    assert(b.test(1));
+    assert(b.test(80));
+    assert(b.test(157));
+    assert(!b.test(0));
+    assert(!b.test(156));
+
+    // Setting twice doesn't change anything
+    b.set(80);
+    assert(b.count() == 3);
+
+    b.clear(80);
+    assert(!b.test(80));
+    assert(b.count() == 2);
+
+    b.reset();
+    assert(b.isEmpty());
+}
+
+void TestBitboard::test_wordBoundaries() {
+    const std::vector<BoardIndex> boundaries {0, 63, 64, 127, 128, 157};
+    for (auto const& index : boundaries) {
+        const Bitboard b = Bitboard::fromIndex(index);
+        assert(b.count() == 1);
+        assert(b.test(index));
+        assert(b.lowest() == index);
+    }
+
+    assert(Bitboard::fromIndex(63).getWord(0) == (uint64_t(1) << 63));
+    assert(Bitboard::fromIndex(64).getWord(1) == 1);
+    assert(Bitboard::fromIndex(128).getWord(2) == 1);
+}
+
+void TestBitboard::test_operators() {
+    Bitboard a;
+    a.set(3);
+    a.set(70);
+    a.set(140);
+    Bitboard b;
+    b.set(70);
+    b.set(150);
+
+    assert((a & b) == Bitboard::fromIndex(70));
+    assert((a | b).count() == 4);
+    assert((a ^ b).count() == 3);
+    assert(!(a ^ b).test(70));
+
+    // The complement only covers the 158 squares on the board
+    assert((~Bitboard()).count() == Bitboard::NUM_BITS);
+    assert((~a).count() == Bitboard::NUM_BITS - 3);
+    assert(((~a) & a).isEmpty());
+
+    Bitboard c = a;
+    c &= b;
+    assert(c == Bitboard::fromIndex(70));
+    c |= a;
+    assert(c == a);
+    c ^= a;
+    assert(c.isEmpty());
+    assert(c != a);
+}
+
+void TestBitboard::test_popLowest() {
+    Bitboard b;
+    b.set(157);
+    b.set(12);
+    b.set(64);
+
+    std::vector<BoardIndex> popped;
+    while (!b.isEmpty()) {
+        popped.push_back(b.popLowest());
+    }
+
+    const std::vector<BoardIndex> expected {12, 64, 157};
+    assert(popped == expected);
+}
+
+void TestBitboard::test_toString() {
+    Bitboard b;
+    assert(b.toString() == "");
+    b.set(1);
+    b.set(12);
+    b.set(157);
+    assert(b.toString() == "1 12 157");
+}
@@ -0,0 +1,16 @@
+#ifndef DUCHESS_CPP_TESTBITBOARD_H
+#define DUCHESS_CPP_TESTBITBOARD_H
+
+class TestBitboard {
+public:
+    static void runTests();
+
+private:
+    static void test_setClearTest();
+    static void test_wordBoundaries();
+    static void test_operators();
+    static void test_popLowest();
+    static void test_toString();
+};
+
+#endif //DUCHESS_CPP_TESTBITBOARD_H
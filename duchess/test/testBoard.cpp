@@ -4,6 +4,7 @@
 #include "../Piece.h"
 #include "../PieceType.h"
 #include "../Board.h"
+#include "../ZobristUtils.h"
 
 #include <algorithm>
 #include <cassert>
@@ -31,6 +32,13 @@ void TestBoard::runTests() {
     TestBoard::test_getActiveLinesFromVortex();
     TestBoard::test_undoMove();
     TestBoard::test_moveVectorsThroughVortex();
+    TestBoard::test_occupancyMasks();
+    TestBoard::test_lazyCheckmateRecords();
+    TestBoard::test_zobristHash();
+    TestBoard::test_copyConstructor();
+    TestBoard::test_getTacticalMoves();
+    TestBoard::test_getStaticExchangeEvaluation();
+    TestBoard::test_doesQuietMoveGiveCheck();
 }
 
 void TestBoard::test_constructor() {
@@ -359,6 +367,22 @@ void TestBoard::TestBoard::test_getAttackingLineOnKingThroughPosition() {
     std::vector<Position*> attackingLine2 = b.getAttackingLineOnKingThroughPosition(&targetPos2, king->getOwner());
     assert(attackingLine2.size() == 0);
 
+    // Put one of our own pieces on 2c4: it's now pinned, so moving it would open up the same line
+    Position pawnPos ("1b3");
+    Piece* pawn = b.getPieceAtPosition(&pawnPos);
+    b.setPiecePosition(pawn, &targetPos1);
+    std::vector<Position*> attackingLine3 = b.getAttackingLineOnKingThroughPosition(&targetPos1, king->getOwner());
+    assert(attackingLine3.size() == 4);
+    assert(*attackingLine3[1] == targetPos1);
+    assert(*attackingLine3[3] == enemyBishopPos);
+
+    // An ally at the end of the line doesn't pin anything
+    Position offBoard ("OB");
+    Position allyPawnPos ("3b3");
+    b.setPiecePosition(b.getPieceAtPosition(&enemyBishopPos), &offBoard);
+    b.setPiecePosition(b.getPieceAtPosition(&allyPawnPos), &enemyBishopPos);
+    std::vector<Position*> attackingLine4 = b.getAttackingLineOnKingThroughPosition(&targetPos1, king->getOwner());
+    assert(attackingLine4.size() == 0);
 }
 
 void TestBoard::test_getLegalMoves() {
@@ -1132,4 +1156,447 @@ void TestBoard::test_moveVectorsThroughVortex() {
     board.setPiecePosition(queen1c2, &p2d6);
     board.initialiseAttDefVectors();
     assert(queen1c2->getActiveAttackingVectors().size() == 3);
-}
\ No newline at end of file
+}
+
+// Checks that every occupancy mask agrees with getPieceAtPosition
+void TestBoard::test_getStaticExchangeEvaluation() {
+    // Indexed by PieceType: pawn, bishop, knight, queen, duchess, rook, wizard, king, fortress
+    const double values[] {1, 3, 3, 9, 7, 5, 4, 100, 6};
+    Position p1c3 ("1c3");
+    Position p1d4 ("1d4");
+    Position p1e3 ("1e3");
+    Position p1e2 ("1e2");
+    Position p1c6 ("1c6");
+    Position p1e6 ("1e6");
+    Position offBoard ("OB");
+
+    // Quiet moves don't start an exchange
+    Board b;
+    b.initialiseAttDefVectors();
+    const Move quiet (b.getPosition(&p1c3), b.getPosition(&p1d4));
+    assert(b.getStaticExchangeEvaluation(quiet, values) == 0);
+
+    // A knight nobody defends is just won
+    Piece* knight2 = b.getPiecesForPlayer(2)[6];
+    b.setPiecePosition(knight2, &p1d4);
+    b.initialiseAttDefVectors();
+    const Move takeKnight (b.getPosition(&p1c3), b.getPosition(&p1d4), knight2);
+    assert(b.isLegalMove(takeKnight, 1));
+    assert(b.getStaticExchangeEvaluation(takeKnight, values) == 3);
+
+    // Player 2's pawn is defended by player 4's knight, so taking it with our duchess loses the duchess
+    Board exchangeBoard;
+    Piece* pawn2 = exchangeBoard.getPiecesForPlayer(2)[0];
+    exchangeBoard.setPiecePosition(pawn2, &p1d4);
+    exchangeBoard.setPiecePosition(exchangeBoard.getPiecesForPlayer(4)[6], &p1c6);
+    exchangeBoard.setPiecePosition(exchangeBoard.getPiecesForPlayer(1)[2], &offBoard);
+    exchangeBoard.setPiecePosition(exchangeBoard.getPiecesForPlayer(1)[4], &offBoard);
+    exchangeBoard.initialiseAttDefVectors();
+    const Move duchessTakesPawn (exchangeBoard.getPosition(&p1e2), exchangeBoard.getPosition(&p1d4), pawn2);
+    assert(exchangeBoard.isLegalMove(duchessTakesPawn, 1));
+    assert(exchangeBoard.getStaticExchangeEvaluation(duchessTakesPawn, values) == 1 - 7);
+
+    // Player 5 is on our team, and gets to take player 4's knight back before player 1 moves again
+    exchangeBoard.setPiecePosition(exchangeBoard.getPiecesForPlayer(5)[6], &p1e6);
+    exchangeBoard.initialiseAttDefVectors();
+    assert(exchangeBoard.getStaticExchangeEvaluation(duchessTakesPawn, values) == 1 - 7 + 3);
+
+    // Taking with a pawn instead, player 4 would only lose their knight to our other pawn by retaking, so doesn't
+    Board pawnBoard;
+    Piece* pawnOn1d4 = pawnBoard.getPiecesForPlayer(2)[0];
+    pawnBoard.setPiecePosition(pawnOn1d4, &p1d4);
+    pawnBoard.setPiecePosition(pawnBoard.getPiecesForPlayer(4)[6], &p1c6);
+    pawnBoard.initialiseAttDefVectors();
+    const Move pawnTakesPawn (pawnBoard.getPosition(&p1e3), pawnBoard.getPosition(&p1d4), pawnOn1d4);
+    assert(pawnBoard.isLegalMove(pawnTakesPawn, 1));
+    assert(pawnBoard.getStaticExchangeEvaluation(pawnTakesPawn, values) == 1);
+}
+
+void TestBoard::assertOccupancyMatchesSquares(const Board& board) {
+    short i;
+    for (i = 1; i <= 157; ++i) {
+        const BoardIndex index = (BoardIndex) i;
+        const Piece* piece = board.getPieceAtPosition(index);
+        assert(board.getOccupancy().test(index) == (piece != nullptr));
+        short player;
+        for (player = 1; player <= 6; ++player) {
+            assert(board.getPlayerOccupancy(player).test(index) == (piece != nullptr && piece->getOwner() == player));
+        }
+        assert(board.getTeamOccupancy(TeamType::ODDS).test(index) == (piece != nullptr && piece->getOwner() % 2 == 1));
+        assert(board.getTeamOccupancy(TeamType::EVENS).test(index) == (piece != nullptr && piece->getOwner() % 2 == 0));
+        if (piece != nullptr) {
+            assert(board.getPieceTypeOccupancy(piece->getType()).test(index));
+        }
+    }
+    assert(!board.getOccupancy().test(0));
+}
+
+void TestBoard::test_occupancyMasks() {
+    Board b;
+    assert(b.getOccupancy().count() == 90);
+    assert(b.getTeamOccupancy(TeamType::ODDS).count() == 45);
+    assert(b.getPlayerOccupancy(4).count() == 15);
+    assert(b.getPieceTypeOccupancy(PieceType::PAWN).count() == 30);
+    assert(b.getPieceTypeOccupancy(PieceType::KING).count() == 6);
+    assert(b.getPieceTypeOccupancy(PieceType::WIZARD).count() == 6);
+    assert((b.getTeamOccupancy(TeamType::ODDS) & b.getTeamOccupancy(TeamType::EVENS)).isEmpty());
+    assert((b.getTeamOccupancy(TeamType::ODDS) | b.getTeamOccupancy(TeamType::EVENS)) == b.getOccupancy());
+    TestBoard::assertOccupancyMatchesSquares(b);
+
+    Position p1c2 ("1c2");
+    Position p2c2 ("2c2");
+    Position p2d6 ("2d6");
+    Position offBoard ("OB");
+    Piece* queen1 = b.getPieceAtPosition(&p1c2);
+    Piece* queen2 = b.getPieceAtPosition(&p2c2);
+
+    // Moving pieces around by hand keeps the masks in step
+    b.setPiecePosition(queen2, &offBoard);
+    b.setPiecePosition(queen1, &p2d6);
+    assert(b.getOccupancy().count() == 89);
+    assert(b.getPlayerOccupancy(1).test(p2d6.getBoardIndex()));
+    assert(!b.getPlayerOccupancy(1).test(p1c2.getBoardIndex()));
+    assert(!b.getPieceTypeOccupancy(PieceType::QUEEN).test(p2c2.getBoardIndex()));
+    TestBoard::assertOccupancyMatchesSquares(b);
+
+    // As does applying and undoing moves
+    b.initialiseAttDefVectors();
+    for (auto const mode : {EvaluationMode::CUMULATIVE, EvaluationMode::DE_NOVO}) {
+        const std::vector<Move>& moves = b.getLegalMoves(1);
+        for (auto const& move : moves) {
+            b.applyMove(&move, mode);
+            TestBoard::assertOccupancyMatchesSquares(b);
+            b.undoMove(&move, mode);
+            TestBoard::assertOccupancyMatchesSquares(b);
+        }
+    }
+    assert(b.getOccupancy().count() == 89);
+}
+
+void TestBoard::assertCheckmateRecordsMatchLegalMoves(const Board& board) {
+    short player;
+    for (player = 1; player <= 6; ++player) {
+        const std::vector<Move> moves = board.getLegalMoves(player);
+        const bool hasMove = !moves[0].isNull();
+        assert(board.hasAnyLegalMove(player) == hasMove);
+        assert(board.isPlayerInCheckmate(player) == (board.isPlayerInCheck(player) && !hasMove));
+    }
+}
+
+void TestBoard::test_lazyCheckmateRecords() {
+    Board b;
+    b.initialiseAttDefVectors();
+    TestBoard::assertCheckmateRecordsMatchLegalMoves(b);
+
+    // Marked records stick until the board changes
+    b.markPlayerInCheckmate(3);
+    assert(b.isPlayerInCheckmate(3));
+    const std::vector<Move> openingMoves = b.getLegalMoves(1);
+    b.applyMove(&openingMoves[0], EvaluationMode::CUMULATIVE);
+    assert(!b.isPlayerInCheckmate(3));
+    b.undoMove(&openingMoves[0], EvaluationMode::CUMULATIVE);
+
+    // Play out a bloodthirsty game (always taking when possible) so that kings end up in check,
+    // checking the lazily computed records against full move generation as we go
+    short player = 1;
+    int ply;
+    for (ply = 0; ply < 300 && !b.isTerminal(); ++ply) {
+        const std::vector<Move> moves = b.getLegalMoves(player);
+        Move chosen = moves[(ply * 7) % moves.size()];
+        for (auto const& move : moves) {
+            if (move.getPieceTaken() != nullptr) {
+                chosen = move;
+                break;
+            }
+        }
+        b.applyMove(&chosen, EvaluationMode::CUMULATIVE);
+        TestBoard::assertCheckmateRecordsMatchLegalMoves(b);
+        player = player == 6 ? 1 : player + 1;
+    }
+}
+
+void TestBoard::test_zobristHash() {
+    Board b;
+    b.initialiseAttDefVectors();
+    const ZobristKey startHash = b.getHash();
+    assert(startHash == b.computeHashFromScratch());
+    assert(b.getSideToMove() == 1);
+
+    // Two fresh boards agree
+    Board other;
+    assert(other.getHash() == startHash);
+
+    // Side to move is part of the hash
+    b.setSideToMove(4);
+    assert(b.getHash() != startHash);
+    assert(b.getHash() == b.computeHashFromScratch());
+    b.setSideToMove(1);
+    assert(b.getHash() == startHash);
+
+    // Every opening move gives a different position, and undoing gets us back where we started
+    std::vector<ZobristKey> seen;
+    for (auto const mode : {EvaluationMode::CUMULATIVE, EvaluationMode::DE_NOVO}) {
+        seen.clear();
+        for (auto const& move : b.getLegalMoves(1)) {
+            b.applyMove(&move, mode);
+            assert(b.getSideToMove() == 2);
+            assert(b.getHash() == b.computeHashFromScratch());
+            assert(std::find(seen.begin(), seen.end(), b.getHash()) == seen.end());
+            seen.push_back(b.getHash());
+            b.undoMove(&move, mode);
+            assert(b.getHash() == startHash);
+        }
+    }
+
+    // Null moves just pass the turn on
+    Move nullMove;
+    b.applyMove(&nullMove, EvaluationMode::CUMULATIVE);
+    assert(b.getSideToMove() == 2);
+    assert(b.getHash() == b.computeHashFromScratch());
+    b.undoMove(&nullMove, EvaluationMode::CUMULATIVE);
+    assert(b.getHash() == startHash);
+
+    // Captures and vortex replacements over a longer game, undone all the way back
+    std::vector<Move> played;
+    short player = 1;
+    int ply;
+    for (ply = 0; ply < 200 && !b.isTerminal(); ++ply) {
+        const std::vector<Move> moves = b.getLegalMoves(player);
+        Move chosen = moves[(ply * 11) % moves.size()];
+        for (auto const& move : moves) {
+            if (move.getPieceTaken() != nullptr || move.getReplacePiece() != nullptr) {
+                chosen = move;
+                break;
+            }
+        }
+        b.applyMove(&chosen, ply % 2 == 0 ? EvaluationMode::CUMULATIVE : EvaluationMode::DE_NOVO);
+        assert(b.getHash() == b.computeHashFromScratch());
+        played.push_back(chosen);
+        player = player == 6 ? 1 : player + 1;
+    }
+    while (!played.empty()) {
+        b.undoMove(&played.back(), EvaluationMode::DE_NOVO);
+        played.pop_back();
+        assert(b.getHash() == b.computeHashFromScratch());
+    }
+    assert(b.getHash() == startHash);
+    assert(b.getSideToMove() == 1);
+}
+
+void TestBoard::test_copyConstructor() {
+    Board b;
+    b.initialiseAttDefVectors();
+
+    {
+        Board copy(b);
+        TestBoard::assertBoardsEquivalent(b, copy);
+    }
+
+    // Play into the middle game so there are captures and pieces off board
+    short player = 1;
+    int ply;
+    for (ply = 0; ply < 60 && !b.isTerminal(); ++ply) {
+        const std::vector<Move> moves = b.getLegalMoves(player);
+        Move chosen = moves[(ply * 7) % moves.size()];
+        for (auto const& move : moves) {
+            if (move.getPieceTaken() != nullptr) {
+                chosen = move;
+                break;
+            }
+        }
+        b.applyMove(&chosen, EvaluationMode::CUMULATIVE);
+        player = player == 6 ? 1 : player + 1;
+    }
+
+    Board copy(b);
+    TestBoard::assertBoardsEquivalent(b, copy);
+
+    // The copy is independent: playing on it leaves the original alone
+    const ZobristKey originalHash = b.getHash();
+    const std::vector<Move> originalMoves = b.getLegalMoves(player);
+    const std::vector<Move> copyMoves = copy.getLegalMoves(player);
+    unsigned int m;
+    for (m = 0; m < copyMoves.size(); ++m) {
+        copy.applyMove(&copyMoves[m], EvaluationMode::CUMULATIVE);
+        assert(b.getHash() == originalHash);
+        copy.undoMove(&copyMoves[m], EvaluationMode::CUMULATIVE);
+        // Cumulative apply/undo doesn't always restore vectors in the exact same form, so do the same to the original
+        b.applyMove(&originalMoves[m], EvaluationMode::CUMULATIVE);
+        b.undoMove(&originalMoves[m], EvaluationMode::CUMULATIVE);
+    }
+    TestBoard::assertBoardsEquivalent(b, copy);
+
+    // And a copy of a copy is just as good
+    Board copyOfCopy(copy);
+    TestBoard::assertBoardsEquivalent(b, copyOfCopy);
+}
+
+void TestBoard::assertBoardsEquivalent(const Board& board, const Board& copy) {
+    assert(board.getHash() == copy.getHash());
+    assert(board.getSideToMove() == copy.getSideToMove());
+    assert(board.getOccupancy() == copy.getOccupancy());
+
+    short i, j;
+    for (i = 1; i <= 6; ++i) {
+        assert(board.getPlayerOccupancy(i) == copy.getPlayerOccupancy(i));
+        assert(board.isPlayerInCheckmate(i) == copy.isPlayerInCheckmate(i));
+
+        for (j = 0; j < 15; ++j) {
+            const Piece* original = board.getPiecesForPlayer(i)[j];
+            const Piece* copied = copy.getPiecesForPlayer(i)[j];
+            assert(original != copied);
+            assert(*original == *copied);
+            assert(original->getPosition() != copied->getPosition());
+            assert(original->getMoveVectorsAsString() == copied->getMoveVectorsAsString());
+        }
+
+        // Moves are made of different pieces, but should pack down the same
+        const std::vector<Move> originalMoves = board.getLegalMoves(i);
+        const std::vector<Move> copiedMoves = copy.getLegalMoves(i);
+        assert(originalMoves.size() == copiedMoves.size());
+        for (j = 0; j < (short) originalMoves.size(); ++j) {
+            assert(board.toCompactMove(originalMoves[j]) == copy.toCompactMove(copiedMoves[j]));
+        }
+    }
+
+    BoardIndex index;
+    for (index = 0; index <= 157; ++index) {
+        const Piece* original = board.getPieceAtPosition(index);
+        const Piece* copied = copy.getPieceAtPosition(index);
+        assert((original == nullptr) == (copied == nullptr));
+        if (original != nullptr) {
+            assert(board.getPieceSlot(original) == copy.getPieceSlot(copied));
+        }
+    }
+}
+
+void TestBoard::test_getTacticalMoves() {
+    Board b;
+    b.initialiseAttDefVectors();
+
+    // Nothing can be taken from the starting position
+    MoveList tacticalMoves;
+    b.getTacticalMoves(1, tacticalMoves);
+    assert(tacticalMoves.empty());
+
+    // A pawn next to the empty vortex can be replaced there by any piece we've lost (but just stepping in is quiet)
+    Board vortexBoard;
+    Position p1c3 ("1c3");
+    Position p1c6 ("1c6");
+    Position p1a1 ("1a1");
+    Position offBoard ("OB");
+    Position vortex ("V");
+    Piece* pawn = vortexBoard.getPieceAtPosition(&p1c3);
+    Piece* rook = vortexBoard.getPieceAtPosition(&p1a1);
+    vortexBoard.setPiecePosition(pawn, &p1c6);
+    vortexBoard.setPiecePosition(rook, &offBoard);
+    vortexBoard.initialiseAttDefVectors();
+    vortexBoard.getTacticalMoves(1, tacticalMoves);
+    const Move replaceWithRook (vortexBoard.getPosition(&p1c6), vortexBoard.getPosition(&vortex), nullptr, rook);
+    const Move stepIntoVortex (vortexBoard.getPosition(&p1c6), vortexBoard.getPosition(&vortex));
+    assert(std::find(tacticalMoves.begin(), tacticalMoves.end(), replaceWithRook) != tacticalMoves.end());
+    assert(std::find(tacticalMoves.begin(), tacticalMoves.end(), stepIntoVortex) == tacticalMoves.end());
+    TestBoard::assertTacticalMovesMatchLegalMoves(vortexBoard, 1);
+
+    // Play out a bloodthirsty game (as in test_lazyCheckmateRecords), checking every player's tactical moves against
+    // full move generation as we go
+    short player = 1;
+    int ply;
+    for (ply = 0; ply < 300 && !b.isTerminal(); ++ply) {
+        short otherPlayer;
+        for (otherPlayer = 1; otherPlayer <= 6; ++otherPlayer) {
+            TestBoard::assertTacticalMovesMatchLegalMoves(b, otherPlayer);
+        }
+
+        const std::vector<Move> moves = b.getLegalMoves(player);
+        Move chosen = moves[(ply * 7) % moves.size()];
+        for (auto const& move : moves) {
+            if (move.getPieceTaken() != nullptr) {
+                chosen = move;
+                break;
+            }
+        }
+        b.applyMove(&chosen, EvaluationMode::CUMULATIVE);
+        player = player == 6 ? 1 : player + 1;
+    }
+}
+
+void TestBoard::assertTacticalMovesMatchLegalMoves(const Board& board, const short player) {
+    MoveList tacticalMoves;
+    board.getTacticalMoves(player, tacticalMoves);
+
+    // In check every escape counts, otherwise just the captures and pawns being replaced on the vortex
+    std::vector<Move> expected;
+    for (auto const& move : board.getLegalMoves(player)) {
+        if (!move.isNull() && (board.isPlayerInCheck(player) || move.getPieceTaken() != nullptr || move.getReplacePiece() != nullptr)) {
+            expected.push_back(move);
+        }
+    }
+
+    assert(tacticalMoves.size() == expected.size());
+    for (auto const& move : tacticalMoves) {
+        assert(std::find(expected.begin(), expected.end(), move) != expected.end());
+    }
+}
+
+void TestBoard::test_doesQuietMoveGiveCheck() {
+    Board b;
+    b.initialiseAttDefVectors();
+
+    // Nothing gives check from the starting position
+    for (auto const& move : b.getLegalMoves(1)) {
+        assert(!b.doesQuietMoveGiveCheck(move));
+    }
+
+    // Play out a bloodthirsty game (as in test_getTacticalMoves), checking each quiet move of the player to move
+    // against actually making it
+    int numChecks = 0;
+    short player = 1;
+    int ply;
+    for (ply = 0; ply < 300 && !b.isTerminal(); ++ply) {
+        numChecks += TestBoard::assertQuietChecksMatchAppliedMoves(b, player);
+
+        const std::vector<Move> moves = b.getLegalMoves(player);
+        Move chosen = moves[(ply * 7) % moves.size()];
+        for (auto const& move : moves) {
+            if (move.getPieceTaken() != nullptr) {
+                chosen = move;
+                break;
+            }
+        }
+        b.applyMove(&chosen, EvaluationMode::CUMULATIVE);
+        player = player == 6 ? 1 : player + 1;
+    }
+    assert(numChecks > 0);
+}
+
+int TestBoard::assertQuietChecksMatchAppliedMoves(Board& board, const short player) {
+    // The cases where it's allowed to say yes when unsure
+    bool unsure = false;
+    short opponent;
+    for (opponent = player % 2 == 0 ? 1 : 2; opponent <= 6; opponent += 2) {
+        unsure = unsure || board.isPlayerInCheck(opponent) || board.getPiecesForPlayer(opponent)[12]->getPosition()->isVortex();
+    }
+
+    int numChecks = 0;
+    for (auto const& move : board.getLegalMoves(player)) {
+        if (move.isNull() || move.getPieceTaken() != nullptr || move.getReplacePiece() != nullptr) {
+            continue;
+        }
+        const bool predicted = board.doesQuietMoveGiveCheck(move);
+        board.applyMove(&move, EvaluationMode::CUMULATIVE);
+        bool givesCheck = false;
+        for (opponent = player % 2 == 0 ? 1 : 2; opponent <= 6; opponent += 2) {
+            givesCheck = givesCheck || board.isPlayerInCheck(opponent);
+        }
+        board.undoMove(&move, EvaluationMode::CUMULATIVE);
+
+        if (givesCheck) {
+            assert(predicted);
+            ++numChecks;
+        } else if (!unsure && !move.getFromPosition()->isVortex() && !move.getToPosition()->isVortex()) {
+            assert(!predicted);
+        }
+    }
+    return numChecks;
+}
@@ -1,6 +1,8 @@
 #ifndef DUCHESS_TESTBOARD_H
 #define DUCHESS_TESTBOARD_H
 
+#include "../Board.h"
+
 class TestBoard {
 public:
     static void runTests();
@@ -26,6 +28,19 @@ private:
     static void test_getActiveLinesFromVortex();
     static void test_undoMove();
     static void test_moveVectorsThroughVortex();
+    static void test_occupancyMasks();
+    static void test_lazyCheckmateRecords();
+    static void test_zobristHash();
+    static void test_copyConstructor();
+    static void test_getTacticalMoves();
+    static void test_getStaticExchangeEvaluation();
+    static void test_doesQuietMoveGiveCheck();
+    static void assertOccupancyMatchesSquares(const Board& board);
+    static void assertCheckmateRecordsMatchLegalMoves(const Board& board);
+    static void assertBoardsEquivalent(const Board& board, const Board& copy);
+    static void assertTacticalMovesMatchLegalMoves(const Board& board, const short player);
+    // Returns how many of player's quiet moves give check
+    static int assertQuietChecksMatchAppliedMoves(Board& board, const short player);
 
 };
 
@@ -0,0 +1,98 @@
+#include "testCompactMove.h"
+#include "../CompactMove.h"
+#include "../Board.h"
+#include "../Move.h"
+#include "../Piece.h"
+
+#include <cassert>
+#include <functional>
+#include <vector>
+
+void TestCompactMove::runTests() {
+    TestCompactMove::test_encoding();
+    TestCompactMove::test_ordering();
+    TestCompactMove::test_hash();
+    TestCompactMove::test_boardConversion();
+}
+
+void TestCompactMove::test_encoding() {
+    CompactMove nullMove;
+    assert(nullMove.isNull());
+    assert(nullMove.getValue() == 0);
+
+    CompactMove quiet (12, 157);
+    assert(!quiet.isNull());
+    assert(quiet.getFromIndex() == 12);
+    assert(quiet.getToIndex() == 157);
+    assert(!quiet.hasPieceTaken());
+    assert(!quiet.hasReplacePiece());
+
+    // Largest codes in every field
+    CompactMove full (156, 157, 6, 14, 6, 14);
+    assert(full.getFromIndex() == 156);
+    assert(full.getToIndex() == 157);
+    assert(full.hasPieceTaken());
+    assert(full.getPieceTakenOwner() == 6);
+    assert(full.getPieceTakenSlot() == 14);
+    assert(full.hasReplacePiece());
+    assert(full.getReplacePieceOwner() == 6);
+    assert(full.getReplacePieceSlot() == 14);
+
+    CompactMove capture (1, 2, 1, 0);
+    assert(capture.getPieceTakenOwner() == 1);
+    assert(capture.getPieceTakenSlot() == 0);
+    assert(!capture.hasReplacePiece());
+
+    assert(CompactMove(capture.getValue()) == capture);
+    assert(capture != quiet);
+}
+
+void TestCompactMove::test_ordering() {
+    // Null first, then by from, to, taken, replace
+    assert(CompactMove() < CompactMove(1, 2));
+    assert(CompactMove(1, 100) < CompactMove(2, 3));
+    assert(CompactMove(5, 3) < CompactMove(5, 4));
+    assert(CompactMove(5, 4) < CompactMove(5, 4, 2, 3));
+    assert(CompactMove(5, 4, 2, 3) < CompactMove(5, 4, 2, 3, 1, 7));
+    assert(!(CompactMove(5, 4) < CompactMove(5, 4)));
+}
+
+void TestCompactMove::test_hash() {
+    std::hash<CompactMove> hasher;
+    assert(hasher(CompactMove(5, 4, 2, 3)) == hasher(CompactMove(5, 4, 2, 3)));
+    assert(hasher(CompactMove(5, 4, 2, 3)) != hasher(CompactMove(5, 4, 2, 4)));
+}
+
+void TestCompactMove::test_boardConversion() {
+    Board b;
+    b.initialiseAttDefVectors();
+
+    // Every legal move survives the round trip
+    short player;
+    for (player = 1; player <= 6; ++player) {
+        for (auto const& move : b.getLegalMoves(player)) {
+            const CompactMove compact = b.toCompactMove(move);
+            assert(compact.getFromIndex() == move.getFromPosition()->getBoardIndex());
+            assert(compact.getToIndex() == move.getToPosition()->getBoardIndex());
+            assert(b.fromCompactMove(compact) == move);
+        }
+    }
+
+    // Taken and replace pieces map back to the same pieces on the board
+    const std::vector<Piece*> pieces3 = b.getPiecesForPlayer(3);
+    const std::vector<Piece*> pieces1 = b.getPiecesForPlayer(1);
+    assert(b.getPieceSlot(pieces3[7]) == 7);
+    assert(b.getPieceSlot(nullptr) == CompactMove::NO_PIECE);
+
+    const CompactMove compact (1, 157, 3, 7, 1, 9);
+    const Move move = b.fromCompactMove(compact);
+    assert(move.getFromPosition()->getBoardIndex() == 1);
+    assert(move.getToPosition()->isVortex());
+    assert(move.getPieceTaken() == pieces3[7]);
+    assert(move.getReplacePiece() == pieces1[9]);
+    assert(b.toCompactMove(move) == compact);
+
+    Move nullMove;
+    assert(b.toCompactMove(nullMove).isNull());
+    assert(b.fromCompactMove(CompactMove()).isNull());
+}
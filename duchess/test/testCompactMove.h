@@ -0,0 +1,15 @@
+#ifndef DUCHESS_CPP_TESTCOMPACTMOVE_H
+#define DUCHESS_CPP_TESTCOMPACTMOVE_H
+
+class TestCompactMove {
+public:
+    static void runTests();
+
+private:
+    static void test_encoding();
+    static void test_ordering();
+    static void test_hash();
+    static void test_boardConversion();
+};
+
+#endif //DUCHESS_CPP_TESTCOMPACTMOVE_H
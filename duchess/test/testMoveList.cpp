@@ -0,0 +1,70 @@
+#include "testMoveList.h"
+#include "../MoveList.h"
+#include "../Move.h"
+#include "../Board.h"
+#include "../Position.h"
+
+#include <cassert>
+#include <vector>
+
+void TestMoveList::runTests() {
+    TestMoveList::test_pushBackAndClear();
+    TestMoveList::test_iteration();
+    TestMoveList::test_matchesLegalMoves();
+}
+
+void TestMoveList::test_pushBackAndClear() {
+    MoveList moves;
+    assert(moves.empty());
+    assert(moves.size() == 0);
+
+    const Position from ("1d4");
+    const Position to ("6a4");
+    Move m (&from, &to);
+    Move nullMove;
+
+    moves.push_back(m);
+    moves.push_back(nullMove);
+    assert(!moves.empty());
+    assert(moves.size() == 2);
+    assert(moves[0] == m);
+    assert(moves[1].isNull());
+
+    moves.clear();
+    assert(moves.empty());
+    assert(moves.begin() == moves.end());
+}
+
+void TestMoveList::test_iteration() {
+    const Position from ("1d4");
+    const Position to1 ("6a4");
+    const Position to2 ("5c4");
+    Move m1 (&from, &to1);
+    Move m2 (&from, &to2);
+
+    MoveList moves;
+    moves.push_back(m1);
+    moves.push_back(m2);
+
+    std::vector<Move> seen;
+    for (auto const& move : moves) {
+        seen.push_back(move);
+    }
+    const std::vector<Move> expected {m1, m2};
+    assert(seen == expected);
+    assert(moves.toVector() == expected);
+}
+
+// Filling a MoveList should give exactly the same moves as the vector version, for every player
+void TestMoveList::test_matchesLegalMoves() {
+    Board b;
+    short player;
+    for (player = 1; player <= 6; ++player) {
+        MoveList moves;
+        // Make sure stale contents are cleared out
+        moves.push_back(Move());
+        b.getLegalMoves(player, moves);
+        assert(moves.toVector() == b.getLegalMoves(player));
+        assert(moves.size() > 1);
+    }
+}
@@ -0,0 +1,14 @@
+#ifndef DUCHESS_CPP_TESTMOVELIST_H
+#define DUCHESS_CPP_TESTMOVELIST_H
+
+class TestMoveList {
+public:
+    static void runTests();
+
+private:
+    static void test_pushBackAndClear();
+    static void test_iteration();
+    static void test_matchesLegalMoves();
+};
+
+#endif //DUCHESS_CPP_TESTMOVELIST_H
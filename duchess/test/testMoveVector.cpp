@@ -13,6 +13,7 @@ void TestMoveVector::runTests() {
     TestMoveVector::test_doesCrossOver();
     TestMoveVector::test_doesInvolve();
     TestMoveVector::test_registerDeregister();
+    TestMoveVector::test_deregisterOutOfOrder();
 }
 
 void TestMoveVector::test_constructorAndAccessors() {
@@ -35,7 +36,14 @@ void TestMoveVector::test_constructorAndAccessors() {
     assert(mv.getPassivePiece() == piece2);
     assert(mv.getActivePieceType() == piece1->getType());
     assert(mv.getPassivePieceType() == piece2->getType());
-    assert(mv.getPositions() == squares);
+    std::vector<BoardIndex> expectedPath;
+    for (auto const& pos : squares) {
+        expectedPath.push_back(pos->getBoardIndex());
+    }
+    assert(mv.getPathAsVector() == expectedPath);
+    assert(mv.getPathLength() == 5);
+    assert(mv.getPathMask().count() == 5);
+    assert(mv.getPathMask().test(pos4.getBoardIndex()));
     assert(mv.getMoveVectorType() == MoveVectorType::DEFENDING);
 }
 
@@ -140,4 +148,47 @@ void TestMoveVector::test_registerDeregister() {
     // Delete mv4 since we manually deregistered it, rather than leaving it to Piece::clearAllMoveVectors();
     delete mv4;
 
-}
\ No newline at end of file
+}
+
+// Removing from the middle of a piece's list moves the last vector into the gap, so its slot must follow it
+void TestMoveVector::test_deregisterOutOfOrder() {
+    Board b;
+
+    Position pos1 ("1a3");
+    Piece* piece1 = b.getPieceAtPosition(&pos1);
+    const std::vector<Piece*> enemies = b.getPiecesForPlayer(2);
+
+    std::vector<Position*> squares = {&pos1};
+    MoveVector* mv1 = new MoveVector (piece1, enemies[0], squares);
+    MoveVector* mv2 = new MoveVector (piece1, enemies[1], squares);
+    MoveVector* mv3 = new MoveVector (piece1, enemies[2], squares);
+
+    mv1->registerSelf();
+    mv2->registerSelf();
+    mv3->registerSelf();
+    assert(piece1->getActiveAttackingVectors().size() == 3);
+    assert(mv3->getActiveSlot() == 2);
+    assert(mv3->getPassiveSlot() == 0);
+
+    mv1->deregisterSelf();
+    assert(piece1->getActiveAttackingVectors().size() == 2);
+    assert(enemies[0]->getPassiveAttackingVectors().size() == 0);
+    assert(piece1->getActiveAttackingVectors()[mv3->getActiveSlot()] == mv3);
+    assert(piece1->getActiveAttackingVectors()[mv2->getActiveSlot()] == mv2);
+
+    // Deregistering something twice is harmless
+    mv1->deregisterSelf();
+    assert(piece1->getActiveAttackingVectors().size() == 2);
+
+    mv3->deregisterSelf();
+    assert(piece1->getActiveAttackingVectors().size() == 1);
+    assert(piece1->getActiveAttackingVectors()[0] == mv2);
+    assert(mv2->getActiveSlot() == 0);
+
+    mv2->deregisterSelf();
+    assert(piece1->getActiveAttackingVectors().size() == 0);
+
+    delete mv1;
+    delete mv2;
+    delete mv3;
+}
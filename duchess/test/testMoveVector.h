@@ -10,6 +10,7 @@ private:
     static void test_doesInvolve();
     static void test_doesCrossOver();
     static void test_registerDeregister();
+    static void test_deregisterOutOfOrder();
 };
 
 #endif //DUCHESS_CPP_TESTMOVEVECTOR_H
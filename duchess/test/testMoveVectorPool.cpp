@@ -0,0 +1,104 @@
+#include "testMoveVectorPool.h"
+#include "../Position.h"
+#include "../Piece.h"
+#include "../MoveVector.h"
+#include "../MoveVectorPool.h"
+#include "../Board.h"
+
+#include <vector>
+#include <cassert>
+#include <string>
+
+void TestMoveVectorPool::runTests() {
+    TestMoveVectorPool::test_createAndRelease();
+    TestMoveVectorPool::test_reset();
+    TestMoveVectorPool::test_destroy();
+}
+
+void TestMoveVectorPool::test_createAndRelease() {
+    Board b;
+
+    Position pos1 ("1a3");
+    Position pos2 ("1e2");
+    Position pos3 ("2a3");
+    Piece* piece1 = b.getPieceAtPosition(&pos1);
+    Piece* piece2 = b.getPieceAtPosition(&pos2);
+    Piece* piece3 = b.getPieceAtPosition(&pos3);
+    std::vector<Position*> squares = {&pos1, &pos2};
+
+    MoveVectorPool pool;
+    MoveVector* mv1 = pool.create(piece1, piece2, squares);
+    MoveVector* mv2 = pool.create(piece1, piece3, squares);
+    assert(pool.getNumLive() == 2);
+    assert(mv1 != mv2);
+    assert(mv1->getActivePiece() == piece1);
+    assert(mv1->getPassivePiece() == piece2);
+    assert(mv1->getPathLength() == 2);
+    assert(mv1->getPath()[0] == pos1.getBoardIndex());
+    assert(mv1->getPath()[1] == pos2.getBoardIndex());
+    assert(mv1->getMoveVectorType() == MoveVectorType::DEFENDING);
+    assert(mv2->getMoveVectorType() == MoveVectorType::ATTACKING);
+
+    // Released slots get reused
+    pool.release(mv1);
+    assert(pool.getNumLive() == 1);
+    MoveVector* mv3 = pool.create(piece2, piece1, squares);
+    assert(mv3 == mv1);
+    assert(mv3->getActivePiece() == piece2);
+    assert(pool.getNumSlots() == 2);
+
+    // Grows past a single chunk
+    unsigned int i;
+    for (i = 0; i < MoveVectorPool::CHUNK_SIZE + 1; ++i) {
+        pool.create(piece1, piece2, squares);
+    }
+    assert(pool.getNumLive() == MoveVectorPool::CHUNK_SIZE + 3);
+}
+
+void TestMoveVectorPool::test_reset() {
+    Board b;
+
+    Position pos1 ("1a3");
+    Position pos2 ("1e2");
+    Piece* piece1 = b.getPieceAtPosition(&pos1);
+    Piece* piece2 = b.getPieceAtPosition(&pos2);
+    std::vector<Position*> squares = {&pos1, &pos2};
+
+    MoveVectorPool pool;
+    MoveVector* first = pool.create(piece1, piece2, squares);
+    pool.create(piece1, piece2, squares);
+    pool.create(piece2, piece1, squares);
+
+    pool.reset();
+    assert(pool.getNumLive() == 0);
+    assert(pool.getNumSlots() == 0);
+
+    // Hands out from the start of its storage again
+    assert(pool.create(piece2, piece1, squares) == first);
+}
+
+void TestMoveVectorPool::test_destroy() {
+    Board b;
+
+    Position pos1 ("1a3");
+    Position pos2 ("1e2");
+    Piece* piece1 = b.getPieceAtPosition(&pos1);
+    Piece* piece2 = b.getPieceAtPosition(&pos2);
+    std::vector<Position*> squares = {&pos1, &pos2};
+
+    // Pooled vectors go back to their pool
+    MoveVectorPool pool;
+    MoveVector* pooled = pool.create(piece1, piece2, squares);
+    MoveVectorPool::destroy(pooled);
+    assert(pool.getNumLive() == 0);
+
+    // Vectors from new are deleted
+    MoveVector* heap = new MoveVector(piece1, piece2, squares);
+    MoveVectorPool::destroy(heap);
+
+    // Recomputing a board's vectors from scratch gives back the same vectors
+    b.initialiseAttDefVectors();
+    const std::string before = piece1->getMoveVectorsAsString();
+    b.initialiseAttDefVectors();
+    assert(piece1->getMoveVectorsAsString() == before);
+}
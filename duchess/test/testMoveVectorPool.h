@@ -0,0 +1,14 @@
+#ifndef DUCHESS_CPP_TESTMOVEVECTORPOOL_H
+#define DUCHESS_CPP_TESTMOVEVECTORPOOL_H
+
+class TestMoveVectorPool {
+public:
+    static void runTests();
+
+private:
+    static void test_createAndRelease();
+    static void test_reset();
+    static void test_destroy();
+};
+
+#endif //DUCHESS_CPP_TESTMOVEVECTORPOOL_H
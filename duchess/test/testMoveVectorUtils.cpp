@@ -6,17 +6,18 @@
 #include "../MoveVector.h"
 #include "../Board.h"
 #include "../MoveVectorUtils.h"
+#include "../Bitboard.h"
 
 #include <cassert>
 #include <vector>
 #include <algorithm>
 
 void TestMoveVectorUtils::runTests() {
-    TestMoveVectorUtils::test_getCommonPositionsMoveVec();
+    TestMoveVectorUtils::test_getCommonSquares();
     TestMoveVectorUtils::test_getCommonPositionsPos();
 }
 
-void TestMoveVectorUtils::test_getCommonPositionsMoveVec() {
+void TestMoveVectorUtils::test_getCommonSquares() {
     Board b;
 
     Position pos1 ("1a3");
@@ -46,26 +47,29 @@ void TestMoveVectorUtils::test_getCommonPositionsMoveVec() {
     std::vector<MoveVector*> mvs3 = {mv1, mv4};
     std::vector<MoveVector*> mvs4 = {mv1};
 
-    std::vector<Position*> positions1 = MoveVectorUtils::getCommonPositions(mvs1);
-    std::vector<Position*> positions2 = MoveVectorUtils::getCommonPositions(mvs2);
-    std::vector<Position*> positions3 = MoveVectorUtils::getCommonPositions(mvs3);
-    std::vector<Position*> positions4 = MoveVectorUtils::getCommonPositions(mvs4);
+    const Bitboard squaresInCommon1 = MoveVectorUtils::getCommonSquares(mvs1);
+    const Bitboard squaresInCommon2 = MoveVectorUtils::getCommonSquares(mvs2);
+    const Bitboard squaresInCommon3 = MoveVectorUtils::getCommonSquares(mvs3);
+    const Bitboard squaresInCommon4 = MoveVectorUtils::getCommonSquares(mvs4);
 
-    assert(std::find(positions1.begin(), positions1.end(), &pos2) != positions1.end());
-    assert(std::find(positions1.begin(), positions1.end(), &pos3) != positions1.end());
-    assert(positions1.size() == 2);
+    assert(squaresInCommon1.test(pos2.getBoardIndex()));
+    assert(squaresInCommon1.test(pos3.getBoardIndex()));
+    assert(squaresInCommon1.count() == 2);
 
-    assert(std::find(positions2.begin(), positions2.end(), &pos1) != positions2.end());
-    assert(std::find(positions2.begin(), positions2.end(), &pos2) != positions2.end());
-    assert(std::find(positions2.begin(), positions2.end(), &pos3) != positions2.end());
-    assert(positions2.size() == 3);
+    assert(squaresInCommon2.test(pos1.getBoardIndex()));
+    assert(squaresInCommon2.test(pos2.getBoardIndex()));
+    assert(squaresInCommon2.test(pos3.getBoardIndex()));
+    assert(squaresInCommon2.count() == 3);
 
-    assert(positions3.size() == 0);
+    assert(squaresInCommon3.isEmpty());
+
+    assert(squaresInCommon4.test(pos1.getBoardIndex()));
+    assert(squaresInCommon4.test(pos2.getBoardIndex()));
+    assert(squaresInCommon4.test(pos3.getBoardIndex()));
+    assert(squaresInCommon4.count() == 3);
 
-    assert(std::find(positions4.begin(), positions4.end(), &pos1) != positions4.end());
-    assert(std::find(positions4.begin(), positions4.end(), &pos2) != positions4.end());
-    assert(std::find(positions4.begin(), positions4.end(), &pos3) != positions4.end());
-    assert(positions4.size() == 3);
+    const std::vector<MoveVector*> noVectors;
+    assert(MoveVectorUtils::getCommonSquares(noVectors).isEmpty());
 
     delete mv1;
     delete mv2;
@@ -6,7 +6,7 @@ public:
     static void runTests();
 
 private:
-    static void test_getCommonPositionsMoveVec();
+    static void test_getCommonSquares();
     static void test_getCommonPositionsPos();
 };
 
@@ -21,7 +21,10 @@ void TestPositionUtils::runTests() {
     TestPositionUtils::test_getIndexOfInnerAnticlockwiseSquare();
     TestPositionUtils::test_getIndexOfOuterAnticlockwiseSquare();
     TestPositionUtils::test_getIndexOfNextSquareInLine();
+    TestPositionUtils::test_getRay();
+    TestPositionUtils::test_getVortexRay();
     TestPositionUtils::test_getKnightMovesFromPosition();
+    TestPositionUtils::test_neighbourListsMatchSlowVersions();
     TestPositionUtils::test_canPieceMoveInDirection();
     TestPositionUtils::test_distanceToVortex();
     TestPositionUtils::test_stepsToPosition();
@@ -98,7 +101,7 @@ void TestPositionUtils::test_positionToBoardIndex() {
 void TestPositionUtils::test_getAdjacentSquareIndices() {
     // Simple flap base case
     Position p1 ("1c2");
-    std::vector<BoardIndex> adj1 = PositionUtils::getAdjacentSquareIndices(&p1);
+    std::vector<BoardIndex> adj1 = PositionUtils::getAdjacentSquareIndices(&p1).toVector();
     assert(std::find(adj1.begin(), adj1.end(), 3) != adj1.end());
     assert(std::find(adj1.begin(), adj1.end(), 7) != adj1.end());
     assert(std::find(adj1.begin(), adj1.end(), 9) != adj1.end());
@@ -107,14 +110,14 @@ void TestPositionUtils::test_getAdjacentSquareIndices() {
 
     // Bottom right corner
     Position p2 ("5e1");
-    std::vector<BoardIndex> adj2 = PositionUtils::getAdjacentSquareIndices(&p2);
+    std::vector<BoardIndex> adj2 = PositionUtils::getAdjacentSquareIndices(&p2).toVector();
     assert(std::find(adj2.begin(), adj2.end(), 90) != adj2.end());
     assert(std::find(adj2.begin(), adj2.end(), 84) != adj2.end());
     assert(adj2.size() == 2);
 
     // Side of flap
     Position p3 ("3e3");
-    std::vector<BoardIndex> adj3 = PositionUtils::getAdjacentSquareIndices(&p3);
+    std::vector<BoardIndex> adj3 = PositionUtils::getAdjacentSquareIndices(&p3).toVector();
     assert(std::find(adj3.begin(), adj3.end(), 60) != adj3.end());
     assert(std::find(adj3.begin(), adj3.end(), 54) != adj3.end());
     assert(std::find(adj3.begin(), adj3.end(), 50) != adj3.end());
@@ -122,7 +125,7 @@ void TestPositionUtils::test_getAdjacentSquareIndices() {
 
     // Top of flap in middle
     Position p4 ("4c5");
-    std::vector<BoardIndex> adj4 = PositionUtils::getAdjacentSquareIndices(&p4);
+    std::vector<BoardIndex> adj4 = PositionUtils::getAdjacentSquareIndices(&p4).toVector();
     assert(std::find(adj4.begin(), adj4.end(), 142) != adj4.end());
     assert(std::find(adj4.begin(), adj4.end(), 140) != adj4.end());
     assert(std::find(adj4.begin(), adj4.end(), 150) != adj4.end());
@@ -130,7 +133,7 @@ void TestPositionUtils::test_getAdjacentSquareIndices() {
     assert(adj4.size() == 4);
 
     Position p5 ("4c6");
-    std::vector<BoardIndex> adj5 = PositionUtils::getAdjacentSquareIndices(&p5);
+    std::vector<BoardIndex> adj5 = PositionUtils::getAdjacentSquareIndices(&p5).toVector();
     assert(std::find(adj5.begin(), adj5.end(), 143) != adj5.end());
     assert(std::find(adj5.begin(), adj5.end(), 139) != adj5.end());
     assert(std::find(adj5.begin(), adj5.end(), 149) != adj5.end());
@@ -139,7 +142,7 @@ void TestPositionUtils::test_getAdjacentSquareIndices() {
 
     // Top of flap on side
     Position p6 ("6e6");
-    std::vector<BoardIndex> adj6 = PositionUtils::getAdjacentSquareIndices(&p6);
+    std::vector<BoardIndex> adj6 = PositionUtils::getAdjacentSquareIndices(&p6).toVector();
     assert(std::find(adj6.begin(), adj6.end(), 145) != adj6.end());
     assert(std::find(adj6.begin(), adj6.end(), 155) != adj6.end());
     assert(std::find(adj6.begin(), adj6.end(), 153) != adj6.end());
@@ -148,7 +151,7 @@ void TestPositionUtils::test_getAdjacentSquareIndices() {
 
     // Vortex
     Position p7 ("V");
-    std::vector<BoardIndex> adj7 = PositionUtils::getAdjacentSquareIndices(&p7);
+    std::vector<BoardIndex> adj7 = PositionUtils::getAdjacentSquareIndices(&p7).toVector();
     assert(std::find(adj7.begin(), adj7.end(), 124) != adj7.end());
     assert(std::find(adj7.begin(), adj7.end(), 130) != adj7.end());
     assert(std::find(adj7.begin(), adj7.end(), 136) != adj7.end());
@@ -162,7 +165,7 @@ void TestPositionUtils::test_getAdjacentSquareIndices() {
 void TestPositionUtils::test_getDiagonalSquareIndices() {
     // Basic centre of flap
     Position p1 ("1c2");
-    std::vector<BoardIndex> adj1 = PositionUtils::getDiagonalSquareIndices(&p1);
+    std::vector<BoardIndex> adj1 = PositionUtils::getDiagonalSquareIndices(&p1).toVector();
     assert(std::find(adj1.begin(), adj1.end(), 2) != adj1.end());
     assert(std::find(adj1.begin(), adj1.end(), 4) != adj1.end());
     assert(std::find(adj1.begin(), adj1.end(), 12) != adj1.end());
@@ -171,27 +174,27 @@ void TestPositionUtils::test_getDiagonalSquareIndices() {
 
     // Bottom corner of flap
     Position p2 ("6a1");
-    std::vector<BoardIndex> adj2 = PositionUtils::getDiagonalSquareIndices(&p2);
+    std::vector<BoardIndex> adj2 = PositionUtils::getDiagonalSquareIndices(&p2).toVector();
     assert(std::find(adj2.begin(), adj2.end(), 107) != adj2.end());
     assert(adj2.size() == 1);
 
     // Middle side of flap
     Position p3 ("4e2");
-    std::vector<BoardIndex> adj3 = PositionUtils::getDiagonalSquareIndices(&p3);
+    std::vector<BoardIndex> adj3 = PositionUtils::getDiagonalSquareIndices(&p3).toVector();
     assert(std::find(adj3.begin(), adj3.end(), 74) != adj3.end());
     assert(std::find(adj3.begin(), adj3.end(), 64) != adj3.end());
     assert(adj3.size() == 2);
 
     // Cross between flaps
     Position p4 ("3a4");
-    std::vector<BoardIndex> adj4 = PositionUtils::getDiagonalSquareIndices(&p4);
+    std::vector<BoardIndex> adj4 = PositionUtils::getDiagonalSquareIndices(&p4).toVector();
     assert(std::find(adj4.begin(), adj4.end(), 80) != adj4.end());
     assert(std::find(adj4.begin(), adj4.end(), 144) != adj4.end());
     assert(std::find(adj4.begin(), adj4.end(), 52) != adj4.end());
     assert(adj4.size() == 3);
 
     Position p5 ("1e4");
-    std::vector<BoardIndex> adj5 = PositionUtils::getDiagonalSquareIndices(&p5);
+    std::vector<BoardIndex> adj5 = PositionUtils::getDiagonalSquareIndices(&p5).toVector();
     assert(std::find(adj5.begin(), adj5.end(), 14) != adj5.end());
     assert(std::find(adj5.begin(), adj5.end(), 122) != adj5.end());
     assert(std::find(adj5.begin(), adj5.end(), 116) != adj5.end());
@@ -199,7 +202,7 @@ void TestPositionUtils::test_getDiagonalSquareIndices() {
 
     // Connecting vortex
     Position p6 ("1d6");
-    std::vector<BoardIndex> adj6 = PositionUtils::getDiagonalSquareIndices(&p6);
+    std::vector<BoardIndex> adj6 = PositionUtils::getDiagonalSquareIndices(&p6).toVector();
     assert(std::find(adj6.begin(), adj6.end(), 157) != adj6.end());
     assert(std::find(adj6.begin(), adj6.end(), 121) != adj6.end());
     assert(std::find(adj6.begin(), adj6.end(), 123) != adj6.end());
@@ -208,7 +211,7 @@ void TestPositionUtils::test_getDiagonalSquareIndices() {
 
     // The vortex itself
     Position p7 ("V");
-    std::vector<BoardIndex> adj7 = PositionUtils::getDiagonalSquareIndices(&p7);
+    std::vector<BoardIndex> adj7 = PositionUtils::getDiagonalSquareIndices(&p7).toVector();
     assert(std::find(adj7.begin(), adj7.end(), 125) != adj7.end());
     assert(std::find(adj7.begin(), adj7.end(), 131) != adj7.end());
     assert(std::find(adj7.begin(), adj7.end(), 137) != adj7.end());
@@ -221,7 +224,7 @@ void TestPositionUtils::test_getDiagonalSquareIndices() {
 
 void TestPositionUtils::test_getAdjacentAndDiagonalSquareIndices() {
     Position p1("1c2");
-    std::vector<BoardIndex> adj1 = PositionUtils::getAdjacentAndDiagonalSquareIndices(&p1);
+    std::vector<BoardIndex> adj1 = PositionUtils::getAdjacentAndDiagonalSquareIndices(&p1).toVector();
     assert(std::find(adj1.begin(), adj1.end(), 2) != adj1.end());
     assert(std::find(adj1.begin(), adj1.end(), 3) != adj1.end());
     assert(std::find(adj1.begin(), adj1.end(), 4) != adj1.end());
@@ -233,14 +236,14 @@ void TestPositionUtils::test_getAdjacentAndDiagonalSquareIndices() {
     assert(adj1.size() == 8);
 
     Position p2("1a1");
-    std::vector<BoardIndex> adj2 = PositionUtils::getAdjacentAndDiagonalSquareIndices(&p2);
+    std::vector<BoardIndex> adj2 = PositionUtils::getAdjacentAndDiagonalSquareIndices(&p2).toVector();
     assert(std::find(adj2.begin(), adj2.end(), 2) != adj2.end());
     assert(std::find(adj2.begin(), adj2.end(), 6) != adj2.end());
     assert(std::find(adj2.begin(), adj2.end(), 7) != adj2.end());
     assert(adj2.size() == 3);
 
     Position p3("V");
-    std::vector<BoardIndex> adj3 = PositionUtils::getAdjacentAndDiagonalSquareIndices(&p3);
+    std::vector<BoardIndex> adj3 = PositionUtils::getAdjacentAndDiagonalSquareIndices(&p3).toVector();
     assert(std::find(adj3.begin(), adj3.end(), 125) != adj3.end());
     assert(std::find(adj3.begin(), adj3.end(), 124) != adj3.end());
     assert(std::find(adj3.begin(), adj3.end(), 131) != adj3.end());
@@ -380,7 +383,7 @@ void TestPositionUtils::test_getKnightMovesFromPosition() {
 
     // Basic case in flap
     Position p1("1c2");
-    std::vector<BoardIndex> p1Moves = PositionUtils::getKnightMovesFromPosition(&p1);
+    std::vector<BoardIndex> p1Moves = PositionUtils::getKnightMovesFromPosition(&p1).toVector();
     assert(std::find(p1Moves.begin(), p1Moves.end(), 1) != p1Moves.end());
     assert(std::find(p1Moves.begin(), p1Moves.end(), 5) != p1Moves.end());
     assert(std::find(p1Moves.begin(), p1Moves.end(), 11) != p1Moves.end());
@@ -391,7 +394,7 @@ void TestPositionUtils::test_getKnightMovesFromPosition() {
 
     // Bottom left corner
     Position p2("1b1");
-    std::vector<BoardIndex> p2Moves = PositionUtils::getKnightMovesFromPosition(&p2);
+    std::vector<BoardIndex> p2Moves = PositionUtils::getKnightMovesFromPosition(&p2).toVector();
     assert(std::find(p2Moves.begin(), p2Moves.end(), 11) != p2Moves.end());
     assert(std::find(p2Moves.begin(), p2Moves.end(), 13) != p2Moves.end());
     assert(std::find(p2Moves.begin(), p2Moves.end(), 9) != p2Moves.end());
@@ -399,7 +402,7 @@ void TestPositionUtils::test_getKnightMovesFromPosition() {
 
     // Case on end of flap
     Position p3("1c5");
-    std::vector<BoardIndex> p3Moves = PositionUtils::getKnightMovesFromPosition(&p3);
+    std::vector<BoardIndex> p3Moves = PositionUtils::getKnightMovesFromPosition(&p3).toVector();
     assert(std::find(p3Moves.begin(), p3Moves.end(), 16) != p3Moves.end());
     assert(std::find(p3Moves.begin(), p3Moves.end(), 20) != p3Moves.end());
     assert(std::find(p3Moves.begin(), p3Moves.end(), 12) != p3Moves.end());
@@ -413,7 +416,7 @@ void TestPositionUtils::test_getKnightMovesFromPosition() {
     assert(p3Moves.size() == 10);
 
     Position p4("2c6");
-    std::vector<BoardIndex> p4Moves = PositionUtils::getKnightMovesFromPosition(&p4);
+    std::vector<BoardIndex> p4Moves = PositionUtils::getKnightMovesFromPosition(&p4).toVector();
     assert(std::find(p4Moves.begin(), p4Moves.end(), 37) != p4Moves.end());
     assert(std::find(p4Moves.begin(), p4Moves.end(), 39) != p4Moves.end());
     assert(std::find(p4Moves.begin(), p4Moves.end(), 135) != p4Moves.end());
@@ -430,7 +433,7 @@ void TestPositionUtils::test_getKnightMovesFromPosition() {
 
     // Starting on vortex
     Position vortex("V");
-    std::vector<BoardIndex> vortexMoves = PositionUtils::getKnightMovesFromPosition(&vortex);
+    std::vector<BoardIndex> vortexMoves = PositionUtils::getKnightMovesFromPosition(&vortex).toVector();
     assert(std::find(vortexMoves.begin(), vortexMoves.end(), 126) != vortexMoves.end());
     assert(std::find(vortexMoves.begin(), vortexMoves.end(), 122) != vortexMoves.end());
     assert(std::find(vortexMoves.begin(), vortexMoves.end(), 132) != vortexMoves.end());
@@ -487,3 +490,92 @@ void TestPositionUtils::test_stepsToPosition() {
     assert(PositionUtils::stepsToPosition(4, &p1a1, &p2e1) == 2);
     assert(PositionUtils::stepsToPosition(7, &p1a1, &p2e1) == 2);
 }
+
+void TestPositionUtils::test_getRay() {
+    // 1a3 going IN crosses the vortex onto flap 4
+    const std::vector<BoardIndex> expected {8, 13, 18, 121, 124, 157, 142, 139, 78, 73, 68, 63};
+    const BoardIndex* ray = PositionUtils::getRay(3, PositionUtils::DIRECTION_IN);
+    assert(std::vector<BoardIndex>(ray, ray + expected.size()) == expected);
+    assert(ray[expected.size()] == 0);
+
+    // 1a1 is on the edge of the board
+    assert(PositionUtils::getRay(1, PositionUtils::DIRECTION_CLOCKWISE)[0] == 0);
+
+    // Every ray should match stepping along the line one square at a time
+    BoardIndex posIndex;
+    for (posIndex = 1; posIndex <= 156; ++posIndex) {
+        short direction;
+        for (direction = PositionUtils::DIRECTION_CLOCKWISE; direction <= PositionUtils::DIRECTION_OUT_ANTICLOCKWISE; ++direction) {
+            const BoardIndex* square = PositionUtils::getRay(posIndex, direction);
+            short tempDirection = direction;
+            Position* prev = PositionUtils::boardIndexToPositionSixPlayer(posIndex);
+            BoardIndex curIndex = PositionUtils::getIndexOfPositionInDirection(prev, direction);
+            while (curIndex != 0) {
+                assert(*square == curIndex);
+                Position* cur = PositionUtils::boardIndexToPositionSixPlayer(curIndex);
+                curIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur, tempDirection);
+                tempDirection = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(tempDirection,
+                                                                                                         PositionUtils::getFlapChange(prev, cur));
+                delete prev;
+                prev = cur;
+                ++square;
+            }
+            delete prev;
+            assert(*square == 0);
+        }
+    }
+}
+
+void TestPositionUtils::test_getVortexRay() {
+    // Rook-style lines leave through the adjacent squares
+    const std::vector<BoardIndex> expectedAdjacent {124, 121, 18, 13, 8, 3};
+    const BoardIndex* adjacentRay = PositionUtils::getVortexRay(0);
+    assert(std::vector<BoardIndex>(adjacentRay, adjacentRay + expectedAdjacent.size()) == expectedAdjacent);
+    assert(adjacentRay[expectedAdjacent.size()] == 0);
+
+    // Bishop-style lines leave through the diagonal squares
+    const std::vector<BoardIndex> expectedDiagonal {125, 123};
+    const BoardIndex* diagonalRay = PositionUtils::getVortexRay(PositionUtils::NUM_VORTEX_ADJACENT_RAYS);
+    assert(std::vector<BoardIndex>(diagonalRay, diagonalRay + expectedDiagonal.size()) == expectedDiagonal);
+    assert(diagonalRay[expectedDiagonal.size()] == 0);
+
+    const Position vortex ("V");
+    const BoardIndexList adjacentSquares = PositionUtils::getAdjacentSquareIndices(&vortex);
+    const BoardIndexList diagonalSquares = PositionUtils::getDiagonalSquareIndices(&vortex);
+    short i;
+    for (i = 0; i < PositionUtils::NUM_VORTEX_ADJACENT_RAYS; ++i) {
+        assert(PositionUtils::getVortexRay(i)[0] == adjacentSquares[i]);
+        assert(PositionUtils::getVortexRay(i + PositionUtils::NUM_VORTEX_ADJACENT_RAYS)[0] == diagonalSquares[i]);
+    }
+}
+
+// The lookup tables may order squares differently to the slow versions, but must hold the same squares
+void TestPositionUtils::test_neighbourListsMatchSlowVersions() {
+    BoardIndex posIndex;
+    for (posIndex = 1; posIndex <= 157; ++posIndex) {
+        const Position* pos = PositionUtils::boardIndexToPositionSixPlayer(posIndex);
+
+        std::vector<BoardIndex> adjacent = PositionUtils::getAdjacentSquareIndices(pos).toVector();
+        std::vector<BoardIndex> adjacentSlow = PositionUtils::getAdjacentSquareIndicesSlow(pos);
+        std::vector<BoardIndex> diagonal = PositionUtils::getDiagonalSquareIndices(pos).toVector();
+        std::vector<BoardIndex> diagonalSlow = PositionUtils::getDiagonalSquareIndicesSlow(pos);
+        std::vector<BoardIndex> both = PositionUtils::getAdjacentAndDiagonalSquareIndices(pos).toVector();
+        std::vector<BoardIndex> bothSlow = PositionUtils::getAdjacentAndDiagonalSquareIndicesSlow(pos);
+        std::vector<BoardIndex> knight = PositionUtils::getKnightMovesFromPosition(pos).toVector();
+        std::vector<BoardIndex> knightSlow = PositionUtils::getKnightMovesFromPositionSlow(pos);
+
+        for (auto list : {&adjacent, &adjacentSlow, &diagonal, &diagonalSlow, &both, &bothSlow, &knight, &knightSlow}) {
+            std::sort(list->begin(), list->end());
+        }
+        assert(adjacent == adjacentSlow);
+        assert(diagonal == diagonalSlow);
+        assert(both == bothSlow);
+        assert(knight == knightSlow);
+
+        const BoardIndexList view = PositionUtils::getKnightMovesFromPosition(pos);
+        assert(view.size() == knight.size());
+        assert(view.end() - view.begin() == view.size());
+
+        delete pos;
+    }
+}
@@ -16,7 +16,10 @@ private:
     static void test_getIndexOfInnerAnticlockwiseSquare();
     static void test_getIndexOfOuterAnticlockwiseSquare();
     static void test_getIndexOfNextSquareInLine();
+    static void test_getRay();
+    static void test_getVortexRay();
     static void test_getKnightMovesFromPosition();
+    static void test_neighbourListsMatchSlowVersions();
     static void test_canPieceMoveInDirection();
     static void test_distanceToVortex();
     static void test_stepsToPosition();
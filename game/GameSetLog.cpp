@@ -8,7 +8,7 @@
 #include <fstream>
 #include <sstream>
 
-void GameSetLog::addLog(const GameLog& t_log, const FeatureSet t_featureSet, const Heuristic t_heuristic, const EvaluationMode t_evaluationMode) {
+void GameSetLog::addLog(const GameLog& t_log, const FeatureSet t_featureSet, const Heuristic t_heuristic, const EvaluationMode t_evaluationMode, const long t_nodesPerSearch) {
     std::stringstream line;
 
     std::string featureSetStr;
@@ -56,7 +56,8 @@ void GameSetLog::addLog(const GameLog& t_log, const FeatureSet t_featureSet, con
     line << heuristicStr << ", ";
     line << evaluationModeStr << ", ";
 
-    line << t_log.getNumTurns();
+    line << t_log.getNumTurns() << ", ";
+    line << t_nodesPerSearch;
 
     m_logEntries.push_back(line.str());
 
@@ -85,7 +86,8 @@ std::string GameSetLog::getHeader() {
     result << "Feature Set, ";
     result << "Heuristic, ";
     result << "Evaluation Mode, ";
-    result << "Number of Turns";
+    result << "Number of Turns, ";
+    result << "Nodes per Search";
     return result.str();
 
 }
\ No newline at end of file
@@ -22,7 +22,8 @@ public:
 
     static std::string getHeader();
 
-    void addLog(const GameLog& t_log, const FeatureSet t_featureSet, const Heuristic t_heuristic, const EvaluationMode t_evaluationMode);
+    // t_nodesPerSearch is the mean number of nodes the game's searches evaluated (see Brain::getTotalNodesSearched)
+    void addLog(const GameLog& t_log, const FeatureSet t_featureSet, const Heuristic t_heuristic, const EvaluationMode t_evaluationMode, const long t_nodesPerSearch);
     void saveLogs() const;
 
 private:
@@ -20,5 +20,5 @@ void TestGameSetLog::test_all() {
     gsl.setLogDest(dest);
     assert(gsl.getLogDest() == dest);
 
-    gsl.addLog(g1, FeatureSet::MATERIAL_ATTDEF, Heuristic::HISTORY, EvaluationMode::DE_NOVO);
+    gsl.addLog(g1, FeatureSet::MATERIAL_ATTDEF, Heuristic::HISTORY, EvaluationMode::DE_NOVO, 1000);
 }
\ No newline at end of file
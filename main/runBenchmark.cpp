@@ -0,0 +1,194 @@
+// hash define NDEBUG if you want to turn off asserts
+#define NDEBUG
+
+#include "../player/Player.h"
+#include "../player/PlayerType.h"
+#include "../player/Heuristic.h"
+#include "../player/FeatureSet.h"
+#include "../player/ParallelSearchMode.h"
+#include "../player/SearchAnalytics.h"
+#include "../player/TimeControl.h"
+#include "../duchess/Board.h"
+#include "../duchess/Move.h"
+#include "../duchess/MoveList.h"
+#include "../duchess/EvaluationMode.h"
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <iostream>
+#include <algorithm>
+
+// How many plies into a scripted game each benchmark position is
+const std::vector<int> POSITION_PLIES {0, 24, 48};
+// How deep fixed depth searches go, unless told otherwise
+const int DEFAULT_FIXED_DEPTH {4};
+
+// A variation of the search to compare at a fixed depth
+struct SearchConfiguration {
+    std::string name;
+    bool usePrincipalVariationSearch;
+    Heuristic heuristic;
+    bool useNullMovePruning;
+    bool useLateMoveReductions;
+    bool useFutilityPruning;
+};
+
+const std::vector<SearchConfiguration> SEARCH_CONFIGURATIONS {
+        {"Alpha-beta", false, Heuristic::KILLER_MOVE, true, true, true},
+        {"PVS", true, Heuristic::KILLER_MOVE, true, true, true},
+        {"PVS (no null move)", true, Heuristic::KILLER_MOVE, false, true, true},
+        {"PVS (no late move reductions)", true, Heuristic::KILLER_MOVE, true, false, true},
+        {"PVS (no futility pruning)", true, Heuristic::KILLER_MOVE, true, true, false},
+        {"PVS (no pruning)", true, Heuristic::KILLER_MOVE, false, false, false},
+        {"PVS (no heuristic)", true, Heuristic::NONE, true, true, true},
+        {"PVS (history)", true, Heuristic::HISTORY, true, true, true},
+        {"PVS (best reply)", true, Heuristic::BEST_REPLY, true, true, true}
+};
+
+void benchmarkThreads(Brain& t_brain, const std::vector<std::unique_ptr<Board>>& t_positions, const unsigned int t_maxThreads);
+void benchmarkFixedDepth(Brain& t_brain, const std::vector<std::unique_ptr<Board>>& t_positions, const int t_depth);
+
+/*
+ * This program measures search on a handful of positions taken from a scripted game.
+ *
+ * By default it measures how search scales with the number of search threads: each position is searched (with the
+ * usual iterative deepening time limit) using 1, 2, 4, ... threads up to the number of hardware threads, or the number
+ * given as the first argument, with each parallel search mode. For each search it prints the depth reached and how
+ * many nodes were searched, as CSV.
+ *
+ * Given "depth" (and optionally a depth) as its arguments, it instead searches each position to the same depth on one
+ * thread with each of SEARCH_CONFIGURATIONS, and prints how many nodes the deepest iteration needed, as CSV.
+ *
+ * See ../player/Player.h (searchForMove) for details of the search
+ */
+int main(const int argc, const char* argv[]) {
+    const bool fixedDepth = argc > 1 && std::strcmp(argv[1], "depth") == 0;
+
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setHeuristic(Heuristic::KILLER_MOVE);
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+    brain.setEvaluationMode(EvaluationMode::CUMULATIVE);
+
+    // Play through a game, taking a copy of the board at each benchmark position
+    // Captures are always taken so that the later positions are less cluttered
+    std::vector<std::unique_ptr<Board>> positions;
+    Board game;
+    game.initialiseAttDefVectors();
+    int ply = 0;
+    for (auto const positionPly : POSITION_PLIES) {
+        while (ply < positionPly && !game.isTerminal()) {
+            const std::vector<Move> moves = game.getLegalMoves(game.getSideToMove());
+            Move chosen = moves[(ply * 7) % moves.size()];
+            for (auto const& move : moves) {
+                if (move.getPieceTaken() != nullptr) {
+                    chosen = move;
+                    break;
+                }
+            }
+            game.applyMove(&chosen, EvaluationMode::CUMULATIVE);
+            ++ply;
+        }
+        positions.emplace_back(new Board(game));
+    }
+
+    if (fixedDepth) {
+        benchmarkFixedDepth(brain, positions, argc > 2 ? std::max(std::atoi(argv[2]), 1) : DEFAULT_FIXED_DEPTH);
+    } else {
+        const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        benchmarkThreads(brain, positions, argc > 1 ? std::max(std::atoi(argv[1]), 1) : hardwareThreads);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+void benchmarkThreads(Brain& t_brain, const std::vector<std::unique_ptr<Board>>& t_positions, const unsigned int t_maxThreads) {
+    const std::vector<ParallelSearchMode> modes {ParallelSearchMode::LAZY_SMP, ParallelSearchMode::YOUNG_BROTHERS_WAIT};
+
+    std::cout << "Mode, Threads, Position ply, Search depth, Nodes evaluated, Duration (millis), Nodes per second, TT hit rate" << std::endl;
+    // Powers of two, plus the maximum itself
+    std::vector<unsigned int> threadCounts;
+    unsigned int count;
+    for (count = 1; count < t_maxThreads; count *= 2) {
+        threadCounts.push_back(count);
+    }
+    threadCounts.push_back(t_maxThreads);
+
+    for (auto const mode : modes) {
+        t_brain.setParallelSearchMode(mode);
+        for (auto const numThreads : threadCounts) {
+            t_brain.setNumSearchThreads(numThreads);
+            unsigned int i;
+            for (i = 0; i < t_positions.size(); ++i) {
+                Board board (*t_positions[i]);
+                const short player = board.getSideToMove();
+                MoveList validMoves;
+                board.getLegalMoves(player, validMoves);
+
+                // Every search starts from nothing so that the thread counts are compared fairly
+                t_brain.getTranspositionTable().clear();
+                Player p (PlayerType::AI, player);
+                p.setBrain(&t_brain);
+                SearchAnalytics analytics (POSITION_PLIES[i] + 1, board.getNumPieces());
+                p.searchForMove(&board, validMoves, POSITION_PLIES[i] + 1, analytics);
+
+                const int duration = std::max(analytics.getDurationInMillis(), 1);
+                std::cout << (mode == ParallelSearchMode::LAZY_SMP ? "Lazy SMP" : "YBW") << ", ";
+                std::cout << analytics.getNumThreads() << ", ";
+                std::cout << POSITION_PLIES[i] << ", ";
+                std::cout << analytics.getSearchDepth() << ", ";
+                std::cout << analytics.getTotalNodesEvaluated() << ", ";
+                std::cout << duration << ", ";
+                std::cout << analytics.getTotalNodesEvaluated() * 1000 / duration << ", ";
+                std::cout << analytics.getTranspositionHitRate() << std::endl;
+            }
+        }
+    }
+}
+
+void benchmarkFixedDepth(Brain& t_brain, const std::vector<std::unique_ptr<Board>>& t_positions, const int t_depth) {
+    // One thread, and no time limit, so that every search reaches the same depth the same way
+    t_brain.setNumSearchThreads(1);
+    t_brain.setMaxSearchDepth(t_depth);
+    const TimeControl unlimited = TimeControl::perMove(INT_MAX);
+
+    std::cout << "Search, Position ply, Search depth, Nodes evaluated, Quiescence nodes, Duration (millis), Null window re-searches, Aspiration failures, Null move searches, Null move cutoffs, Late move reductions, Late move re-searches, Futility prunes" << std::endl;
+    for (auto const& configuration : SEARCH_CONFIGURATIONS) {
+        t_brain.setPrincipalVariationSearch(configuration.usePrincipalVariationSearch);
+        t_brain.setHeuristic(configuration.heuristic);
+        t_brain.setNullMovePruning(configuration.useNullMovePruning);
+        t_brain.setLateMoveReductions(configuration.useLateMoveReductions);
+        t_brain.setFutilityPruning(configuration.useFutilityPruning);
+        unsigned int i;
+        for (i = 0; i < t_positions.size(); ++i) {
+            Board board (*t_positions[i]);
+            const short player = board.getSideToMove();
+            MoveList validMoves;
+            board.getLegalMoves(player, validMoves);
+
+            t_brain.getTranspositionTable().clear();
+            Player p (PlayerType::AI, player);
+            p.setBrain(&t_brain);
+            SearchAnalytics analytics (POSITION_PLIES[i] + 1, board.getNumPieces());
+            p.searchForMove(&board, validMoves, POSITION_PLIES[i] + 1, analytics, unlimited);
+
+            std::cout << configuration.name << ", ";
+            std::cout << POSITION_PLIES[i] << ", ";
+            std::cout << analytics.getSearchDepth() << ", ";
+            std::cout << analytics.getTotalNodesEvaluated() << ", ";
+            std::cout << analytics.getQuiescenceNodes() << ", ";
+            std::cout << analytics.getDurationInMillis() << ", ";
+            std::cout << analytics.getNullWindowResearches() << ", ";
+            std::cout << analytics.getAspirationFailures() << ", ";
+            std::cout << analytics.getNullMoveSearches() << ", ";
+            std::cout << analytics.getNullMoveCutoffs() << ", ";
+            std::cout << analytics.getLateMoveReductions() << ", ";
+            std::cout << analytics.getLateMoveResearches() << ", ";
+            std::cout << analytics.getFutilityPrunes() << std::endl;
+        }
+    }
+}
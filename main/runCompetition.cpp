@@ -172,7 +172,9 @@ static TeamType runGame(const int t_gameNumber, GameSetLog& setLog, const Featur
 
     const TeamType winner = game.getLog().getWinner();
 
-    setLog.addLog(game.getLog(), features1, heuristic, evaluationMode);
+    const int numSearches = brain1.getNumSearches() + brain2.getNumSearches();
+    setLog.addLog(game.getLog(), features1, heuristic, evaluationMode,
+                  (brain1.getTotalNodesSearched() + brain2.getTotalNodesSearched()) / std::max(numSearches, 1));
 
     return winner;
 }
@@ -27,9 +27,15 @@
  *
  * The program ends when the game is finished and the players have been notified about the result
  *
+ * Each search goes to EXPERIMENT_SEARCH_DEPTH, so the game set log's nodes per search shows how much each heuristic
+ * saves
+ *
  * See ../game/Game.h and ../player/Player.h for more details
  */
 
+// Every search stops at this depth, so that the heuristics can be compared by how many nodes they need to get there
+const int EXPERIMENT_SEARCH_DEPTH {3};
+
 static void runGame(GameSetLog& setLog, EvaluationMode evaluationMode, Heuristic heuristic, FeatureSet featureSet);
 
 static std::string getTimeStamp();
@@ -109,6 +115,7 @@ static void runGame(GameSetLog& setLog, EvaluationMode evaluationMode, Heuristic
     Brain brain ("../weights/training/results/material2.wts");
     brain.setHeuristic(heuristic);
     brain.setFeatureSet(featureSet);
+    brain.setMaxSearchDepth(EXPERIMENT_SEARCH_DEPTH);
 
     p1.setBrain(&brain);
     p2.setBrain(&brain);
@@ -143,5 +150,6 @@ static void runGame(GameSetLog& setLog, EvaluationMode evaluationMode, Heuristic
 
     brain.writeLogs();
 
-    setLog.addLog(game.getLog(), featureSet, heuristic, evaluationMode);
+    setLog.addLog(game.getLog(), featureSet, heuristic, evaluationMode,
+                  brain.getTotalNodesSearched() / std::max(brain.getNumSearches(), 1));
 }
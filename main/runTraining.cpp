@@ -196,7 +196,8 @@ static std::string runGame(GameSetLog& setLog, const EvaluationMode evaluationMo
 
     brain.writeLogs();
 
-    setLog.addLog(game.getLog(), featureSet, heuristic, evaluationMode);
+    setLog.addLog(game.getLog(), featureSet, heuristic, evaluationMode,
+                  brain.getTotalNodesSearched() / std::max(brain.getNumSearches(), 1));
 
     return weightSavePath;
 }
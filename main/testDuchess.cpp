@@ -10,6 +10,10 @@
 #include "../duchess/test/testTeamUtils.h"
 #include "../duchess/test/testMoveVector.h"
 #include "../duchess/test/testMoveVectorUtils.h"
+#include "../duchess/test/testBitboard.h"
+#include "../duchess/test/testMoveList.h"
+#include "../duchess/test/testCompactMove.h"
+#include "../duchess/test/testMoveVectorPool.h"
 
 int main(const int argc, const char* argv[]) {
     TestPosition::runTests();
@@ -21,6 +25,10 @@ int main(const int argc, const char* argv[]) {
     TestTeamUtils::runTests();
     TestMoveVector::runTests();
     TestMoveVectorUtils::runTests();
+    TestBitboard::runTests();
+    TestMoveList::runTests();
+    TestCompactMove::runTests();
+    TestMoveVectorPool::runTests();
 
     std::cout << "Tests passed!" << std::endl;
 
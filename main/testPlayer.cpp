@@ -3,14 +3,28 @@
 #include "../player/test/testPlayer.h"
 #include "../player/test/testBrain.h"
 #include "../player/test/testSearchAnalytics.h"
-#include "../player/test/testHeuristicCache.h"
+#include "../player/test/testSearchContext.h"
 #include "../player/test/testFeatureUtils.h"
+#include "../player/test/testTranspositionTable.h"
+#include "../player/test/testWorkStealingPool.h"
+#include "../player/test/testTimeManager.h"
+#include "../player/test/testTimeControl.h"
+#include "../player/test/testPrincipalVariation.h"
+#include "../player/test/testMovePicker.h"
+#include "../player/test/testReductionTable.h"
 
 int main(const int argc, const char* argv[]) {
     TestBrain::runTests();
     TestSearchAnalytics::runTests();
-    TestHeuristicCache::runTests();
+    TestSearchContext::runTests();
     TestFeatureUtils::runTests();
+    TestTranspositionTable::runTests();
+    TestWorkStealingPool::runTests();
+    TestTimeManager::runTests();
+    TestTimeControl::runTests();
+    TestPrincipalVariation::runTests();
+    TestMovePicker::runTests();
+    TestReductionTable::runTests();
     TestPlayer::runTests();
 
     std::cout << "Tests passed!" << std::endl;
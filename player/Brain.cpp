@@ -6,10 +6,12 @@
 #include "SearchAnalytics.h"
 
 #include "../duchess/Board.h"
+#include "../duchess/Bitboard.h"
 #include "../duchess/Piece.h"
 #include "../duchess/MoveVector.h"
 #include "../duchess/Position.h"
 #include "../duchess/TeamUtils.h"
+#include "../duchess/TeamType.h"
 #include "../duchess/PieceType.h"
 
 #include <algorithm>
@@ -24,7 +26,7 @@
 
 // A naive move ordering heuristic to prioritise moves that take other pieces
 // Known as the Most-Valuable Victim heuristic
-void Brain::sortMovesBasedOnHeuristic(std::vector<Move>& t_moves) const {
+void Brain::sortMovesBasedOnHeuristic(MoveList& t_moves) const {
     std::sort(t_moves.begin(), t_moves.end(),
               [&] (const Move& a, const Move& b) -> bool {
                   return this->getValueOfPiece(a.getReplacePiece()) + this->getValueOfPiece(a.getPieceTaken()) > this->getValueOfPiece(b.getReplacePiece()) + this->getValueOfPiece(b.getPieceTaken());
@@ -39,6 +41,39 @@ double Brain::getValueOfPiece(const Piece* t_piece) const {
     }
 }
 
+void Brain::getPieceValues(double t_pieceValues[]) const {
+    const PieceType pieceTypes[] {
+            PieceType::PAWN, PieceType::BISHOP, PieceType::KNIGHT, PieceType::QUEEN, PieceType::DUCHESS,
+            PieceType::ROOK, PieceType::WIZARD, PieceType::KING, PieceType::FORTRESS
+    };
+    for (auto const& pieceType : pieceTypes) {
+        t_pieceValues[static_cast<int>(pieceType)] = this->getWeights()[FeatureUtils::pieceTypeToIndex(pieceType)];
+    }
+}
+
+double Brain::getStaticExchangeEvaluation(const Board& t_board, const Move& t_move) const {
+    double pieceValues[9];
+    this->getPieceValues(pieceValues);
+    return t_board.getStaticExchangeEvaluation(t_move, pieceValues);
+}
+
+double Brain::getMaterialBalance(const Board& t_board, const short t_player) const {
+    double pieceValues[9];
+    this->getPieceValues(pieceValues);
+    const TeamType team = TeamUtils::getTeamForPlayer(t_player);
+    const Bitboard& ours = t_board.getTeamOccupancy(team);
+    const Bitboard& theirs = t_board.getTeamOccupancy(team == TeamType::ODDS ? TeamType::EVENS : TeamType::ODDS);
+    double balance = 0;
+    int type;
+    for (type = 0; type < 9; ++type) {
+        if (static_cast<PieceType>(type) != PieceType::KING) {
+            const Bitboard& pieces = t_board.getPieceTypeOccupancy(static_cast<PieceType>(type));
+            balance += pieceValues[type] * ((ours & pieces).count() - (theirs & pieces).count());
+        }
+    }
+    return balance;
+}
+
 // Only used in training
 double Brain::chanceOfWinningForBoard(const Board& t_board, const short t_player) const {
     return this->sigmoid(this->evaluateBoardState(t_board, t_player));
@@ -559,7 +594,7 @@ void Brain::writeLogs() {
         outFile << SearchAnalytics::getHeader() << std::endl;
 
         // Write values
-        for (auto const logLine : m_searchAnalyticsLogs) {
+        for (auto const& logLine : m_searchAnalyticsLogs) {
             outFile << logLine << std::endl;
         }
         outFile.close();
@@ -6,11 +6,14 @@
 #include <ctime>
 
 #include "Heuristic.h"
-#include "HeuristicCache.h"
+#include "TranspositionTable.h"
 #include "FeatureSet.h"
+#include "ParallelSearchMode.h"
+#include "ReductionTable.h"
 
 #include "../duchess/Board.h"
 #include "../duchess/Move.h"
+#include "../duchess/MoveList.h"
 #include "../duchess/MoveVector.h"
 #include "../duchess/EvaluationMode.h"
 
@@ -20,7 +23,11 @@ class Brain {
 public:
     Brain(const std::string t_pathToWeights = "", EvaluationMode t_evaluationMode = EvaluationMode::CUMULATIVE) :
             m_pathToWeights(t_pathToWeights), m_weightsSavePath(""), m_logDestination(""), m_heuristic(Heuristic::NONE),
-            m_featureSet(FeatureSet::MATERIAL), m_evaluationMode(t_evaluationMode), m_isLearning(false) {
+            m_featureSet(FeatureSet::MATERIAL), m_evaluationMode(t_evaluationMode), m_isLearning(false), m_numSearchThreads(1),
+            m_parallelSearchMode(ParallelSearchMode::LAZY_SMP), m_useQuiescenceSearch(true),
+            m_usePrincipalVariationSearch(true), m_useNullMovePruning(true),
+            m_useLateMoveReductions(true), m_useFutilityPruning(true), m_maxSearchDepth(Brain::DEFAULT_MAX_SEARCH_DEPTH),
+            m_numSearches(0), m_totalNodesSearched(0) {
         this->loadWeights();
         std::srand(std::time(0));
     }
@@ -65,12 +72,109 @@ public:
         this->m_evaluationMode = mode;
     }
 
-    HeuristicCache getHeuristicCache() const {
-        return m_heuristicCache;
+    TranspositionTable& getTranspositionTable() {
+        return m_transpositionTable;
     }
 
-    void sortMovesBasedOnHeuristic(std::vector<Move>& t_moves) const;
+    const TranspositionTable& getTranspositionTable() const {
+        return m_transpositionTable;
+    }
+
+    // Clears the table as well
+    void setTranspositionTableSizeInMB(const unsigned int t_sizeInMB) {
+        m_transpositionTable.resize(t_sizeInMB);
+    }
+
+    // Number of threads (including the main one) to run each search on. Searches while learning always use one
+    unsigned int getNumSearchThreads() const {
+        return m_numSearchThreads;
+    }
+
+    void setNumSearchThreads(const unsigned int t_numSearchThreads) {
+        m_numSearchThreads = t_numSearchThreads < 1 ? 1 : t_numSearchThreads;
+    }
+
+    ParallelSearchMode getParallelSearchMode() const {
+        return m_parallelSearchMode;
+    }
+
+    void setParallelSearchMode(const ParallelSearchMode t_parallelSearchMode) {
+        m_parallelSearchMode = t_parallelSearchMode;
+    }
+
+    // Whether leaves of the search are extended through captures (see Player::quiescenceSearch) before being evaluated
+    bool usesQuiescenceSearch() const {
+        return m_useQuiescenceSearch;
+    }
+
+    void setQuiescenceSearch(const bool t_useQuiescenceSearch) {
+        m_useQuiescenceSearch = t_useQuiescenceSearch;
+    }
+
+    // Whether nodes where even passing the turn would fail high are cut short (see Player::alphaBetaMoveSearch)
+    bool usesNullMovePruning() const {
+        return m_useNullMovePruning;
+    }
+
+    void setNullMovePruning(const bool t_useNullMovePruning) {
+        m_useNullMovePruning = t_useNullMovePruning;
+    }
+
+    // Whether quiet moves late in a node's ordering are first searched less deeply (by as much as the reduction table
+    // says), and only searched fully if that fails high
+    bool usesLateMoveReductions() const {
+        return m_useLateMoveReductions;
+    }
+
+    void setLateMoveReductions(const bool t_useLateMoveReductions) {
+        m_useLateMoveReductions = t_useLateMoveReductions;
+    }
+
+    const ReductionTable& getReductionTable() const {
+        return m_reductionTable;
+    }
+
+    void setReductionTable(const ReductionTable& t_reductionTable) {
+        m_reductionTable = t_reductionTable;
+    }
+
+    // Whether quiet moves near the leaves are skipped when material alone, plus a margin, can't reach alpha
+    bool usesFutilityPruning() const {
+        return m_useFutilityPruning;
+    }
+
+    void setFutilityPruning(const bool t_useFutilityPruning) {
+        m_useFutilityPruning = t_useFutilityPruning;
+    }
+
+    // Whether moves after the first are searched with null windows, and root iterations with aspiration windows
+    // (see Player::alphaBetaMoveSearch and Player::searchForMove). Never while learning
+    bool usesPrincipalVariationSearch() const {
+        return m_usePrincipalVariationSearch;
+    }
+
+    void setPrincipalVariationSearch(const bool t_usePrincipalVariationSearch) {
+        m_usePrincipalVariationSearch = t_usePrincipalVariationSearch;
+    }
+
+    // Iterative deepening stops at this depth even if there's time left
+    int getMaxSearchDepth() const {
+        return m_maxSearchDepth;
+    }
+
+    void setMaxSearchDepth(const int t_maxSearchDepth) {
+        m_maxSearchDepth = t_maxSearchDepth < 1 ? 1 : t_maxSearchDepth;
+    }
+
+    void sortMovesBasedOnHeuristic(MoveList& t_moves) const;
     double getValueOfPiece(const Piece* t_piece) const;
+    // Fills t_pieceValues (indexed by PieceType, so needing room for all 9) with the weights' value of each piece type
+    void getPieceValues(double t_pieceValues[]) const;
+    // The material part of evaluateBoardState alone: the value of t_player's team's pieces (kings aside) less the
+    // other team's. Much cheaper, since it only needs the board's occupancy masks
+    double getMaterialBalance(const Board& t_board, const short t_player) const;
+    // Board::getStaticExchangeEvaluation with these weights' piece values
+    double getStaticExchangeEvaluation(const Board& t_board, const Move& t_move) const;
 
     double chanceOfWinningForBoard(const Board& t_board, const short t_player) const;
     double evaluateBoardState(const Board& t_board, const short t_player) const;
@@ -131,6 +235,21 @@ public:
     }
 
     void addLineToSearchLogs(const std::string t_logLine);
+    // Totals over every search made with this brain, so that its settings (e.g. the heuristic) can be compared by how
+    // much searching they take. See SearchAnalytics::getTotalNodesEvaluated
+    void recordNodesSearched(const long t_nodes) {
+        ++m_numSearches;
+        m_totalNodesSearched += t_nodes;
+    }
+
+    int getNumSearches() const {
+        return m_numSearches;
+    }
+
+    long getTotalNodesSearched() const {
+        return m_totalNodesSearched;
+    }
+
     void writeLogs();
 
     bool isLearning() const {
@@ -156,7 +275,7 @@ public:
     constexpr static double MAX_WEIGHT_DELTA {0.001};
     // Accounts for floating point errors to encourage earlier cutoffs
     constexpr static double FLOAT_FUDGE {0}; // or 1e-8
-    constexpr static int MAX_SEARCH_TIME_MILLIS {1000};
+    constexpr static int DEFAULT_MAX_SEARCH_DEPTH {20};
 
     // A lookup table of position index relative to a player
     // Helps us determine the order in which to evaluate features for piece-square
@@ -175,6 +294,24 @@ private:
     FeatureSet m_featureSet;
     EvaluationMode m_evaluationMode;
     bool m_isLearning;
+    // Default: 1
+    unsigned int m_numSearchThreads;
+    // Default: LAZY_SMP
+    ParallelSearchMode m_parallelSearchMode;
+    // Default: true
+    bool m_useQuiescenceSearch;
+    // Default: true
+    bool m_usePrincipalVariationSearch;
+    // Default: true
+    bool m_useNullMovePruning;
+    // Default: true
+    bool m_useLateMoveReductions;
+    // Default: true
+    bool m_useFutilityPruning;
+    // Default: ReductionTable's default parameters
+    ReductionTable m_reductionTable;
+    // Default: DEFAULT_MAX_SEARCH_DEPTH
+    int m_maxSearchDepth;
 
     // The weights that we apply to different features
     std::vector<double> m_weights;
@@ -185,8 +322,11 @@ private:
     std::vector<double> m_weightDelta;
 
     std::vector<std::string> m_searchAnalyticsLogs;
+    int m_numSearches;
+    long m_totalNodesSearched;
 
-    HeuristicCache m_heuristicCache;
+    // Search results from previous searches, shared by every player and search thread using this brain
+    TranspositionTable m_transpositionTable;
 
     static const double discountRateAtDepth[15];
 
@@ -0,0 +1,92 @@
+#define NDEBUG
+
+#include "MovePicker.h"
+#include "Brain.h"
+#include "Heuristic.h"
+#include "SearchContext.h"
+
+#include "../duchess/Board.h"
+#include "../duchess/Move.h"
+#include "../duchess/MoveList.h"
+#include "../duchess/CompactMove.h"
+
+#include <algorithm>
+
+MovePicker::MovePicker(MoveList& t_moves, const Board& t_board, const Brain& t_brain, const SearchContext& t_context,
+                       const short t_turn, const int t_ply, const Move& t_parentMove, const Move& t_previousLineMove,
+                       const Move& t_transpositionMove) :
+        m_moves(t_moves), m_numPicked(0) {
+    const Heuristic heuristic = t_brain.getHeuristic();
+
+    // Moves stored from elsewhere in the tree needn't be legal here, but then they won't match any of t_moves
+    Move killers[SearchContext::KILLERS_PER_PLY];
+    CompactMove counterMove;
+    unsigned int slot;
+    if (heuristic == Heuristic::KILLER_MOVE) {
+        for (slot = 0; slot < SearchContext::KILLERS_PER_PLY; ++slot) {
+            killers[slot] = t_board.fromCompactMove(t_context.getKiller(t_ply, slot));
+        }
+    } else if (heuristic == Heuristic::BEST_REPLY && !t_parentMove.isNull()) {
+        const CompactMove parentSquares (t_parentMove.getFromPosition()->getBoardIndex(), t_parentMove.getToPosition()->getBoardIndex());
+        counterMove = t_context.getCounterMove(t_turn, parentSquares);
+    }
+
+    double pieceValues[9];
+    t_brain.getPieceValues(pieceValues);
+
+    unsigned int i;
+    for (i = 0; i < m_moves.size(); ++i) {
+        const Move& move = m_moves[i];
+        // A player with no legal moves only has the null move, which has no squares to look up
+        if (move.isNull()) {
+            m_scores[i] = 0;
+            continue;
+        }
+        double score = 0;
+        if (!t_previousLineMove.isNull() && move == t_previousLineMove) {
+            score = MovePicker::PREVIOUS_LINE_SCORE;
+        } else if (!t_transpositionMove.isNull() && move == t_transpositionMove) {
+            score = MovePicker::TRANSPOSITION_SCORE;
+        } else if (move.getPieceTaken() != nullptr || move.getReplacePiece() != nullptr) {
+            const double exchange = t_board.getStaticExchangeEvaluation(move, pieceValues);
+            score = (exchange < 0 ? MovePicker::LOSING_CAPTURE_SCORE : MovePicker::CAPTURE_SCORE) +
+                    t_brain.getValueOfPiece(move.getPieceTaken()) + t_brain.getValueOfPiece(move.getReplacePiece());
+        } else if (heuristic == Heuristic::HISTORY) {
+            score = t_context.getHistoricalCutoffs(t_turn, move.getFromPosition()->getBoardIndex(), move.getToPosition()->getBoardIndex());
+        } else if (heuristic == Heuristic::KILLER_MOVE) {
+            for (slot = 0; slot < SearchContext::KILLERS_PER_PLY; ++slot) {
+                if (!killers[slot].isNull() && move == killers[slot]) {
+                    score = MovePicker::KILLER_SCORE - slot;
+                    break;
+                }
+            }
+        } else if (!counterMove.isNull() && move.getFromPosition()->getBoardIndex() == counterMove.getFromIndex() &&
+                   move.getToPosition()->getBoardIndex() == counterMove.getToIndex()) {
+            score = MovePicker::KILLER_SCORE;
+        }
+        m_scores[i] = score;
+    }
+}
+
+bool MovePicker::next(Move& t_move) {
+    const unsigned int numMoves = m_moves.size();
+    if (m_numPicked >= numMoves) {
+        return false;
+    }
+
+    // The earliest of the best goes next. Those it jumps ahead of each move back one, so that moves that score the
+    // same are picked in the order they were generated
+    unsigned int best = m_numPicked;
+    unsigned int i;
+    for (i = m_numPicked + 1; i < numMoves; ++i) {
+        if (m_scores[i] > m_scores[best]) {
+            best = i;
+        }
+    }
+    std::rotate(m_moves.begin() + m_numPicked, m_moves.begin() + best, m_moves.begin() + best + 1);
+    std::rotate(m_scores + m_numPicked, m_scores + best, m_scores + best + 1);
+
+    t_move = m_moves[m_numPicked];
+    ++m_numPicked;
+    return true;
+}
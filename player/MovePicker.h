@@ -0,0 +1,45 @@
+#ifndef DUCHESS_CPP_MOVEPICKER_H
+#define DUCHESS_CPP_MOVEPICKER_H
+
+#include "Brain.h"
+#include "SearchContext.h"
+
+#include "../duchess/Board.h"
+#include "../duchess/Move.h"
+#include "../duchess/MoveList.h"
+
+// Hands out the moves of a node best first, for Player::alphaBetaMoveSearch
+// Every move is scored up front (cheaply), but the moves are only put in order as they're asked for, by picking the
+// best of those left each time. A node that cuts off after a few moves never sorts the rest
+// Best first means: the move the last iteration's line continues with, the transposition table's move, captures
+// and vortex replacements that don't lose material in the exchange (most valuable first), killers or countermoves,
+// the captures that do lose material, then the other quiet moves by whichever heuristic the brain uses
+class MovePicker {
+public:
+    // t_moves are t_turn's legal moves from t_board, and are reordered as they're picked
+    // t_previousLineMove and t_transpositionMove are null moves if there aren't any
+    MovePicker(MoveList& t_moves, const Board& t_board, const Brain& t_brain, const SearchContext& t_context,
+               const short t_turn, const int t_ply, const Move& t_parentMove, const Move& t_previousLineMove,
+               const Move& t_transpositionMove);
+
+    // Sets t_move to the best move not yet picked, or returns false if they've all been picked
+    bool next(Move& t_move);
+
+    // Scores above every capture and heuristic score
+    constexpr static double PREVIOUS_LINE_SCORE {4e12};
+    constexpr static double TRANSPOSITION_SCORE {3e12};
+    // Added to the value of what a capture takes (plus what a vortex pawn is replaced by)
+    constexpr static double CAPTURE_SCORE {2e12};
+    // Killer slot 0, with each later slot one less. Countermoves get the same
+    constexpr static double KILLER_SCORE {1e12};
+    // Instead of CAPTURE_SCORE for captures that static exchange evaluation says lose material, so that they come
+    // after killers but before any history score
+    constexpr static double LOSING_CAPTURE_SCORE {5e11};
+
+private:
+    MoveList& m_moves;
+    double m_scores[MoveList::CAPACITY];
+    unsigned int m_numPicked;
+};
+
+#endif //DUCHESS_CPP_MOVEPICKER_H
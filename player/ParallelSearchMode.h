@@ -0,0 +1,13 @@
+#ifndef DUCHESS_CPP_PARALLELSEARCHMODE_H
+#define DUCHESS_CPP_PARALLELSEARCHMODE_H
+
+// How a search uses more than one thread (see Brain::setNumSearchThreads)
+enum class ParallelSearchMode {
+    // Helper threads search the same tree independently, sharing the transposition table. The default
+    LAZY_SMP,
+    // The tree is split between threads at nodes whose first child has been searched. Only used when asked for,
+    // until it's shown to beat Lazy SMP on a multi-core machine
+    YOUNG_BROTHERS_WAIT
+};
+
+#endif //DUCHESS_CPP_PARALLELSEARCHMODE_H
@@ -4,24 +4,40 @@
 #include "PlayerType.h"
 #include "SearchAnalytics.h"
 #include "Brain.h"
+#include "TranspositionTable.h"
+#include "SearchTask.h"
+#include "TimeManager.h"
+#include "TimeControl.h"
+#include "WorkStealingPool.h"
+#include "YoungBrothersWaitSearch.h"
+#include "SearchContext.h"
+#include "MovePicker.h"
+#include "ReductionTable.h"
 
 #include "../game/GameResult.h"
 
 #include "../duchess/Move.h"
+#include "../duchess/MoveList.h"
+#include "../duchess/CompactMove.h"
 #include "../duchess/Board.h"
+#include "../duchess/Bitboard.h"
+#include "../duchess/PieceType.h"
 #include "../duchess/TeamUtils.h"
+#include "../duchess/ZobristUtils.h"
 
 #include <vector>
-#include <set>
 #include <iostream>
 #include <cassert>
 #include <string>
 #include <algorithm>
 #include <cmath>
 #include <chrono>
+#include <memory>
+#include <thread>
 
-Move Player::chooseMove(Board* t_board, const int t_globalTurn) {
-    std::vector<Move> validMoves = t_board->getLegalMoves(this->getPlayerNumber());
+Move Player::chooseMove(Board* t_board, const int t_globalTurn, const TimeControl& t_timeControl) {
+    MoveList validMoves;
+    t_board->getLegalMoves(this->getPlayerNumber(), validMoves);
 
     // If the player is a human, just ask them for input
     if (this->getPlayerType() == PlayerType::HUMAN) {
@@ -34,13 +50,13 @@ Move Player::chooseMove(Board* t_board, const int t_globalTurn) {
         return validMoves[randIndex];
     } else {
         // Otherwise, intelligently choose a move
-        return this->searchForMove(t_board, validMoves, t_globalTurn);
+        return this->searchForMove(t_board, validMoves, t_globalTurn, t_timeControl);
     }
 
 }
 
 // Scan for input, make a move out of it, check it it's valid
-Move Player::chooseMoveAsHuman(Board* t_board, const std::vector<Move>* t_validMoves) const {
+Move Player::chooseMoveAsHuman(Board* t_board, const MoveList* t_validMoves) const {
     std::string input;
     std::cout << "Player " << this->getPlayerNumber() << " > ";
     std::cin >> input;
@@ -95,9 +111,18 @@ void Player::notifyResult(const GameResult t_result) {
 }
 
 // Run alpha-beta search for each move, choose the best one
-Move Player::searchForMove(Board* t_board, std::vector<Move> t_validMoves, const int t_globalTurn) {
-    // Establish two timers so we can stop our iteratively deepened search
-    // Note that this approach says "once you've gone over the time limit, just finish the depth you're currently on"
+Move Player::searchForMove(Board* t_board, const MoveList& t_validMoves, const int t_globalTurn, const TimeControl& t_timeControl) {
+    SearchAnalytics analytics(t_globalTurn, t_board->getNumPieces());
+    return this->searchForMove(t_board, t_validMoves, t_globalTurn, analytics, t_timeControl);
+}
+
+Move Player::searchForMove(Board* t_board, const MoveList& t_validMoves, const int t_globalTurn, SearchAnalytics& t_analytics, const TimeControl& t_timeControl) {
+    // The time manager decides whether to start each iteration, and abandons the search in progress at the hard limit
+    // Learning trains from the last iteration, so it has to be allowed to finish: there's no hard limit then
+    const TimeManager timeManager(t_timeControl.allocateBudgetMillis(t_board->getNumPieces(), t_validMoves.size()));
+    m_timeManager = this->getBrain()->isLearning() ? nullptr : &timeManager;
+
+    // Establish a timer so we can estimate how long the next iteration will take
     std::chrono::high_resolution_clock::time_point searchEndedTime;
     std::chrono::high_resolution_clock::time_point currentTime = std::chrono::high_resolution_clock::now();
 
@@ -109,17 +134,65 @@ Move Player::searchForMove(Board* t_board, std::vector<Move> t_validMoves, const
     // If we're training enforce that we must search to at least depth 4
     // Otherwise, just depth 2 is okay
     const int minDepth = 2;
-    const int maxDepth = 20;
+    const int maxDepth = this->getBrain()->getMaxSearchDepth();
 
     int depth = 0;
-    SearchAnalytics analytics(t_globalTurn, t_board->getNumPieces());
+    int completedDepth = 0;
+    SearchAnalytics& analytics = t_analytics;
     analytics.startTiming();
     int previousSearchDuration = 0;
     int estimatedNextDepthDuration = 0;
 
+    // Young Brothers Wait: the tree is split between a pool of threads, one of which is this one
+    std::unique_ptr<WorkStealingPool> pool;
+    std::unique_ptr<YoungBrothersWaitSearch> youngBrothersWait;
+    if (this->usesYoungBrothersWait()) {
+        pool.reset(new WorkStealingPool(this->getBrain()->getNumSearchThreads()));
+        youngBrothersWait.reset(new YoungBrothersWaitSearch(*this, *pool));
+    }
+
+    // Lazy SMP: helper threads search the same position on their own copies of the board, sharing what they find
+    // through the transposition table. Learning needs a single search to train from, so it never uses helpers
+    const bool useHelpers = !this->getBrain()->isLearning() && !this->usesYoungBrothersWait();
+    const int numHelpers = useHelpers ? this->getBrain()->getNumSearchThreads() - 1 : 0;
+    std::vector<std::unique_ptr<Board>> helperBoards;
+    std::vector<MoveList> helperMoves(numHelpers);
+    std::vector<SearchAnalytics> helperAnalytics;
+    helperAnalytics.reserve(numHelpers);
+    // Killers and the like are about where this search is, so each helper starts from the main thread's
+    m_searchContext.startSearch(t_globalTurn);
+    this->getBrain()->getTranspositionTable().newSearch();
+    std::vector<SearchContext> helperContexts(numHelpers, m_searchContext);
+    std::vector<std::thread> helpers;
+    int helper;
+    // Copy everything up front, since t_board is about to be searched (and so changed) by this thread
+    for (helper = 0; helper < numHelpers; ++helper) {
+        helperBoards.emplace_back(new Board(*t_board));
+        for (auto const& move : t_validMoves) {
+            helperMoves[helper].push_back(helperBoards[helper]->fromCompactMove(t_board->toCompactMove(move)));
+        }
+        helperAnalytics.emplace_back(t_globalTurn, t_board->getNumPieces());
+    }
+    m_stopSearch = false;
+    for (helper = 0; helper < numHelpers; ++helper) {
+        helpers.emplace_back(&Player::runHelperSearch, this, helperBoards[helper].get(), &helperMoves[helper],
+                             t_globalTurn, maxDepth, helper + 1, &helperAnalytics[helper], &helperContexts[helper]);
+    }
+
+    // Each iteration's score is the centre of the next one's aspiration window
+    double score = 0;
+    PrincipalVariation pv;
+    m_principalVariation.clear();
+
+    // The root moves are only sorted by the heuristic once. After that, each iteration leaves them in order of the
+    // scores it found, for the next one
+    MoveList rootMoves = t_validMoves;
+    this->getBrain()->sortMovesBasedOnHeuristic(rootMoves);
+
     // Keeps searching deeper until it estimates that the next depth down will take too long
-    while ((estimatedNextDepthDuration < Brain::MAX_SEARCH_TIME_MILLIS && depth <= maxDepth)
-           || depth <= minDepth) {
+    // Even the minimum depth isn't started once the hard limit has passed
+    while (depth < maxDepth && (timeManager.shouldStartIteration(estimatedNextDepthDuration) || depth <= minDepth)
+           && !(m_timeManager != nullptr && m_timeManager->checkHardLimit())) {
         // Only train the weights on our deepest pass
         if (this->getBrain()->isLearning()) {
             this->getBrain()->resetWeightDelta();
@@ -129,7 +202,28 @@ Move Player::searchForMove(Board* t_board, std::vector<Move> t_validMoves, const
         analytics.reset();
 
         // Get best move searching to depth
-        bestMove = this->alphaBetaFromRoot(t_validMoves, t_board, depth, &analytics, t_globalTurn);
+        Move move;
+        if (youngBrothersWait) {
+            move = youngBrothersWait->searchFromRoot(t_validMoves, t_board, depth, &analytics, m_searchContext, t_globalTurn);
+            pv.update(t_board->toCompactMove(move), PrincipalVariation());
+        } else if (depth > 1 && this->usesPrincipalVariationSearch()) {
+            move = this->aspirationSearchFromRoot(rootMoves, t_board, depth, &analytics, m_searchContext, t_globalTurn, score, pv, &m_principalVariation);
+        } else {
+            move = this->alphaBetaFromRoot(rootMoves, t_board, depth, &analytics, m_searchContext, t_globalTurn, -INFINITY, INFINITY, score, pv, &m_principalVariation);
+        }
+
+        // If we ran out of time part way through, the last full iteration is a better guide than the moves this one
+        // got through, unless this was the first
+        if (this->isSearchStopped()) {
+            if (completedDepth == 0) {
+                bestMove = move;
+                m_principalVariation = pv;
+            }
+            break;
+        }
+        bestMove = move;
+        m_principalVariation = pv;
+        completedDepth = depth;
 
         // Find out how long that search took
         searchEndedTime = std::chrono::high_resolution_clock::now();
@@ -139,6 +233,17 @@ Move Player::searchForMove(Board* t_board, std::vector<Move> t_validMoves, const
         estimatedNextDepthDuration = previousSearchDuration * estimatedBranchingFactorSqrt;
         currentTime = std::chrono::high_resolution_clock::now();
     }
+
+    m_stopSearch = true;
+    for (auto& helperThread : helpers) {
+        helperThread.join();
+    }
+    m_timeManager = nullptr;
+    for (auto const& helperAnalytic : helperAnalytics) {
+        analytics.merge(helperAnalytic);
+    }
+    analytics.setSearchDepth(completedDepth);
+    analytics.setNumThreads(pool ? pool->getNumWorkers() : numHelpers + 1);
     analytics.stopTiming();
 
     if (this->getBrain()->isLearning()) {
@@ -146,6 +251,7 @@ Move Player::searchForMove(Board* t_board, std::vector<Move> t_validMoves, const
     }
 
     this->getBrain()->addLineToSearchLogs(analytics.toString());
+    this->getBrain()->recordNodesSearched(analytics.getTotalNodesEvaluated());
 
     // Finally, if this is stochastic, run a random check to just return a random value
     if (this->isStochastic()) {
@@ -158,16 +264,101 @@ Move Player::searchForMove(Board* t_board, std::vector<Move> t_validMoves, const
     return bestMove;
 }
 
-Move Player::alphaBetaFromRoot(std::vector<Move> t_validMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* searchAnalytics, const int t_globalTurn) const {
-    const int numValidMoves = t_validMoves.size();
-    const EvaluationMode evaluationMode = this->getBrain()->getEvaluationMode();
-    Move bestMove = t_validMoves[0];
-    double alpha = -INFINITY;
-    const short nextTurn = this->getPlayerNumber() == 6 ? 1 : this->getPlayerNumber() + 1;
+bool Player::isSearchStopped() const {
+    return m_stopSearch.load(std::memory_order_relaxed) ||
+           (m_timeManager != nullptr && m_timeManager->isHardLimitReached());
+}
 
+bool Player::usesPrincipalVariationSearch() const {
+    return !this->getBrain()->isLearning() && this->getBrain()->usesPrincipalVariationSearch();
+}
+
+bool Player::usesNullMovePruning() const {
+    return !this->getBrain()->isLearning() && this->getBrain()->usesNullMovePruning();
+}
+
+bool Player::usesLateMoveReductions() const {
+    return !this->getBrain()->isLearning() && this->getBrain()->usesLateMoveReductions();
+}
+
+bool Player::usesFutilityPruning() const {
+    return !this->getBrain()->isLearning() && this->getBrain()->usesFutilityPruning();
+}
+
+bool Player::usesQuiescenceSearch() const {
+    return !this->getBrain()->isLearning() && this->getBrain()->usesQuiescenceSearch();
+}
+
+bool Player::isNullMoveSafe(const Board& t_board, const short t_turn, const double t_beta) const {
+    // Passing when in check would leave the king to be taken
+    if (t_board.isPlayerInCheck(t_turn)) {
+        return false;
+    }
+
+    // With little more than pawns left, passing can be the best move there is (zugzwang), so the null move proves nothing
+    const Bitboard pieces = t_board.getPlayerOccupancy(t_turn) & ~t_board.getPieceTypeOccupancy(PieceType::PAWN) &
+                            ~t_board.getPieceTypeOccupancy(PieceType::KING);
+    if (pieces.count() < Player::NULL_MOVE_MIN_PIECES) {
+        return false;
+    }
+
+    // Nor when the other team could mate: either a win is already in sight, or one of our kings is under attack, and
+    // passing gives the next seat (who is on their team) a free move to finish it
+    if (std::fabs(t_beta) >= Brain::WINNING_MOVE_SCORE / 2) {
+        return false;
+    }
+    short teammate;
+    for (teammate = t_turn % 2 == 0 ? 2 : 1; teammate <= 6; teammate += 2) {
+        if (t_board.isPlayerInCheck(teammate)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Player::usesYoungBrothersWait() const {
+    return !this->getBrain()->isLearning() && this->getBrain()->getNumSearchThreads() > 1 &&
+           this->getBrain()->getParallelSearchMode() == ParallelSearchMode::YOUNG_BROTHERS_WAIT;
+}
+
+void Player::runHelperSearch(Board* t_board, MoveList* t_validMoves, const int t_globalTurn, const int t_maxDepth, const int t_helperNumber, SearchAnalytics* t_analytics, SearchContext* t_context) const {
+    // Vary the root move order and the depths searched, so that helpers don't all do exactly the same work
+    // Odd numbered helpers search one ply ahead of the even ones
+    std::rotate(t_validMoves->begin(), t_validMoves->begin() + t_helperNumber % t_validMoves->size(), t_validMoves->end());
+    this->getBrain()->sortMovesBasedOnHeuristic(*t_validMoves);
+    int depth = 1 + t_helperNumber % 2;
+    double score;
+    PrincipalVariation pv;
+    while (!this->isSearchStopped() && depth <= t_maxDepth) {
+        t_analytics->reset();
+        this->alphaBetaFromRoot(*t_validMoves, t_board, depth, t_analytics, *t_context, t_globalTurn, -INFINITY, INFINITY, score, pv);
+        ++depth;
+    }
+}
+
+Move Player::alphaBetaFromRoot(MoveList t_validMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* searchAnalytics, const int t_globalTurn) const {
     // Sort the valid moves based on the heuristic
     this->getBrain()->sortMovesBasedOnHeuristic(t_validMoves);
 
+    SearchContext context;
+    context.startSearch(t_globalTurn);
+    double score;
+    PrincipalVariation pv;
+    return this->alphaBetaFromRoot(t_validMoves, t_board, t_maxDepth, searchAnalytics, context, t_globalTurn, -INFINITY, INFINITY, score, pv);
+}
+
+Move Player::alphaBetaFromRoot(MoveList& t_rootMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* searchAnalytics, SearchContext& t_context, const int t_globalTurn, double t_alpha, const double t_beta, double& t_score, PrincipalVariation& t_pv, const PrincipalVariation* t_previousLine) const {
+    const int numValidMoves = t_rootMoves.size();
+    const EvaluationMode evaluationMode = this->getBrain()->getEvaluationMode();
+    Move bestMove = t_rootMoves[0];
+    double bestValue = -INFINITY;
+    const short nextTurn = this->getPlayerNumber() == 6 ? 1 : this->getPlayerNumber() + 1;
+    t_pv.clear();
+
+    // What the last iteration expected after its best move
+    bool hasPreviousLine = t_previousLine != nullptr && !t_previousLine->empty();
+    const PrincipalVariation previousContinuation = hasPreviousLine ? t_previousLine->getContinuation() : PrincipalVariation();
+
     // Analytics
     searchAnalytics->recordNodesExpandedAtTurn(t_globalTurn, numValidMoves);
     searchAnalytics->recordNodesEvaluatedAtTurn(t_globalTurn, numValidMoves);
@@ -175,37 +366,143 @@ Move Player::alphaBetaFromRoot(std::vector<Move> t_validMoves, Board* t_board, c
     if (!this->getBrain()->isLearning() && numValidMoves == 1) {
         // If we're not learning and only have one valid move (e.g. in checkmate), just return that
         // If we are learning, it's important for us to train from here, so do the full search
-        return t_validMoves[0];
+        // Nothing was searched, so there's no score to speak of
+        t_score = 0;
+        t_pv.update(t_board->toCompactMove(t_rootMoves[0]), PrincipalVariation());
+        return t_rootMoves[0];
     } else {
+        // Scores of the moves searched, in the order searched, so they can be put in order for next time
+        // Those not searched (if time runs out) stay at the bottom
+        std::vector<std::pair<double, unsigned int>> scores;
+        scores.reserve(numValidMoves);
+
         // For each legal move, get it's alpha-beta search value
         // Choose the best one
-        for (auto const& move : t_validMoves) {
+        PrincipalVariation childLine;
+        bool isFirstChild = true;
+        unsigned int i;
+        for (i = 0; i < t_rootMoves.size(); ++i) {
+            const Move& move = t_rootMoves[i];
+            // The last iteration's line carries on below its best move, wherever that's ended up
+            const bool followsPreviousLine = hasPreviousLine && t_board->toCompactMove(move) == (*t_previousLine)[0];
             t_board->applyMove(&move, evaluationMode);
             // Note we use max depth - 1 here because t_board is now one down from the root, so we're already 1 depth in
-            const double val = -1 * this->alphaBetaMoveSearch(t_board, t_maxDepth - 1, alpha, INFINITY, nextTurn, searchAnalytics, t_globalTurn + 1, move, t_maxDepth);
+            const double val = this->searchChild(t_board, t_maxDepth - 1, t_alpha, t_beta, nextTurn, searchAnalytics, t_context, t_globalTurn + 1, move, t_maxDepth, nullptr, isFirstChild, &childLine,
+                                                 followsPreviousLine ? &previousContinuation : nullptr);
             t_board->undoMove(&move, evaluationMode);
+            isFirstChild = false;
+            hasPreviousLine = hasPreviousLine && !followsPreviousLine;
+
+            // Out of time: this move's value is meaningless, so the best of those searched so far will have to do
+            if (this->isSearchStopped()) {
+                break;
+            }
 
-            if (val >= alpha) {
-                alpha = val;
+            // Later moves that only tie with the best so far can't be told apart from worse ones by a null window
+            // search, so the first of equals is kept
+            scores.emplace_back(val, i);
+            if (val > bestValue) {
+                bestValue = val;
                 bestMove = move;
+                t_pv.update(t_board->toCompactMove(move), childLine);
             }
+            t_alpha = std::max(t_alpha, val);
+
+            // Only possible with an aspiration window: the caller will have to search again anyway
+            if (t_alpha + Brain::FLOAT_FUDGE >= t_beta) {
+                break;
+            }
+        }
 
+        // Best first for the next iteration. Most scores are only bounds, but they're still a better guide than the
+        // heuristic, and being stable keeps the best move (the first of any equals) on top
+        std::stable_sort(scores.begin(), scores.end(),
+                         [] (const std::pair<double, unsigned int>& a, const std::pair<double, unsigned int>& b) -> bool {
+                             return a.first > b.first;
+                         });
+        for (i = scores.size(); i < t_rootMoves.size(); ++i) {
+            scores.emplace_back(-INFINITY, i);
         }
+        MoveList reordered;
+        for (auto const& score : scores) {
+            reordered.push_back(t_rootMoves[score.second]);
+        }
+        t_rootMoves = reordered;
 
         // If we are learning, update the weights
         if (this->getBrain()->isLearning()) {
-            // t_alpha is an exact value
-            this->getBrain()->updateWeightsForFeatures(this->getBrain()->boardToFeatures(*t_board, this->getPlayerNumber()), alpha, alpha, 1, this->getPlayerNumber(), *t_board);
+            // Learning always searches the full window, so bestValue is an exact value
+            this->getBrain()->updateWeightsForFeatures(this->getBrain()->boardToFeatures(*t_board, this->getPlayerNumber()), bestValue, bestValue, 1, this->getPlayerNumber(), *t_board);
         }
     }
 
+    t_score = bestValue;
     return bestMove;
 }
 
-double Player::alphaBetaMoveSearch(Board* t_board, const int t_depth, double t_alpha, double t_beta, const short t_turn, SearchAnalytics* searchAnalytics, const int t_globalTurn, const Move& t_parentMove, const int t_maxDepth) const {
+Move Player::aspirationSearchFromRoot(MoveList& t_rootMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* searchAnalytics, SearchContext& t_context, const int t_globalTurn, double& t_score, PrincipalVariation& t_pv, const PrincipalVariation* t_previousLine) const {
+    double delta = Player::ASPIRATION_WINDOW;
+    double alpha = t_score - delta;
+    double beta = t_score + delta;
+    int failures = 0;
+    while (true) {
+        double score;
+        const Move move = this->alphaBetaFromRoot(t_rootMoves, t_board, t_maxDepth, searchAnalytics, t_context, t_globalTurn, alpha, beta, score, t_pv, t_previousLine);
+        const bool isFullWindow = alpha == -INFINITY && beta == INFINITY;
+        if (this->isSearchStopped() || isFullWindow || (score > alpha && score < beta)) {
+            t_score = score;
+            return move;
+        }
+
+        // The score is only a bound, so look again with a wider window on the side that failed
+        searchAnalytics->recordAspirationFailure();
+        ++failures;
+        delta *= Player::ASPIRATION_WIDENING;
+        if (score <= alpha) {
+            alpha = failures >= Player::MAX_ASPIRATION_FAILURES ? -INFINITY : score - delta;
+        } else {
+            beta = failures >= Player::MAX_ASPIRATION_FAILURES ? INFINITY : score + delta;
+        }
+    }
+}
+
+double Player::searchChild(Board* t_board, const int t_depth, const double t_alpha, const double t_beta, const short t_turn, SearchAnalytics* searchAnalytics, SearchContext& t_context, const int t_globalTurn, const Move& t_move, const int t_maxDepth, const SearchTask* t_task, const bool t_isFirstChild, PrincipalVariation* t_childLine, const PrincipalVariation* t_previousLine) const {
+    if (t_childLine != nullptr) {
+        t_childLine->clear();
+    }
+
+    // A null window only makes sense once there's a score to beat
+    if (!t_isFirstChild && this->usesPrincipalVariationSearch() && std::isfinite(t_alpha)) {
+        const double val = -this->alphaBetaMoveSearch(t_board, t_depth, -t_alpha - Player::NULL_WINDOW_WIDTH, -t_alpha, t_turn, searchAnalytics, t_context, t_globalTurn, t_move, t_maxDepth, t_task, nullptr, t_previousLine);
+        // Either it's no better than what we have, or it's good enough to cut off anyway: the bound will do
+        if (val <= t_alpha || val + Brain::FLOAT_FUDGE >= t_beta) {
+            return val;
+        }
+        searchAnalytics->recordNullWindowResearch();
+    }
+
+    return -this->alphaBetaMoveSearch(t_board, t_depth, -t_beta, -t_alpha, t_turn, searchAnalytics, t_context, t_globalTurn, t_move, t_maxDepth, t_task, t_childLine, t_previousLine);
+}
+
+double Player::alphaBetaMoveSearch(Board* t_board, const int t_depth, double t_alpha, double t_beta, const short t_turn, SearchAnalytics* searchAnalytics, SearchContext& t_context, const int t_globalTurn, const Move& t_parentMove, const int t_maxDepth, const SearchTask* t_task, PrincipalVariation* t_pv, const PrincipalVariation* t_previousLine, const bool t_allowNullMove) const {
+    // Leaves, and nodes cut short by the transposition table, don't know how play carries on
+    if (t_pv != nullptr) {
+        t_pv->clear();
+    }
+
+    // Give up on searches that are no longer needed, or have run out of time. Whoever started them knows to ignore
+    // what they return
+    if (m_stopSearch.load(std::memory_order_relaxed) || (m_timeManager != nullptr && m_timeManager->pollHardLimit()) ||
+        (t_task != nullptr && t_task->isAborted())) {
+        return 0;
+    }
+
     // Should we stop now?
     const bool isTerminal = t_board->isTerminal();
-    if (t_depth == 0 || isTerminal) {
+    if (t_depth == 0 && !isTerminal && this->usesQuiescenceSearch()) {
+        // Out of depth, but only evaluate once any exchanges have played out
+        return this->quiescenceSearch(t_board, t_alpha, t_beta, t_turn, searchAnalytics, 0, t_task);
+    } else if (t_depth == 0 || isTerminal) {
         // Search is complete, return evaluation of this state
         // We use -WINNING_MOVE_SCORE + depth here to prefer winning in a short number of moves
         return (isTerminal ? ((-1 * Brain::WINNING_MOVE_SCORE) + t_depth) : this->getBrain()->evaluateBoardState(*t_board, t_turn));
@@ -216,50 +513,146 @@ double Player::alphaBetaMoveSearch(Board* t_board, const int t_depth, double t_a
 
         const EvaluationMode evaluationMode = this->getBrain()->getEvaluationMode();
         double bestValue = -INFINITY;
+        Move bestMove;
         bool foundCutoff = false;
         double originalAlpha = t_alpha;
 
-        // Before we generate the legal moves here, depending on our heuristic we may be able to find an early cutoff
-        // Here we try to fill earlyMoves with cached prior-moves that may be helpful
-        const Heuristic heuristic = this->getBrain()->getHeuristic();
-        std::vector<Move> earlyMoves;
-        if (heuristic == Heuristic::KILLER_MOVE) {
-            const std::set<Move> killerMoves = this->getBrain()->getHeuristicCache().getKillerMoves(t_turn);
-            for (auto const& killerMove : killerMoves) {
-                if (t_board->isLegalMove(killerMove, t_turn)) {
-                    earlyMoves.push_back(killerMove);
-                } else {
-                    this->getBrain()->getHeuristicCache().eraseMoveAsKiller(killerMove, t_turn);
+        // Look this position up in the transposition table
+        // While learning, weights change between searches so old scores can't be trusted (and every node needs visiting to train)
+        // The board's side to move must agree with t_turn, since it's part of the hash
+        TranspositionTable& transpositionTable = this->getBrain()->getTranspositionTable();
+        const bool useTranspositionTable = !this->getBrain()->isLearning() && t_board->getSideToMove() == t_turn;
+        const ZobristKey hash = t_board->getHash();
+        TranspositionEntry entry;
+        Move transpositionMove;
+        if (useTranspositionTable) {
+            const bool hit = transpositionTable.probe(hash, entry);
+            searchAnalytics->recordTranspositionProbe(hit);
+            if (hit) {
+                if (entry.depth >= t_depth) {
+                    if (entry.bound == BoundType::EXACT) {
+                        searchAnalytics->recordTranspositionCutoff();
+                        return entry.score;
+                    } else if (entry.bound == BoundType::LOWER) {
+                        t_alpha = std::max(t_alpha, entry.score);
+                    } else if (entry.bound == BoundType::UPPER) {
+                        t_beta = std::min(t_beta, entry.score);
+                    }
+
+                    if (t_alpha + Brain::FLOAT_FUDGE >= t_beta) {
+                        searchAnalytics->recordTranspositionCutoff();
+                        return entry.score;
+                    }
                 }
+
+                // Whatever was best last time is a good first guess now
+                // (if it's one of the moves here: a different position can have the same hash)
+                transpositionMove = t_board->fromCompactMove(entry.bestMove);
             }
-        } else if (heuristic == Heuristic::HISTORY) {
-            const std::vector<Move> historyMoves = this->getBrain()->getHeuristicCache().getHistoryMoves(t_turn);
-            for (auto const& historyMove : historyMoves) {
-                if (t_board->isLegalMove(historyMove, t_turn)) {
-                    earlyMoves.push_back(historyMove);
-                } else {
-                    this->getBrain()->getHeuristicCache().eraseMoveAsHistory(historyMove, t_turn);
+        }
+
+        // Null move pruning: if passing the turn to the next seat (an opponent) and searching less deeply still fails
+        // high, actually moving would almost certainly do so too. A verification search without the null move
+        // confirms it before the node is cut short. Never two passes in a row
+        if (t_allowNullMove && !t_parentMove.isNull() && this->usesNullMovePruning() &&
+            t_depth >= Player::NULL_MOVE_MIN_DEPTH && std::isfinite(t_beta) && this->isNullMoveSafe(*t_board, t_turn, t_beta)) {
+            searchAnalytics->recordNullMoveSearch();
+            const Move nullMove;
+            const short nextTurn = (t_turn == 6 ? 1 : t_turn + 1);
+            t_board->applyMove(&nullMove, evaluationMode);
+            const double nullValue = -this->alphaBetaMoveSearch(t_board, t_depth - 1 - Player::NULL_MOVE_REDUCTION, -t_beta, -t_beta + Player::NULL_WINDOW_WIDTH, nextTurn, searchAnalytics, t_context, t_globalTurn + 1, nullMove, t_maxDepth, t_task);
+            t_board->undoMove(&nullMove, evaluationMode);
+
+            if (!this->isSearchStopped() && nullValue + Brain::FLOAT_FUDGE >= t_beta) {
+                const double verifiedValue = this->alphaBetaMoveSearch(t_board, t_depth - Player::NULL_MOVE_REDUCTION, t_beta - Player::NULL_WINDOW_WIDTH, t_beta, t_turn, searchAnalytics, t_context, t_globalTurn, t_parentMove, t_maxDepth, t_task, nullptr, nullptr, false);
+                if (!this->isSearchStopped() && verifiedValue + Brain::FLOAT_FUDGE >= t_beta) {
+                    searchAnalytics->recordNullMoveCutoff();
+                    // A win found without moving can't be trusted, so only claim as much as was needed
+                    return std::fabs(verifiedValue) >= Brain::WINNING_MOVE_SCORE / 2 ? t_beta : verifiedValue;
                 }
-            }
-        } else if (heuristic == Heuristic::BEST_REPLY && this->getBrain()->getHeuristicCache().hasBestReply(t_parentMove)) {
-            const Move bestReply = this->getBrain()->getHeuristicCache().getBestReply(t_parentMove);
-            if (t_board->isLegalMove(bestReply, t_turn)) {
-                earlyMoves.push_back(bestReply);
-            } else {
-                this->getBrain()->getHeuristicCache().eraseMoveAsBestReply(t_parentMove);
+                searchAnalytics->recordNullMoveVerificationFailure();
             }
         }
 
-        // If we found any moves to try early, try them first
-        for (auto const& move : earlyMoves) {
-            ++nodesEvaluated;
+        // If this node is on the line the last iteration expected, the move that line carries on with is the best guess
+        // of all, ahead of the table's (which may have been replaced since, and isn't there at all while learning)
+        Move previousLineMove;
+        PrincipalVariation previousContinuation;
+        if (t_previousLine != nullptr && !t_previousLine->empty()) {
+            previousLineMove = t_board->fromCompactMove((*t_previousLine)[0]);
+            previousContinuation = t_previousLine->getContinuation();
+        }
+
+        // Get the valid moves from this state as child nodes
+        MoveList validMoves;
+        t_board->getLegalMoves(t_turn, validMoves);
+        nodesExpanded += validMoves.size();
+        // They're put in order as they're needed, so a cutoff early on saves sorting the rest
+        const Heuristic heuristic = this->getBrain()->getHeuristic();
+        const int ply = t_context.getPly(t_globalTurn);
+        MovePicker picker(validMoves, *t_board, *this->getBrain(), t_context, t_turn, ply, t_parentMove, previousLineMove, transpositionMove);
+
+        // The line from each child, while it's worth keeping track of
+        PrincipalVariation childLine;
+        PrincipalVariation* const childLinePointer = t_pv != nullptr ? &childLine : nullptr;
+        bool isFirstChild = true;
+
+        // Late move reductions and futility pruning only pass over quiet moves that don't give check, and never when
+        // getting out of check ourselves
+        const bool useLateMoveReductions = this->usesLateMoveReductions() && !t_board->isPlayerInCheck(t_turn);
+        // Near the leaves, a quiet move can only change the score by so much. If material alone plus that much can't
+        // reach alpha, there's no point searching it
+        double futilityValue = -INFINITY;
+        if (this->usesFutilityPruning() && t_depth <= Player::FUTILITY_MAX_DEPTH && !t_board->isPlayerInCheck(t_turn)) {
+            futilityValue = this->getBrain()->getMaterialBalance(*t_board, t_turn) + Player::FUTILITY_MARGIN * t_depth;
+        }
+        const ReductionTable& reductionTable = this->getBrain()->getReductionTable();
+
+        Move move;
+        int moveNumber = 0;
+        while (picker.next(move)) {
+            ++moveNumber;
+            const short nextTurn = (t_turn == 6 ? 1 : t_turn + 1);
+
+            // The first move is always searched properly, so that there's a score to beat. Whether a move gives check
+            // is worked out last, and before it's made, so that pruned moves never need making
+            const bool isQuiet = move.getPieceTaken() == nullptr && move.getReplacePiece() == nullptr;
+            const bool mightSkip = !isFirstChild && isQuiet && std::isfinite(t_alpha) && std::fabs(t_alpha) < Brain::WINNING_MOVE_SCORE / 2 &&
+                                   (useLateMoveReductions || futilityValue > -INFINITY) && !t_board->doesQuietMoveGiveCheck(move);
+            if (mightSkip && futilityValue > -INFINITY && futilityValue <= t_alpha) {
+                searchAnalytics->recordFutilityPrune();
+                bestValue = std::max(bestValue, futilityValue);
+                continue;
+            }
+
             // Apply (and undo) the move to effectively temporarily generate a child state, and evaluate it
             t_board->applyMove(&move, evaluationMode);
-            const short nextTurn = (t_turn == 6 ? 1 : t_turn + 1);
-            const double val = -alphaBetaMoveSearch(t_board, t_depth - 1, -t_beta, -t_alpha, nextTurn, searchAnalytics, t_globalTurn + 1, move, t_maxDepth);
+            ++nodesEvaluated;
+            const bool followsPreviousLine = !previousLineMove.isNull() && move == previousLineMove;
+            const int reduction = mightSkip && useLateMoveReductions ? reductionTable.getReduction(t_depth, moveNumber) : 0;
+            double val = -INFINITY;
+            if (reduction > 0) {
+                // Only worth searching properly if even a shallower search says it beats alpha
+                searchAnalytics->recordLateMoveReduction();
+                val = -this->alphaBetaMoveSearch(t_board, t_depth - 1 - reduction, -t_alpha - Player::NULL_WINDOW_WIDTH, -t_alpha, nextTurn, searchAnalytics, t_context, t_globalTurn + 1, move, t_maxDepth, t_task);
+                if (val > t_alpha) {
+                    searchAnalytics->recordLateMoveResearch();
+                }
+            }
+            if (reduction == 0 || val > t_alpha) {
+                val = this->searchChild(t_board, t_depth - 1, t_alpha, t_beta, nextTurn, searchAnalytics, t_context, t_globalTurn + 1, move, t_maxDepth, t_task, isFirstChild, childLinePointer,
+                                        followsPreviousLine ? &previousContinuation : nullptr);
+            }
             t_board->undoMove(&move, evaluationMode);
+            isFirstChild = false;
 
-            bestValue = std::max(bestValue, val);
+            if (val > bestValue) {
+                bestValue = val;
+                bestMove = move;
+            }
+            if (val > t_alpha && t_pv != nullptr) {
+                t_pv->update(t_board->toCompactMove(move), childLine);
+            }
             t_alpha = std::max(t_alpha, val);
 
             // Note the use of FLOAT_FUDGE to stop rounding errors from preventing cutoffs
@@ -271,44 +664,18 @@ double Player::alphaBetaMoveSearch(Board* t_board, const int t_depth, double t_a
             }
         }
 
-        // If our heuristics didn't give us a premature cutoff, we go ahead and generate the legal moves from here
-        if (!foundCutoff) {
-
-            // Get the valid moves from this state as child nodes
-            std::vector <Move> validMoves = t_board->getLegalMoves(t_turn);
-            nodesExpanded += validMoves.size();
-            // Arrange the child nodes based on the ordering heuristic
-            this->getBrain()->sortMovesBasedOnHeuristic(validMoves);
-
-            for (auto const &move : validMoves) {
-                ++nodesEvaluated;
-                // Apply (and undo) the move to effectively temporarily generate a child state, and evaluate it
-                t_board->applyMove(&move, evaluationMode);
-                const short nextTurn = (t_turn == 6 ? 1 : t_turn + 1);
-                const double val = -alphaBetaMoveSearch(t_board, t_depth - 1, -t_beta, -t_alpha, nextTurn,
-                                                        searchAnalytics, t_globalTurn + 1, move, t_maxDepth);
-                t_board->undoMove(&move, evaluationMode);
-                if (val > bestValue) {
-                    bestValue = val;
-                    if (heuristic == Heuristic::BEST_REPLY) {
-                        this->getBrain()->getHeuristicCache().markMoveAsBestReply(move, t_parentMove);
-                    }
-                }
-                t_alpha = std::max(t_alpha, val);
-
-                // Note the use of FLOAT_FUDGE to stop rounding errors from preventing cutoffs
-                if (t_alpha + Brain::FLOAT_FUDGE >= t_beta) {
-                    // We have found a cutoff
-                    foundCutoff = true;
-                    searchAnalytics->recordCutoffAtTurn(t_globalTurn);
-                    if (heuristic == Heuristic::KILLER_MOVE) {
-                        this->getBrain()->getHeuristicCache().markMoveAsKiller(move, t_turn);
-                    } else if (heuristic == Heuristic::HISTORY) {
-                        // Note that the depth in the tree currently is t_maxDepth - t_depth
-                        this->getBrain()->getHeuristicCache().markMoveAsHistory(move, t_maxDepth - t_depth, t_turn);
-                    }
-                    break;
-                }
+        // Remember what did best here, to try it first elsewhere. Captures are tried early anyway, so killers and
+        // history are only for quiet moves
+        if (!this->isSearchStopped() && !bestMove.isNull()) {
+            const bool isQuiet = bestMove.getPieceTaken() == nullptr && bestMove.getReplacePiece() == nullptr;
+            if (heuristic == Heuristic::BEST_REPLY && !t_parentMove.isNull()) {
+                const CompactMove parentSquares (t_parentMove.getFromPosition()->getBoardIndex(), t_parentMove.getToPosition()->getBoardIndex());
+                t_context.markCounterMove(t_turn, parentSquares, t_board->toCompactMove(bestMove));
+            } else if (foundCutoff && isQuiet && heuristic == Heuristic::KILLER_MOVE) {
+                t_context.markMoveAsKiller(t_board->toCompactMove(bestMove), ply);
+            } else if (foundCutoff && isQuiet && heuristic == Heuristic::HISTORY) {
+                // Note that the depth in the tree currently is t_maxDepth - t_depth
+                t_context.markMoveAsHistory(t_board->toCompactMove(bestMove), t_maxDepth - t_depth, t_turn);
             }
         }
 
@@ -316,6 +683,17 @@ double Player::alphaBetaMoveSearch(Board* t_board, const int t_depth, double t_a
         searchAnalytics->recordNodesExpandedAtTurn(t_globalTurn, nodesExpanded);
         searchAnalytics->recordNodesEvaluatedAtTurn(t_globalTurn, nodesEvaluated);
 
+        // An abandoned search's values are meaningless, so mustn't go in the table
+        if (useTranspositionTable && !this->isSearchStopped()) {
+            BoundType bound = BoundType::EXACT;
+            if (bestValue <= originalAlpha) {
+                bound = BoundType::UPPER;
+            } else if (foundCutoff || bestValue >= t_beta) {
+                bound = BoundType::LOWER;
+            }
+            transpositionTable.store(hash, t_depth, bound, bestValue, t_board->toCompactMove(bestMove));
+        }
+
         // If we are learning, update the weights
         if (this->getBrain()->isLearning()) {
             if (foundCutoff) {
@@ -333,4 +711,67 @@ double Player::alphaBetaMoveSearch(Board* t_board, const int t_depth, double t_a
         return bestValue;
     }
 
-}
\ No newline at end of file
+}
+
+double Player::quiescenceSearch(Board* t_board, double t_alpha, double t_beta, const short t_turn, SearchAnalytics* searchAnalytics, const int t_quiescenceDepth, const SearchTask* t_task) const {
+    if (m_stopSearch.load(std::memory_order_relaxed) || (m_timeManager != nullptr && m_timeManager->pollHardLimit()) ||
+        (t_task != nullptr && t_task->isAborted())) {
+        return 0;
+    }
+
+    searchAnalytics->recordQuiescenceNode();
+    if (t_board->isTerminal()) {
+        return -1 * Brain::WINNING_MOVE_SCORE;
+    }
+
+    // Unless in check, the player to move can decline every capture, so is worth at least the static evaluation ("standing pat")
+    // In check there's no such option, and every escape has to be looked at
+    const bool inCheck = t_board->isPlayerInCheck(t_turn);
+    double bestValue = -INFINITY;
+    if (!inCheck || t_quiescenceDepth >= Player::MAX_QUIESCENCE_DEPTH) {
+        const double standPat = this->getBrain()->evaluateBoardState(*t_board, t_turn);
+        if (t_quiescenceDepth >= Player::MAX_QUIESCENCE_DEPTH) {
+            return standPat;
+        }
+        if (standPat + Brain::FLOAT_FUDGE >= t_beta) {
+            searchAnalytics->recordQuiescenceCutoff();
+            return standPat;
+        }
+        bestValue = standPat;
+        t_alpha = std::max(t_alpha, standPat);
+    }
+
+    MoveList tacticalMoves;
+    t_board->getTacticalMoves(t_turn, tacticalMoves);
+    if (tacticalMoves.empty()) {
+        // In check with nowhere to go: as good as stuck, but the game carries on without us
+        return inCheck ? this->getBrain()->evaluateBoardState(*t_board, t_turn) : bestValue;
+    }
+    // Biggest captures first
+    this->getBrain()->sortMovesBasedOnHeuristic(tacticalMoves);
+
+    double pieceValues[9];
+    this->getBrain()->getPieceValues(pieceValues);
+
+    const EvaluationMode evaluationMode = this->getBrain()->getEvaluationMode();
+    const short nextTurn = (t_turn == 6 ? 1 : t_turn + 1);
+    for (auto const& move : tacticalMoves) {
+        // Captures that lose material once everyone has retaken aren't worth looking at, unless we have to get out
+        // of check
+        if (!inCheck && t_board->getStaticExchangeEvaluation(move, pieceValues) < 0) {
+            continue;
+        }
+        t_board->applyMove(&move, evaluationMode);
+        const double val = -this->quiescenceSearch(t_board, -t_beta, -t_alpha, nextTurn, searchAnalytics, t_quiescenceDepth + 1, t_task);
+        t_board->undoMove(&move, evaluationMode);
+
+        bestValue = std::max(bestValue, val);
+        t_alpha = std::max(t_alpha, val);
+        if (t_alpha + Brain::FLOAT_FUDGE >= t_beta) {
+            searchAnalytics->recordQuiescenceCutoff();
+            break;
+        }
+    }
+
+    return bestValue;
+}
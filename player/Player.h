@@ -4,23 +4,66 @@
 #include "PlayerType.h"
 #include "Brain.h"
 #include "SearchAnalytics.h"
+#include "SearchTask.h"
+#include "TimeManager.h"
+#include "TimeControl.h"
+#include "PrincipalVariation.h"
+#include "SearchContext.h"
 
 #include "../game/GameResult.h"
 
 #include "../duchess/Board.h"
 #include "../duchess/Move.h"
+#include "../duchess/MoveList.h"
+
+#include <atomic>
 
 class Player {
 public:
     Player(const PlayerType t_playerType, short t_playerNumber) :
-            m_playerType(t_playerType), m_playerNumber(t_playerNumber), m_stochastic(false)
+            m_playerType(t_playerType), m_playerNumber(t_playerNumber), m_stochastic(false), m_stopSearch(false),
+            m_timeManager(nullptr)
             {}
 
-    Move chooseMove(Board* t_board, const int t_globalTurn);
-    Move searchForMove(Board* t_board, const std::vector<Move> t_validMoves, const int t_globalTurn);
-    Move alphaBetaFromRoot(std::vector<Move> t_validMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* searchAnalytics, const int t_globalTurn) const;
-    double alphaBetaMoveSearch(Board* t_board, const int t_depth, double t_alpha, double t_beta, const short t_turn, SearchAnalytics* searchAnalytics, const int t_globalTurn, const Move& t_parentMove, const int t_maxDepth) const;
+    // t_timeControl decides how long the search may take (see TimeControl and TimeManager)
+    Move chooseMove(Board* t_board, const int t_globalTurn,
+                    const TimeControl& t_timeControl = TimeControl::perMove(TimeManager::DEFAULT_BUDGET_MILLIS));
+    Move searchForMove(Board* t_board, const MoveList& t_validMoves, const int t_globalTurn,
+                       const TimeControl& t_timeControl = TimeControl::perMove(TimeManager::DEFAULT_BUDGET_MILLIS));
+    // As above, but fills in t_analytics (aggregated over all search threads) for the caller
+    Move searchForMove(Board* t_board, const MoveList& t_validMoves, const int t_globalTurn, SearchAnalytics& t_analytics,
+                       const TimeControl& t_timeControl = TimeControl::perMove(TimeManager::DEFAULT_BUDGET_MILLIS));
+    // Searches with a SearchContext of its own, so nothing learnt about move ordering is kept afterwards
+    Move alphaBetaFromRoot(MoveList t_validMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* searchAnalytics, const int t_globalTurn) const;
+    // As above, but with t_context's killers, history and best replies (which it adds to), only scores within the
+    // window (t_alpha, t_beta) are exact, and t_rootMoves are searched in the order given rather than sorted first.
+    // Afterwards they're left ordered by score, best first, ready for the next iteration of iterative deepening
+    // t_score is set to the best move's score, which is just a bound if it's outside the window, and t_pv to the line
+    // the search expects to be played from here. t_previousLine is the last iteration's line, if there was one
+    Move alphaBetaFromRoot(MoveList& t_rootMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* searchAnalytics, SearchContext& t_context, const int t_globalTurn, double t_alpha, const double t_beta, double& t_score, PrincipalVariation& t_pv, const PrincipalVariation* t_previousLine = nullptr) const;
+    // t_task is the parallel search task this node is part of (see YoungBrothersWaitSearch), if any
+    // If t_pv is given, it's filled in with the line expected from here whenever the score is within the window
+    // If this node is on the line the last iteration expected, t_previousLine is what that line expected from here,
+    // and its first move is searched before any other
+    // t_allowNullMove is false for the search verifying a null move cutoff, which mustn't try another one straight away
+    double alphaBetaMoveSearch(Board* t_board, const int t_depth, double t_alpha, double t_beta, const short t_turn, SearchAnalytics* searchAnalytics, SearchContext& t_context, const int t_globalTurn, const Move& t_parentMove, const int t_maxDepth, const SearchTask* t_task = nullptr, PrincipalVariation* t_pv = nullptr, const PrincipalVariation* t_previousLine = nullptr, const bool t_allowNullMove = true) const;
+    // Carries on from a leaf of alphaBetaMoveSearch through captures, vortex pawn replacements and escapes from check
+    // only, so that positions are evaluated once they've settled rather than part way through an exchange
+    // t_quiescenceDepth is how many plies of this have been searched so far
+    double quiescenceSearch(Board* t_board, double t_alpha, double t_beta, const short t_turn, SearchAnalytics* searchAnalytics, const int t_quiescenceDepth, const SearchTask* t_task = nullptr) const;
+    // Whether passing the turn says anything about t_turn's position: not if they're in check, are short of pieces,
+    // or the other team could mate. t_beta is the score a null move would have to reach
+    bool isNullMoveSafe(const Board& t_board, const short t_turn, const double t_beta) const;
     void notifyResult(const GameResult t_result);
+    // True once the search in progress should be abandoned, either because the main search is done with the helpers
+    // or because the hard time limit has passed. Searches in that state return meaningless values
+    bool isSearchStopped() const;
+
+    // The line the last call to searchForMove expected to be played, starting with the move it chose, as of its
+    // deepest completed iteration. Young Brothers Wait searches only give the move itself
+    const PrincipalVariation& getPrincipalVariation() const {
+        return m_principalVariation;
+    }
 
     PlayerType getPlayerType() const {
         return this->m_playerType;
@@ -53,14 +96,62 @@ public:
     // AI will do random moves for the first few moves
     constexpr static int AI_RANDOM_MOVE_THRESHOLD {6};
     constexpr static double RANDOM_MOVE_CHANCE {0.05};
+    // With six players taking in turn, exchanges could otherwise go on for a very long time
+    constexpr static int MAX_QUIESCENCE_DEPTH {4};
+    // How far either side of the last iteration's score the next one first looks (about a pawn with the material
+    // weights), and how much the window grows each time the score falls outside it. After MAX_ASPIRATION_FAILURES
+    // the failing side is opened up completely
+    constexpr static double ASPIRATION_WINDOW {0.05};
+    constexpr static double ASPIRATION_WIDENING {4};
+    constexpr static int MAX_ASPIRATION_FAILURES {3};
+    // Width of the windows principal variation search uses to test whether a move beats the best so far
+    constexpr static double NULL_WINDOW_WIDTH {1e-7};
+    // Null move pruning searches NULL_MOVE_REDUCTION plies less deeply than moving would, and only at nodes at least
+    // NULL_MOVE_MIN_DEPTH from the leaves where the player to move has at least NULL_MOVE_MIN_PIECES pieces other
+    // than pawns and their king
+    constexpr static int NULL_MOVE_REDUCTION {2};
+    constexpr static int NULL_MOVE_MIN_DEPTH {3};
+    constexpr static int NULL_MOVE_MIN_PIECES {2};
+    // Futility pruning looks at quiet moves at most FUTILITY_MAX_DEPTH plies from the leaves, and allows for them
+    // changing the score by up to FUTILITY_MARGIN for each of those plies on top of the material balance
+    constexpr static int FUTILITY_MAX_DEPTH {2};
+    constexpr static double FUTILITY_MARGIN {0.1};
 
 private:
-    Move chooseMoveAsHuman(Board* t_board, const std::vector<Move>* t_moves) const;
+    Move chooseMoveAsHuman(Board* t_board, const MoveList* t_moves) const;
+    // Whether searches are split between threads with YoungBrothersWaitSearch rather than using Lazy SMP helpers
+    bool usesYoungBrothersWait() const;
+    // Whether to use principal variation search and aspiration windows. Learning trains from full window searches
+    bool usesPrincipalVariationSearch() const;
+    // Whether to try null move pruning. Learning trains from every node, so never prunes
+    bool usesNullMovePruning() const;
+    // Whether to try late move reductions and futility pruning. Learning trains from every node, so never does either
+    bool usesLateMoveReductions() const;
+    bool usesFutilityPruning() const;
+    // Whether leaves are extended through captures. Learning trains on the evaluation at the leaves themselves
+    bool usesQuiescenceSearch() const;
+    // alphaBetaFromRoot with an aspiration window around t_score (the last iteration's score), widened until the score
+    // falls inside it. t_score is then set to the new score
+    Move aspirationSearchFromRoot(MoveList& t_rootMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* searchAnalytics, SearchContext& t_context, const int t_globalTurn, double& t_score, PrincipalVariation& t_pv, const PrincipalVariation* t_previousLine) const;
+    // Searches the child t_board has just moved to by t_move, and returns its score from the parent's point of view
+    // t_depth and t_turn are the child's, the window is the parent's. Unless t_isFirstChild, principal variation
+    // search first checks whether the child beats t_alpha with a null window, and only searches it properly if it
+    // does. t_childLine is filled in with the child's line when that's worth knowing, and t_previousLine is passed on
+    double searchChild(Board* t_board, const int t_depth, const double t_alpha, const double t_beta, const short t_turn, SearchAnalytics* searchAnalytics, SearchContext& t_context, const int t_globalTurn, const Move& t_move, const int t_maxDepth, const SearchTask* t_task, const bool t_isFirstChild, PrincipalVariation* t_childLine, const PrincipalVariation* t_previousLine) const;
+    // Lazy SMP helper: iteratively deepens on its own copy of the board until m_stopSearch is set
+    // Its results only reach the main search through the brain's transposition table
+    void runHelperSearch(Board* t_board, MoveList* t_validMoves, const int t_globalTurn, const int t_maxDepth, const int t_helperNumber, SearchAnalytics* t_analytics, SearchContext* t_context) const;
 
     const PlayerType m_playerType;
     short m_playerNumber;
     bool m_stochastic;
-
+    // Set once the main search thread has its move, so that helper threads abandon whatever they're searching
+    std::atomic<bool> m_stopSearch;
+    // The hard time limit of the search in progress, if it has one
+    const TimeManager* m_timeManager;
+    PrincipalVariation m_principalVariation;
+    // Killers, history and best replies for the main search thread, kept from one move to the next
+    SearchContext m_searchContext;
 
     // If we're an AI, we need a brain to store things like paths to weights files
     Brain* m_brain;
@@ -0,0 +1,68 @@
+#ifndef DUCHESS_CPP_PRINCIPALVARIATION_H
+#define DUCHESS_CPP_PRINCIPALVARIATION_H
+
+#include "../duchess/CompactMove.h"
+
+#include <cassert>
+
+// The line of play a search expects: its best move, the best reply to that, and so on
+// Each node of the search builds its own from the line of its best child, so it's fixed capacity to live on the stack
+// Moves are packed (see CompactMove), and each one is meant for the board reached by playing those before it
+class PrincipalVariation {
+public:
+    // Deeper than any search goes
+    static const unsigned int CAPACITY = 32;
+
+    PrincipalVariation() : m_length(0) { }
+
+    void clear() {
+        m_length = 0;
+    }
+
+    // Becomes t_move followed by t_continuation (cut short if that won't fit)
+    void update(const CompactMove t_move, const PrincipalVariation& t_continuation) {
+        m_moves[0] = t_move;
+        m_length = 1;
+        unsigned int i;
+        for (i = 0; i < t_continuation.size() && m_length < CAPACITY; ++i) {
+            m_moves[m_length++] = t_continuation[i];
+        }
+    }
+
+    // The line after its first move, i.e. what's expected from the position that move leads to
+    PrincipalVariation getContinuation() const {
+        PrincipalVariation continuation;
+        unsigned int i;
+        for (i = 1; i < m_length; ++i) {
+            continuation.m_moves[continuation.m_length++] = m_moves[i];
+        }
+        return continuation;
+    }
+
+    unsigned int size() const {
+        return m_length;
+    }
+
+    bool empty() const {
+        return m_length == 0;
+    }
+
+    CompactMove operator[](const unsigned int t_i) const {
+        assert(t_i < m_length);
+        return m_moves[t_i];
+    }
+
+    const CompactMove* begin() const {
+        return m_moves;
+    }
+
+    const CompactMove* end() const {
+        return m_moves + m_length;
+    }
+
+private:
+    CompactMove m_moves[CAPACITY];
+    unsigned int m_length;
+};
+
+#endif //DUCHESS_CPP_PRINCIPALVARIATION_H
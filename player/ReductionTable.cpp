@@ -0,0 +1,30 @@
+#define NDEBUG
+
+#include "ReductionTable.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+ReductionTable::ReductionTable(const double t_base, const double t_divisor, const int t_fullDepthMoves) :
+        m_base(t_base), m_divisor(t_divisor), m_fullDepthMoves(t_fullDepthMoves),
+        m_reductions((ReductionTable::MAX_DEPTH + 1) * (ReductionTable::MAX_MOVE_NUMBER + 1), 0) {
+    int depth;
+    int moveNumber;
+    for (depth = 1; depth <= ReductionTable::MAX_DEPTH; ++depth) {
+        for (moveNumber = m_fullDepthMoves + 1; moveNumber <= ReductionTable::MAX_MOVE_NUMBER; ++moveNumber) {
+            const int reduction = int(std::floor(m_base + std::log(depth) * std::log(moveNumber) / m_divisor));
+            // The child is already a ply down, and still gets at least one ply of its own
+            m_reductions[depth * (ReductionTable::MAX_MOVE_NUMBER + 1) + moveNumber] = std::max(0, std::min(reduction, depth - 2));
+        }
+    }
+}
+
+int ReductionTable::getReduction(const int t_depth, const int t_moveNumber) const {
+    if (t_depth < 1 || t_moveNumber < 1) {
+        return 0;
+    }
+    const int depth = std::min(t_depth, int(ReductionTable::MAX_DEPTH));
+    const int moveNumber = std::min(t_moveNumber, int(ReductionTable::MAX_MOVE_NUMBER));
+    return m_reductions[depth * (ReductionTable::MAX_MOVE_NUMBER + 1) + moveNumber];
+}
@@ -0,0 +1,47 @@
+#ifndef DUCHESS_CPP_REDUCTIONTABLE_H
+#define DUCHESS_CPP_REDUCTIONTABLE_H
+
+#include <vector>
+
+// Late move reductions: how many plies less deeply Player::alphaBetaMoveSearch searches a quiet move, given how far
+// the node is from the leaves and how late the move comes in its ordering
+// The first t_fullDepthMoves moves of a node are never reduced, and after that a move is reduced by
+// floor(t_base + ln(depth) * ln(move number) / t_divisor), so later moves in deeper nodes are reduced most. A reduced
+// search is always left at least one ply
+// Worked out up front for every depth and move number, so the search only has to look it up
+class ReductionTable {
+public:
+    ReductionTable(const double t_base = ReductionTable::DEFAULT_BASE, const double t_divisor = ReductionTable::DEFAULT_DIVISOR,
+                   const int t_fullDepthMoves = ReductionTable::DEFAULT_FULL_DEPTH_MOVES);
+
+    // t_depth is how many plies the node is from the leaves, and t_moveNumber counts from 1 for the first move searched
+    // Anything beyond MAX_DEPTH or MAX_MOVE_NUMBER is treated as if it were at the limit
+    int getReduction(const int t_depth, const int t_moveNumber) const;
+
+    double getBase() const {
+        return m_base;
+    }
+
+    double getDivisor() const {
+        return m_divisor;
+    }
+
+    int getFullDepthMoves() const {
+        return m_fullDepthMoves;
+    }
+
+    constexpr static double DEFAULT_BASE {0.75};
+    constexpr static double DEFAULT_DIVISOR {2.25};
+    constexpr static int DEFAULT_FULL_DEPTH_MOVES {3};
+    constexpr static int MAX_DEPTH {32};
+    constexpr static int MAX_MOVE_NUMBER {128};
+
+private:
+    double m_base;
+    double m_divisor;
+    int m_fullDepthMoves;
+    // [depth][move number], flattened
+    std::vector<int> m_reductions;
+};
+
+#endif //DUCHESS_CPP_REDUCTIONTABLE_H
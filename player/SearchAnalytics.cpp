@@ -5,7 +5,12 @@
 #include <sstream>
 
 SearchAnalytics::SearchAnalytics(const int t_turnNumber, const int t_numPiecesOnBoard) :
-        m_turnNumber(t_turnNumber), m_numPiecesOnBoard(t_numPiecesOnBoard), m_lowestDepth(0) {
+        m_turnNumber(t_turnNumber), m_numPiecesOnBoard(t_numPiecesOnBoard), m_lowestDepth(0),
+        m_transpositionProbes(0), m_transpositionHits(0), m_transpositionCutoffs(0),
+        m_quiescenceNodes(0), m_quiescenceCutoffs(0), m_nullWindowResearches(0), m_aspirationFailures(0),
+        m_nullMoveSearches(0), m_nullMoveCutoffs(0), m_nullMoveVerificationFailures(0),
+        m_lateMoveReductions(0), m_lateMoveResearches(0), m_futilityPrunes(0),
+        m_searchDepth(0), m_numThreads(1) {
     m_cutoffsAtDepth.reserve(SearchAnalytics::MAX_DEPTH_RECORD);
     m_nodesExpandedAtDepth.reserve(SearchAnalytics::MAX_DEPTH_RECORD);
     m_nodesEvaluatedAtDepth.reserve(SearchAnalytics::MAX_DEPTH_RECORD);
@@ -66,17 +71,118 @@ void SearchAnalytics::recordNodesEvaluatedAtTurn(const int t_globalTurn, const i
     this->recordNodesEvaluatedAtDepth(t_globalTurn - m_turnNumber, t_numNodes);
 }
 
+void SearchAnalytics::recordTranspositionProbe(const bool t_hit) {
+    ++m_transpositionProbes;
+    if (t_hit) {
+        ++m_transpositionHits;
+    }
+}
+
+void SearchAnalytics::recordTranspositionCutoff() {
+    ++m_transpositionCutoffs;
+}
+
+void SearchAnalytics::recordQuiescenceNode() {
+    ++m_quiescenceNodes;
+}
+
+void SearchAnalytics::recordQuiescenceCutoff() {
+    ++m_quiescenceCutoffs;
+}
+
+void SearchAnalytics::recordNullWindowResearch() {
+    ++m_nullWindowResearches;
+}
+
+void SearchAnalytics::recordAspirationFailure() {
+    ++m_aspirationFailures;
+}
+
+void SearchAnalytics::recordNullMoveSearch() {
+    ++m_nullMoveSearches;
+}
+
+void SearchAnalytics::recordNullMoveCutoff() {
+    ++m_nullMoveCutoffs;
+}
+
+void SearchAnalytics::recordNullMoveVerificationFailure() {
+    ++m_nullMoveVerificationFailures;
+}
+
+void SearchAnalytics::recordLateMoveReduction() {
+    ++m_lateMoveReductions;
+}
+
+void SearchAnalytics::recordLateMoveResearch() {
+    ++m_lateMoveResearches;
+}
+
+void SearchAnalytics::recordFutilityPrune() {
+    ++m_futilityPrunes;
+}
+
+double SearchAnalytics::getTranspositionHitRate() const {
+    return m_transpositionProbes == 0 ? 0 : double(m_transpositionHits) / m_transpositionProbes;
+}
+
+double SearchAnalytics::getTranspositionCutoffRate() const {
+    return m_transpositionProbes == 0 ? 0 : double(m_transpositionCutoffs) / m_transpositionProbes;
+}
+
+long SearchAnalytics::getTotalNodesEvaluated() const {
+    long total = 0;
+    for (auto const& nodeEvaluationCount : m_nodesEvaluatedAtDepth) {
+        total += nodeEvaluationCount;
+    }
+    return total;
+}
+
+void SearchAnalytics::merge(const SearchAnalytics& t_other) {
+    int i;
+    for (i = 0; i < SearchAnalytics::MAX_DEPTH_RECORD; ++i) {
+        m_cutoffsAtDepth[i] += t_other.m_cutoffsAtDepth[i];
+        m_nodesExpandedAtDepth[i] += t_other.m_nodesExpandedAtDepth[i];
+        m_nodesEvaluatedAtDepth[i] += t_other.m_nodesEvaluatedAtDepth[i];
+    }
+    m_transpositionProbes += t_other.m_transpositionProbes;
+    m_transpositionHits += t_other.m_transpositionHits;
+    m_transpositionCutoffs += t_other.m_transpositionCutoffs;
+    m_quiescenceNodes += t_other.m_quiescenceNodes;
+    m_quiescenceCutoffs += t_other.m_quiescenceCutoffs;
+    m_nullWindowResearches += t_other.m_nullWindowResearches;
+    m_aspirationFailures += t_other.m_aspirationFailures;
+    m_nullMoveSearches += t_other.m_nullMoveSearches;
+    m_nullMoveCutoffs += t_other.m_nullMoveCutoffs;
+    m_nullMoveVerificationFailures += t_other.m_nullMoveVerificationFailures;
+    m_lateMoveReductions += t_other.m_lateMoveReductions;
+    m_lateMoveResearches += t_other.m_lateMoveResearches;
+    m_futilityPrunes += t_other.m_futilityPrunes;
+}
 
 void SearchAnalytics::reset() {
     m_cutoffsAtDepth.assign(MAX_DEPTH_RECORD, 0);
     m_nodesExpandedAtDepth.assign(MAX_DEPTH_RECORD, 0);
     m_nodesEvaluatedAtDepth.assign(MAX_DEPTH_RECORD, 0);
+    m_transpositionProbes = 0;
+    m_transpositionHits = 0;
+    m_transpositionCutoffs = 0;
+    m_quiescenceNodes = 0;
+    m_quiescenceCutoffs = 0;
+    m_nullWindowResearches = 0;
+    m_aspirationFailures = 0;
+    m_nullMoveSearches = 0;
+    m_nullMoveCutoffs = 0;
+    m_nullMoveVerificationFailures = 0;
+    m_lateMoveReductions = 0;
+    m_lateMoveResearches = 0;
+    m_futilityPrunes = 0;
 }
 
 std::string SearchAnalytics::toString() const {
     std::stringstream result;
 
-    // TURN_NUMBER, MAX_DEPTH, DURATION, forall cutoffs(CUTOFF), forall nodes (NODES)
+    // TURN_NUMBER, MAX_DEPTH, DURATION, forall cutoffs(CUTOFF), forall nodes (NODES), TT_PROBES, TT_HITS, TT_CUTOFFS, SEARCH_DEPTH, THREADS, Q_NODES, Q_CUTOFFS, NW_RESEARCHES, ASP_FAILURES, NM_SEARCHES, NM_CUTOFFS, NM_VERIFICATION_FAILURES, LMR_REDUCTIONS, LMR_RESEARCHES, FUTILITY_PRUNES
 
     result << this->getTurnNumber() << ", ";
     result << this->getNumPiecesOnBoard() << ", ";
@@ -95,6 +201,22 @@ std::string SearchAnalytics::toString() const {
         result << ", " << nodeEvaluationCount;
     }
 
+    result << ", " << this->getTranspositionProbes();
+    result << ", " << this->getTranspositionHits();
+    result << ", " << this->getTranspositionCutoffs();
+    result << ", " << this->getSearchDepth();
+    result << ", " << this->getNumThreads();
+    result << ", " << this->getQuiescenceNodes();
+    result << ", " << this->getQuiescenceCutoffs();
+    result << ", " << this->getNullWindowResearches();
+    result << ", " << this->getAspirationFailures();
+    result << ", " << this->getNullMoveSearches();
+    result << ", " << this->getNullMoveCutoffs();
+    result << ", " << this->getNullMoveVerificationFailures();
+    result << ", " << this->getLateMoveReductions();
+    result << ", " << this->getLateMoveResearches();
+    result << ", " << this->getFutilityPrunes();
+
     return result.str();
 }
 
@@ -106,14 +228,19 @@ std::string SearchAnalytics::toShortString() const {
     result << "Turn: " << this->getTurnNumber() << ", ";
     result << "# Pieces: " << this->getNumPiecesOnBoard() << ", ";
     result << "Max depth: " << this->getLowestDepth() << ", ";
-    result << "Duration: " << this->getDurationInMillis();
+    result << "Search depth: " << this->getSearchDepth() << ", ";
+    result << "Threads: " << this->getNumThreads() << ", ";
+    result << "Duration: " << this->getDurationInMillis() << ", ";
+    result << "TT hit rate: " << this->getTranspositionHitRate() << ", ";
+    result << "TT cutoff rate: " << this->getTranspositionCutoffRate() << ", ";
+    result << "Quiescence nodes: " << this->getQuiescenceNodes();
 
     return result.str();
 }
 
 std::string SearchAnalytics::getHeader() {
     std::stringstream result;
-    // TURN_NUMBER, MAX_DEPTH, DURATION, forall cutoffs(CUTOFF), forall nodes (NODES)
+    // TURN_NUMBER, MAX_DEPTH, DURATION, forall cutoffs(CUTOFF), forall nodes (NODES), TT_PROBES, TT_HITS, TT_CUTOFFS, SEARCH_DEPTH, THREADS, Q_NODES, Q_CUTOFFS, NW_RESEARCHES, ASP_FAILURES, NM_SEARCHES, NM_CUTOFFS, NM_VERIFICATION_FAILURES, LMR_REDUCTIONS, LMR_RESEARCHES, FUTILITY_PRUNES
     result << "Turn number, ";
     result << "Pieces on board, ";
     result << "Maximum depth, ";
@@ -132,5 +259,21 @@ std::string SearchAnalytics::getHeader() {
         result << ", Nodes evaluated at depth " << i;
     }
 
+    result << ", Transposition probes";
+    result << ", Transposition hits";
+    result << ", Transposition cutoffs";
+    result << ", Search depth";
+    result << ", Threads";
+    result << ", Quiescence nodes";
+    result << ", Quiescence cutoffs";
+    result << ", Null window re-searches";
+    result << ", Aspiration failures";
+    result << ", Null move searches";
+    result << ", Null move cutoffs";
+    result << ", Null move verification failures";
+    result << ", Late move reductions";
+    result << ", Late move re-searches";
+    result << ", Futility prunes";
+
     return result.str();
 }
\ No newline at end of file
@@ -23,6 +23,30 @@ public:
     void recordNodesExpandedAtTurn(const int t_globalTurn, const int t_numNodes);
     void recordNodesEvaluatedAtTurn(const int t_globalTurn, const int t_numNodes);
 
+    void recordTranspositionProbe(const bool t_hit);
+    void recordTranspositionCutoff();
+
+    // Quiescence search nodes aren't counted at any depth, just here
+    void recordQuiescenceNode();
+    void recordQuiescenceCutoff();
+
+    // Principal variation search: a null window search that had to be repeated with the full window, and a root
+    // search that fell outside its aspiration window
+    void recordNullWindowResearch();
+    void recordAspirationFailure();
+
+    // Null move pruning: a null move searched, one that cut the node short (once verified), and one that failed high
+    // but whose verification search didn't
+    void recordNullMoveSearch();
+    void recordNullMoveCutoff();
+    void recordNullMoveVerificationFailure();
+
+    // Late move reductions: a move searched less deeply first, and one that then had to be searched properly. And a
+    // quiet move that futility pruning didn't search at all
+    void recordLateMoveReduction();
+    void recordLateMoveResearch();
+    void recordFutilityPrune();
+
     int getCutoffsAtDepth(const int t_depth) const {
         return m_cutoffsAtDepth[t_depth];
     }
@@ -35,6 +59,63 @@ public:
         return m_nodesEvaluatedAtDepth[t_depth];
     }
 
+    int getTranspositionProbes() const {
+        return m_transpositionProbes;
+    }
+
+    int getTranspositionHits() const {
+        return m_transpositionHits;
+    }
+
+    int getTranspositionCutoffs() const {
+        return m_transpositionCutoffs;
+    }
+
+    int getQuiescenceNodes() const {
+        return m_quiescenceNodes;
+    }
+
+    // Including stand pat cutoffs
+    int getQuiescenceCutoffs() const {
+        return m_quiescenceCutoffs;
+    }
+
+    int getNullWindowResearches() const {
+        return m_nullWindowResearches;
+    }
+
+    int getAspirationFailures() const {
+        return m_aspirationFailures;
+    }
+
+    int getNullMoveSearches() const {
+        return m_nullMoveSearches;
+    }
+
+    int getNullMoveCutoffs() const {
+        return m_nullMoveCutoffs;
+    }
+
+    int getNullMoveVerificationFailures() const {
+        return m_nullMoveVerificationFailures;
+    }
+
+    int getLateMoveReductions() const {
+        return m_lateMoveReductions;
+    }
+
+    int getLateMoveResearches() const {
+        return m_lateMoveResearches;
+    }
+
+    int getFutilityPrunes() const {
+        return m_futilityPrunes;
+    }
+
+    // Fraction of probes that found an entry, and fraction that ended the search at that node
+    double getTranspositionHitRate() const;
+    double getTranspositionCutoffRate() const;
+
     int getLowestDepth() const {
         return m_lowestDepth;
     }
@@ -43,6 +124,30 @@ public:
         return m_numPiecesOnBoard;
     }
 
+    // The deepest iteration of iterative deepening that finished
+    int getSearchDepth() const {
+        return m_searchDepth;
+    }
+
+    void setSearchDepth(const int t_searchDepth) {
+        m_searchDepth = t_searchDepth;
+    }
+
+    int getNumThreads() const {
+        return m_numThreads;
+    }
+
+    void setNumThreads(const int t_numThreads) {
+        m_numThreads = t_numThreads;
+    }
+
+    // Nodes evaluated at every depth put together
+    long getTotalNodesEvaluated() const;
+
+    // Adds the counts from another thread's search of the same position into these
+    // Depths, timings and the thread count are left as they are
+    void merge(const SearchAnalytics& t_other);
+
     void reset();
     void startTiming();
     void stopTiming();
@@ -63,6 +168,21 @@ private:
     std::vector<int> m_cutoffsAtDepth;
     std::vector<int> m_nodesExpandedAtDepth;
     std::vector<int> m_nodesEvaluatedAtDepth;
+    int m_transpositionProbes;
+    int m_transpositionHits;
+    int m_transpositionCutoffs;
+    int m_quiescenceNodes;
+    int m_quiescenceCutoffs;
+    int m_nullWindowResearches;
+    int m_aspirationFailures;
+    int m_nullMoveSearches;
+    int m_nullMoveCutoffs;
+    int m_nullMoveVerificationFailures;
+    int m_lateMoveReductions;
+    int m_lateMoveResearches;
+    int m_futilityPrunes;
+    int m_searchDepth;
+    int m_numThreads;
     std::chrono::high_resolution_clock::time_point m_startTime;
     std::chrono::high_resolution_clock::time_point m_endTime;
 };
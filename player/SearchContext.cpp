@@ -0,0 +1,119 @@
+#define NDEBUG
+
+#include "SearchContext.h"
+
+#include "../duchess/CompactMove.h"
+#include "../duchess/PositionUtils.h"
+
+#include <vector>
+#include <algorithm>
+
+SearchContext::SearchContext() :
+        m_rootTurn(0), m_hasSearched(false), m_tableOwner(nullptr),
+        m_history(6 * PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER * PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER),
+        m_counterMoves(2 * 6 * PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER * PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER) { }
+
+SearchContext::SearchContext(const SearchContext* t_tableOwner) :
+        m_rootTurn(0), m_hasSearched(false), m_tableOwner(t_tableOwner) { }
+
+SearchContext SearchContext::sharingTablesWith(const SearchContext& t_parent) {
+    // Always the context that actually has the tables, however many tasks deep t_parent is
+    SearchContext context (t_parent.m_tableOwner == nullptr ? &t_parent : t_parent.m_tableOwner);
+    context.m_rootTurn = t_parent.m_rootTurn;
+    context.m_hasSearched = t_parent.m_hasSearched;
+    std::copy(&t_parent.m_killers[0][0], &t_parent.m_killers[0][0] + SearchContext::MAX_PLY * SearchContext::KILLERS_PER_PLY,
+              &context.m_killers[0][0]);
+    return context;
+}
+
+void SearchContext::startSearch(const int t_globalTurn) {
+    // A node t_globalTurn - m_rootTurn plies further down last time is now that much nearer the root
+    // Going back a turn (e.g. a new game) means nothing can be carried over
+    const int turnsPassed = m_hasSearched && t_globalTurn >= m_rootTurn ? t_globalTurn - m_rootTurn : SearchContext::MAX_PLY;
+    int ply;
+    unsigned int slot;
+    for (ply = 0; ply < SearchContext::MAX_PLY; ++ply) {
+        for (slot = 0; slot < SearchContext::KILLERS_PER_PLY; ++slot) {
+            m_killers[ply][slot] = ply + turnsPassed < SearchContext::MAX_PLY ? m_killers[ply + turnsPassed][slot] : CompactMove();
+        }
+    }
+
+    short player;
+    for (player = 1; player <= 6; ++player) {
+        this->decayHistory(player);
+    }
+
+    m_rootTurn = t_globalTurn;
+    m_hasSearched = true;
+}
+
+void SearchContext::markMoveAsKiller(const CompactMove t_move, const int t_ply) {
+    if (t_move.isNull() || t_ply < 0 || t_ply >= SearchContext::MAX_PLY) {
+        return;
+    }
+    CompactMove* killers = m_killers[t_ply];
+    if (killers[0] == t_move) {
+        return;
+    }
+    // Everything shuffles down a slot, and the oldest falls off the end
+    unsigned int slot;
+    for (slot = SearchContext::KILLERS_PER_PLY - 1; slot > 0; --slot) {
+        killers[slot] = killers[slot - 1];
+    }
+    killers[0] = t_move;
+}
+
+CompactMove SearchContext::getKiller(const int t_ply, const unsigned int t_slot) const {
+    if (t_ply < 0 || t_ply >= SearchContext::MAX_PLY || t_slot >= SearchContext::KILLERS_PER_PLY) {
+        return CompactMove();
+    }
+    return m_killers[t_ply][t_slot];
+}
+
+bool SearchContext::isMoveKiller(const CompactMove t_move, const int t_ply) const {
+    unsigned int slot;
+    for (slot = 0; slot < SearchContext::KILLERS_PER_PLY; ++slot) {
+        if (!t_move.isNull() && this->getKiller(t_ply, slot) == t_move) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SearchContext::markMoveAsHistory(const CompactMove t_move, const int t_weight, const short t_player) {
+    if (t_move.isNull() || m_tableOwner != nullptr) {
+        return;
+    }
+    unsigned int& score = m_history[SearchContext::squaresIndex(t_player, t_move.getFromIndex(), t_move.getToIndex())];
+    score += t_weight * t_weight;
+    if (score > SearchContext::MAX_HISTORY_SCORE) {
+        this->decayHistory(t_player);
+    }
+}
+
+void SearchContext::decayHistory(const short t_player) {
+    if (m_tableOwner != nullptr) {
+        return;
+    }
+    const std::size_t start = SearchContext::squaresIndex(t_player, 0, 0);
+    const std::size_t end = SearchContext::squaresIndex(t_player + 1, 0, 0);
+    std::size_t i;
+    for (i = start; i < end; ++i) {
+        m_history[i] /= 2;
+    }
+}
+
+void SearchContext::markCounterMove(const short t_player, const CompactMove t_parent, const CompactMove t_move) {
+    if (m_tableOwner != nullptr) {
+        return;
+    }
+    const std::size_t entry = 2 * SearchContext::squaresIndex(t_player, t_parent.getFromIndex(), t_parent.getToIndex());
+    m_counterMoves[entry] = t_move.getFromIndex();
+    m_counterMoves[entry + 1] = t_move.getToIndex();
+}
+
+CompactMove SearchContext::getCounterMove(const short t_player, const CompactMove t_parent) const {
+    const std::size_t entry = 2 * SearchContext::squaresIndex(t_player, t_parent.getFromIndex(), t_parent.getToIndex());
+    const std::vector<BoardIndex>& counterMoves = this->getCounterMoves();
+    return CompactMove(counterMoves[entry], counterMoves[entry + 1]);
+}
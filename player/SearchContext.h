@@ -0,0 +1,96 @@
+#ifndef DUCHESS_CPP_SEARCHCONTEXT_H
+#define DUCHESS_CPP_SEARCHCONTEXT_H
+
+#include "../duchess/CompactMove.h"
+#include "../duchess/Position.h"
+#include "../duchess/PositionUtils.h"
+
+#include <vector>
+#include <cstddef>
+
+// What one search thread learns about move ordering as it goes: the killer moves at each ply, how often each move has
+// caused a cutoff (history), and the best reply to each move (countermoves)
+// Unlike the transposition table it isn't shared: a Player keeps one for its main search thread, carried over from
+// one move to the next, and any other search threads work on copies of it
+// Moves are stored packed (see CompactMove), so use Board::toCompactMove / fromCompactMove to get at them. Nothing
+// here knows which position a move was stored from, so check a move is legal before playing it
+class SearchContext {
+public:
+    SearchContext();
+
+    // A context for a task searching part of t_parent's tree in parallel: it has its own copy of t_parent's killers,
+    // but reads t_parent's history and countermoves rather than copying them, since they're far bigger
+    // It can't add to them (markMoveAsHistory and markCounterMove do nothing), and t_parent mustn't change or go away
+    // while it's in use
+    static SearchContext sharingTablesWith(const SearchContext& t_parent);
+
+    // Gets ready for a search whose root is at t_globalTurn
+    // Killers move up to the plies they're now at, since the root has moved on since the last search, and history
+    // scores are halved so that recent cutoffs count for more than old ones
+    void startSearch(const int t_globalTurn);
+
+    // How many plies a node at t_globalTurn is below the root
+    int getPly(const int t_globalTurn) const {
+        return t_globalTurn - m_rootTurn;
+    }
+
+    // Killer moves: the last KILLERS_PER_PLY different moves to cause a cutoff at each ply
+    // Plies outside [0, MAX_PLY) have no killers
+    void markMoveAsKiller(const CompactMove t_move, const int t_ply);
+    // The null move if the slot's empty. Slot 0 is the most recent
+    CompactMove getKiller(const int t_ply, const unsigned int t_slot) const;
+    bool isMoveKiller(const CompactMove t_move, const int t_ply) const;
+
+    // History: each cutoff adds t_weight squared to the score of t_player moving from the move's from square to its
+    // to square (whatever it takes)
+    void markMoveAsHistory(const CompactMove t_move, const int t_weight, const short t_player);
+    unsigned int getHistoricalCutoffs(const CompactMove t_move, const short t_player) const {
+        return this->getHistoricalCutoffs(t_player, t_move.getFromIndex(), t_move.getToIndex());
+    }
+    unsigned int getHistoricalCutoffs(const short t_player, const BoardIndex t_from, const BoardIndex t_to) const {
+        return this->getHistory()[SearchContext::squaresIndex(t_player, t_from, t_to)];
+    }
+
+    // Countermoves, for Heuristic::BEST_REPLY: the last move by t_player that did better than its brothers in answer
+    // to a move between t_parent's squares. Only squares are kept, so the result has nothing taken or replaced (and
+    // is the null move if there isn't one)
+    void markCounterMove(const short t_player, const CompactMove t_parent, const CompactMove t_move);
+    CompactMove getCounterMove(const short t_player, const CompactMove t_parent) const;
+
+    constexpr static int MAX_PLY {64};
+    constexpr static unsigned int KILLERS_PER_PLY {2};
+    // Once any of a player's history scores passes this, all of theirs are halved
+    constexpr static unsigned int MAX_HISTORY_SCORE {1u << 24};
+
+private:
+    // For sharingTablesWith: no tables of its own, and t_tableOwner's instead
+    explicit SearchContext(const SearchContext* t_tableOwner);
+
+    const std::vector<unsigned int>& getHistory() const {
+        return m_tableOwner == nullptr ? m_history : m_tableOwner->m_history;
+    }
+    const std::vector<BoardIndex>& getCounterMoves() const {
+        return m_tableOwner == nullptr ? m_counterMoves : m_tableOwner->m_counterMoves;
+    }
+
+    // Halves every history score for t_player
+    void decayHistory(const short t_player);
+
+    // Where t_player's entry for moving from t_from to t_to is in m_history and m_counterMoves
+    static std::size_t squaresIndex(const short t_player, const BoardIndex t_from, const BoardIndex t_to) {
+        return (std::size_t(t_player - 1) * PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER + t_from) *
+               PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER + t_to;
+    }
+
+    int m_rootTurn;
+    bool m_hasSearched;
+    CompactMove m_killers[MAX_PLY][KILLERS_PER_PLY];
+    // The context whose history and countermoves this one reads, or nullptr if it has its own
+    const SearchContext* m_tableOwner;
+    // [player][from][to], flattened. Empty if m_tableOwner is set
+    std::vector<unsigned int> m_history;
+    // [player][parent's from][parent's to][from, to], flattened. Empty if m_tableOwner is set
+    std::vector<BoardIndex> m_counterMoves;
+};
+
+#endif //DUCHESS_CPP_SEARCHCONTEXT_H
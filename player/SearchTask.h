@@ -0,0 +1,61 @@
+#ifndef DUCHESS_CPP_SEARCHTASK_H
+#define DUCHESS_CPP_SEARCHTASK_H
+
+#include <atomic>
+#include <limits>
+
+class SearchTask;
+
+// A node whose children (after the first) are being searched in parallel
+// Records the first child (in move order) known to have caused a cutoff, so that later children can give up
+class SplitPoint {
+public:
+    explicit SplitPoint(const SearchTask* t_owner) :
+            m_owner(t_owner), m_firstCutoff(std::numeric_limits<unsigned int>::max()) { }
+
+    SplitPoint(const SplitPoint&) = delete;
+    SplitPoint& operator=(const SplitPoint&) = delete;
+
+    // The task the split node itself is being searched in, or nullptr if it's not in one
+    const SearchTask* getOwner() const {
+        return m_owner;
+    }
+
+    unsigned int getFirstCutoff() const {
+        return m_firstCutoff.load(std::memory_order_relaxed);
+    }
+
+    void recordCutoff(const unsigned int t_childIndex) {
+        unsigned int current = m_firstCutoff.load(std::memory_order_relaxed);
+        while (t_childIndex < current && !m_firstCutoff.compare_exchange_weak(current, t_childIndex)) { }
+    }
+
+private:
+    const SearchTask* m_owner;
+    std::atomic<unsigned int> m_firstCutoff;
+};
+
+// The search of one child of a split point
+// Only children after the first cutoff are abandoned, so which children finish never depends on timing
+class SearchTask {
+public:
+    SearchTask(const SplitPoint* t_splitPoint, const unsigned int t_childIndex) :
+            m_splitPoint(t_splitPoint), m_childIndex(t_childIndex) { }
+
+    // True if this task, or any task it's part of, is no longer needed
+    bool isAborted() const {
+        const SearchTask* task;
+        for (task = this; task != nullptr; task = task->m_splitPoint->getOwner()) {
+            if (task->m_childIndex > task->m_splitPoint->getFirstCutoff()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    const SplitPoint* m_splitPoint;
+    const unsigned int m_childIndex;
+};
+
+#endif //DUCHESS_CPP_SEARCHTASK_H
@@ -0,0 +1,31 @@
+#define NDEBUG
+
+#include "TimeControl.h"
+
+#include <algorithm>
+#include <cmath>
+
+int TimeControl::allocateBudgetMillis(const int t_numPieces, const int t_numLegalMoves) const {
+    if (!this->isClock()) {
+        return m_millis;
+    }
+
+    // If there's no time to spare or nothing to choose between, move straight away
+    const int usableMillis = m_millis - TimeControl::CLOCK_SAFETY_MARGIN_MILLIS;
+    if (usableMillis <= 0 || t_numLegalMoves <= 1) {
+        return 0;
+    }
+
+    // Games with fewer pieces left have fewer moves left in them
+    const double piecesLeft = std::min(1.0, double(t_numPieces) / TimeControl::NUM_PIECES_AT_START);
+    const double movesToGo = TimeControl::MIN_MOVES_TO_GO +
+                             piecesLeft * (TimeControl::MAX_MOVES_TO_GO - TimeControl::MIN_MOVES_TO_GO);
+
+    // Search effort grows with the branching factor, so spend roughly in proportion to its square root
+    const double complexity = std::sqrt(double(t_numLegalMoves) / TimeControl::TYPICAL_NUM_LEGAL_MOVES);
+    const double complexityFactor = std::max(double(TimeControl::MIN_COMPLEXITY_FACTOR),
+                                             std::min(double(TimeControl::MAX_COMPLEXITY_FACTOR), complexity));
+
+    const double budget = usableMillis / movesToGo * complexityFactor;
+    return int(std::min(budget, usableMillis * TimeControl::MAX_CLOCK_FRACTION));
+}
@@ -0,0 +1,54 @@
+#ifndef DUCHESS_CPP_TIMECONTROL_H
+#define DUCHESS_CPP_TIMECONTROL_H
+
+// How much time a player has to choose its moves
+// Either a fixed budget for every move, or a game clock that has to last the rest of the game, in which case the
+// budget for each move depends on the position (see allocateBudgetMillis)
+class TimeControl {
+public:
+    static TimeControl perMove(const int t_budgetMillis) {
+        return TimeControl(false, t_budgetMillis);
+    }
+
+    // t_clockMillis is all the time left for this and every later move
+    static TimeControl remainingClock(const int t_clockMillis) {
+        return TimeControl(true, t_clockMillis);
+    }
+
+    bool isClock() const {
+        return m_isClock;
+    }
+
+    int getMillis() const {
+        return m_millis;
+    }
+
+    // How long to spend searching for a move in a position with t_numPieces pieces on the board and t_numLegalMoves
+    // moves to choose from
+    // Against a clock, the time left is shared out between the moves we expect to still have to make (fewer as pieces
+    // come off the board), with more for positions with lots of options and less for those with few, but never so
+    // much that the clock could run out
+    int allocateBudgetMillis(const int t_numPieces, const int t_numLegalMoves) const;
+
+    // Our moves still to come in a full game, and near its end
+    constexpr static int MAX_MOVES_TO_GO {40};
+    constexpr static int MIN_MOVES_TO_GO {10};
+    constexpr static int NUM_PIECES_AT_START {90};
+    // A position with this many legal moves gets an even share of the clock
+    constexpr static int TYPICAL_NUM_LEGAL_MOVES {40};
+    // Limits on how far above or below an even share the position's complexity can take a move
+    constexpr static double MIN_COMPLEXITY_FACTOR {0.5};
+    constexpr static double MAX_COMPLEXITY_FACTOR {2};
+    // Kept back from every move for the round trip to the client
+    constexpr static int CLOCK_SAFETY_MARGIN_MILLIS {100};
+    // No one move can use more than this fraction of the clock
+    constexpr static double MAX_CLOCK_FRACTION {0.25};
+
+private:
+    TimeControl(const bool t_isClock, const int t_millis) : m_isClock(t_isClock), m_millis(t_millis) { }
+
+    bool m_isClock;
+    int m_millis;
+};
+
+#endif //DUCHESS_CPP_TIMECONTROL_H
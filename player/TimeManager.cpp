@@ -0,0 +1,43 @@
+#define NDEBUG
+
+#include "TimeManager.h"
+
+#include <atomic>
+#include <chrono>
+
+TimeManager::TimeManager(const int t_budgetMillis) : TimeManager(t_budgetMillis / 2, t_budgetMillis) { }
+
+TimeManager::TimeManager(const int t_softLimitMillis, const int t_hardLimitMillis) :
+        m_softLimitMillis(t_softLimitMillis), m_hardLimitMillis(t_hardLimitMillis), m_hardLimitReached(false) {
+    this->start();
+}
+
+void TimeManager::start() {
+    m_startTime = std::chrono::steady_clock::now();
+    m_hardLimitReached = false;
+}
+
+int TimeManager::getElapsedMillis() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime).count();
+}
+
+bool TimeManager::shouldStartIteration(const int t_estimatedMillis) const {
+    return this->getElapsedMillis() + t_estimatedMillis < m_softLimitMillis;
+}
+
+bool TimeManager::checkHardLimit() const {
+    if (!this->isHardLimitReached() && this->getElapsedMillis() >= m_hardLimitMillis) {
+        m_hardLimitReached.store(true, std::memory_order_relaxed);
+    }
+    return this->isHardLimitReached();
+}
+
+bool TimeManager::pollHardLimit() const {
+    // Counted per thread so that search threads don't fight over a shared counter
+    static thread_local unsigned int callsSinceCheck = 0;
+    if (++callsSinceCheck >= TimeManager::NODES_BETWEEN_CHECKS) {
+        callsSinceCheck = 0;
+        return this->checkHardLimit();
+    }
+    return this->isHardLimitReached();
+}
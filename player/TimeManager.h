@@ -0,0 +1,59 @@
+#ifndef DUCHESS_CPP_TIMEMANAGER_H
+#define DUCHESS_CPP_TIMEMANAGER_H
+
+#include <atomic>
+#include <chrono>
+
+// Decides how long a single search may take
+// The soft limit is checked between iterations of iterative deepening: another iteration is only started if it's
+// expected to finish before the soft limit. The hard limit is checked during the search, and once it has passed the
+// search is abandoned wherever it is
+class TimeManager {
+public:
+    // The soft limit is half the budget, the hard limit the whole of it
+    explicit TimeManager(const int t_budgetMillis);
+    TimeManager(const int t_softLimitMillis, const int t_hardLimitMillis);
+
+    TimeManager(const TimeManager&) = delete;
+    TimeManager& operator=(const TimeManager&) = delete;
+
+    // Restarts the clock (it's also started on construction)
+    void start();
+
+    int getElapsedMillis() const;
+
+    // True if an iteration expected to take t_estimatedMillis would finish before the soft limit
+    bool shouldStartIteration(const int t_estimatedMillis) const;
+
+    // Reads the clock, and returns whether the hard limit has passed
+    bool checkHardLimit() const;
+
+    // Cheap enough to call at every node from any thread: only actually reads the clock every NODES_BETWEEN_CHECKS
+    // calls (per thread), otherwise just returns what isHardLimitReached() does
+    bool pollHardLimit() const;
+
+    // Whether a previous check found the hard limit had passed. Never reads the clock
+    bool isHardLimitReached() const {
+        return m_hardLimitReached.load(std::memory_order_relaxed);
+    }
+
+    int getSoftLimitMillis() const {
+        return m_softLimitMillis;
+    }
+
+    int getHardLimitMillis() const {
+        return m_hardLimitMillis;
+    }
+
+    // What a move gets when nobody says otherwise
+    constexpr static int DEFAULT_BUDGET_MILLIS {2000};
+    constexpr static unsigned int NODES_BETWEEN_CHECKS {1024};
+
+private:
+    int m_softLimitMillis;
+    int m_hardLimitMillis;
+    std::chrono::steady_clock::time_point m_startTime;
+    mutable std::atomic<bool> m_hardLimitReached;
+};
+
+#endif //DUCHESS_CPP_TIMEMANAGER_H
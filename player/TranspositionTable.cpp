@@ -0,0 +1,106 @@
+#define NDEBUG
+
+#include "TranspositionTable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+TranspositionTable::TranspositionTable(const unsigned int t_sizeInMB) : m_numBuckets(0), m_mask(0), m_sizeInMB(0), m_generation(0) {
+    this->resize(t_sizeInMB);
+}
+
+void TranspositionTable::resize(const unsigned int t_sizeInMB) {
+    const std::size_t bytes = std::size_t(t_sizeInMB) * 1024 * 1024;
+    std::size_t numBuckets = 1;
+    while (numBuckets * 2 * sizeof(Bucket) <= bytes) {
+        numBuckets *= 2;
+    }
+
+    m_buckets.reset(new Bucket[numBuckets]);
+    m_numBuckets = numBuckets;
+    m_mask = numBuckets - 1;
+    m_sizeInMB = t_sizeInMB;
+    this->clear();
+}
+
+void TranspositionTable::clear() {
+    std::size_t i;
+    for (i = 0; i < m_numBuckets; ++i) {
+        for (Slot* slot : {&m_buckets[i].depthPreferred, &m_buckets[i].alwaysReplace}) {
+            slot->check.store(0, std::memory_order_relaxed);
+            slot->score.store(0, std::memory_order_relaxed);
+            slot->data.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool TranspositionTable::probe(const ZobristKey t_key, TranspositionEntry& t_entry) const {
+    const Bucket& bucket = this->getBucket(t_key);
+    if (TranspositionTable::readSlot(bucket.depthPreferred, t_entry) && t_entry.key == t_key) {
+        return true;
+    } else if (TranspositionTable::readSlot(bucket.alwaysReplace, t_entry) && t_entry.key == t_key) {
+        return true;
+    }
+    return false;
+}
+
+void TranspositionTable::store(const ZobristKey t_key, const short t_depth, const BoundType t_bound, const double t_score, const CompactMove t_bestMove) {
+    Bucket& bucket = this->getBucket(t_key);
+
+    TranspositionEntry entry;
+    entry.key = t_key;
+    entry.depth = t_depth;
+    entry.bound = t_bound;
+    entry.score = t_score;
+    entry.bestMove = t_bestMove;
+    entry.generation = m_generation;
+
+    // An empty slot is treated like one from an earlier search
+    TranspositionEntry deepEntry;
+    const bool deepEntryIsCurrent = TranspositionTable::readSlot(bucket.depthPreferred, deepEntry) && deepEntry.generation == m_generation;
+
+    if (!deepEntryIsCurrent || t_depth >= deepEntry.depth || deepEntry.key == t_key) {
+        // Keep whatever used to be in the deep slot around in the other slot, unless it's this same position or an
+        // earlier search's
+        if (deepEntryIsCurrent && deepEntry.key != t_key) {
+            TranspositionTable::writeSlot(bucket.alwaysReplace, deepEntry);
+        }
+        TranspositionTable::writeSlot(bucket.depthPreferred, entry);
+    } else {
+        TranspositionTable::writeSlot(bucket.alwaysReplace, entry);
+    }
+}
+
+bool TranspositionTable::readSlot(const Slot& t_slot, TranspositionEntry& t_entry) {
+    const uint64_t check = t_slot.check.load(std::memory_order_relaxed);
+    const uint64_t score = t_slot.score.load(std::memory_order_relaxed);
+    const uint64_t data = t_slot.data.load(std::memory_order_relaxed);
+
+    const BoundType bound = static_cast<BoundType>((data >> 48) & 0xFF);
+    if (bound == BoundType::NONE) {
+        return false;
+    }
+
+    t_entry.key = check ^ score ^ data;
+    std::memcpy(&t_entry.score, &score, sizeof(double));
+    t_entry.bestMove = CompactMove(uint32_t(data));
+    t_entry.depth = short(uint16_t(data >> 32));
+    t_entry.bound = bound;
+    t_entry.generation = (unsigned char)(data >> 56);
+    return true;
+}
+
+void TranspositionTable::writeSlot(Slot& t_slot, const TranspositionEntry& t_entry) {
+    uint64_t score;
+    std::memcpy(&score, &t_entry.score, sizeof(double));
+    const uint64_t data = uint64_t(t_entry.bestMove.getValue()) |
+                          (uint64_t(uint16_t(t_entry.depth)) << 32) |
+                          (uint64_t(t_entry.bound) << 48) |
+                          (uint64_t(t_entry.generation) << 56);
+
+    t_slot.score.store(score, std::memory_order_relaxed);
+    t_slot.data.store(data, std::memory_order_relaxed);
+    t_slot.check.store(t_entry.key ^ score ^ data, std::memory_order_relaxed);
+}
@@ -0,0 +1,101 @@
+#ifndef DUCHESS_CPP_TRANSPOSITIONTABLE_H
+#define DUCHESS_CPP_TRANSPOSITIONTABLE_H
+
+#include "../duchess/CompactMove.h"
+#include "../duchess/ZobristUtils.h"
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+// Which side of the true value a stored score lies on
+enum class BoundType : unsigned char {
+    NONE,
+    EXACT,
+    LOWER,
+    UPPER
+};
+
+struct TranspositionEntry {
+    TranspositionEntry() : key(0), score(0), bestMove(), depth(-1), bound(BoundType::NONE), generation(0) { }
+
+    ZobristKey key;
+    double score;
+    CompactMove bestMove;
+    short depth;
+    BoundType bound;
+    // Which search stored it (see TranspositionTable::newSearch)
+    unsigned char generation;
+};
+
+// A fixed size hash table of search results, indexed by Board::getHash()
+// Each bucket holds two entries: one that's only replaced by searches at least as deep (or by anything, once it's
+// left over from an earlier search), and one that's always replaced
+// Safe to probe and store from several search threads at once without locking: each entry is written as three
+// words, one of which is the key XORed with the other two, so a probe that reads a half-written entry just misses
+class TranspositionTable {
+public:
+    explicit TranspositionTable(const unsigned int t_sizeInMB = DEFAULT_SIZE_MB);
+
+    TranspositionTable(const TranspositionTable&) = delete;
+    TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+    // Throws away everything stored and resizes to the largest power-of-two number of buckets that fits in t_sizeInMB
+    // Neither this nor clear() may run while a search is using the table
+    void resize(const unsigned int t_sizeInMB);
+    void clear();
+    // Called at the start of each search, so that entries left over from earlier ones can be replaced whatever their depth
+    void newSearch() {
+        ++m_generation;
+    }
+
+    // Returns true (and fills t_entry) if there's an entry for exactly this key
+    bool probe(const ZobristKey t_key, TranspositionEntry& t_entry) const;
+    void store(const ZobristKey t_key, const short t_depth, const BoundType t_bound, const double t_score, const CompactMove t_bestMove);
+
+    std::size_t getNumBuckets() const {
+        return m_numBuckets;
+    }
+
+    unsigned int getSizeInMB() const {
+        return m_sizeInMB;
+    }
+
+    unsigned char getGeneration() const {
+        return m_generation;
+    }
+
+    static const unsigned int DEFAULT_SIZE_MB = 16;
+
+private:
+    // An entry as stored: data packs the best move, depth, bound and generation, and check is key ^ score ^ data
+    struct Slot {
+        std::atomic<uint64_t> check;
+        std::atomic<uint64_t> score;
+        std::atomic<uint64_t> data;
+    };
+
+    struct Bucket {
+        Slot depthPreferred;
+        Slot alwaysReplace;
+    };
+
+    Bucket& getBucket(const ZobristKey t_key) const {
+        return m_buckets[t_key & m_mask];
+    }
+
+    // Returns false if the slot is empty. A slot caught part way through being written still reads back, but with the
+    // wrong key, so it's only the key comparison in probe() that turns it away
+    static bool readSlot(const Slot& t_slot, TranspositionEntry& t_entry);
+    static void writeSlot(Slot& t_slot, const TranspositionEntry& t_entry);
+
+    std::unique_ptr<Bucket[]> m_buckets;
+    std::size_t m_numBuckets;
+    ZobristKey m_mask;
+    unsigned int m_sizeInMB;
+    // Only changed between searches, like the size
+    unsigned char m_generation;
+};
+
+#endif //DUCHESS_CPP_TRANSPOSITIONTABLE_H
@@ -0,0 +1,110 @@
+#define NDEBUG
+
+#include "WorkStealingPool.h"
+
+#include <cassert>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+WorkStealingPool::WorkStealingPool(const unsigned int t_numWorkers) : m_numQueued(0), m_stop(false) {
+    const unsigned int numWorkers = t_numWorkers < 1 ? 1 : t_numWorkers;
+    unsigned int worker;
+    for (worker = 0; worker < numWorkers; ++worker) {
+        m_queues.emplace_back(new WorkerQueue());
+    }
+    // Worker 0 is whoever made the pool
+    for (worker = 1; worker < numWorkers; ++worker) {
+        m_threads.emplace_back(&WorkStealingPool::workerLoop, this, worker);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::submit(const unsigned int t_worker, TaskGroup& t_group, Task t_task) {
+    assert(t_worker < m_queues.size());
+    t_group.m_pending.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_queues[t_worker]->mutex);
+        m_queues[t_worker]->tasks.push_back({&t_group, std::move(t_task)});
+    }
+    {
+        // Taking the lock stops a worker from missing this between checking for work and going to sleep
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        ++m_numQueued;
+    }
+    m_wakeUp.notify_one();
+}
+
+void WorkStealingPool::wait(const unsigned int t_worker, TaskGroup& t_group) {
+    while (!t_group.isDone()) {
+        if (!this->tryRunTask(t_worker)) {
+            // Everything left in the group is running elsewhere, so sleep until it finishes or there's more to help with
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_wakeUp.wait(lock, [this, &t_group] () { return t_group.isDone() || m_numQueued > 0; });
+        }
+    }
+}
+
+bool WorkStealingPool::tryRunTask(const unsigned int t_worker) {
+    QueuedTask task;
+    bool found = false;
+
+    // Our own newest task first (it's the most likely to be small and to share our caches)
+    {
+        WorkerQueue& queue = *m_queues[t_worker];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            found = true;
+        }
+    }
+
+    // Otherwise steal the oldest task from someone else
+    const unsigned int numWorkers = m_queues.size();
+    unsigned int offset;
+    for (offset = 1; !found && offset < numWorkers; ++offset) {
+        WorkerQueue& queue = *m_queues[(t_worker + offset) % numWorkers];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    --m_numQueued;
+    task.task(t_worker);
+    if (task.group->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Someone may be asleep in wait() for this group. Taking the lock stops them missing it between checking and
+        // going to sleep
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        m_wakeUp.notify_all();
+    }
+    return true;
+}
+
+void WorkStealingPool::workerLoop(const unsigned int t_worker) {
+    while (!m_stop) {
+        if (!this->tryRunTask(t_worker)) {
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_wakeUp.wait(lock, [this] () { return m_stop || m_numQueued > 0; });
+        }
+    }
+}
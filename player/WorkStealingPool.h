@@ -0,0 +1,79 @@
+#ifndef DUCHESS_CPP_WORKSTEALINGPOOL_H
+#define DUCHESS_CPP_WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A set of tasks that can be waited on together
+class TaskGroup {
+public:
+    TaskGroup() : m_pending(0) { }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    bool isDone() const {
+        return m_pending.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class WorkStealingPool;
+    std::atomic<int> m_pending;
+};
+
+// A fixed set of worker threads, each with its own queue of tasks
+// Workers run their own newest tasks first, and when they run out steal the oldest tasks from other workers
+// The thread that creates the pool is worker 0: it has no thread of its own, but works through tasks while it waits
+class WorkStealingPool {
+public:
+    // Tasks are told the index of the worker running them
+    typedef std::function<void(const unsigned int)> Task;
+
+    explicit WorkStealingPool(const unsigned int t_numWorkers);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // Queues t_task as part of t_group, on worker t_worker's queue (t_worker must be the calling worker)
+    void submit(const unsigned int t_worker, TaskGroup& t_group, Task t_task);
+
+    // Runs queued tasks (from any group) until everything in t_group has finished, sleeping while there are none
+    void wait(const unsigned int t_worker, TaskGroup& t_group);
+
+    unsigned int getNumWorkers() const {
+        return m_queues.size();
+    }
+
+private:
+    struct QueuedTask {
+        TaskGroup* group;
+        Task task;
+    };
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<QueuedTask> tasks;
+    };
+
+    // Runs one task if there's one to be had. Returns false if every queue was empty
+    bool tryRunTask(const unsigned int t_worker);
+    void workerLoop(const unsigned int t_worker);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::vector<std::thread> m_threads;
+
+    // Idle workers sleep here until something is queued, as do waiters until their group finishes
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeUp;
+    std::atomic<int> m_numQueued;
+    std::atomic<bool> m_stop;
+};
+
+#endif //DUCHESS_CPP_WORKSTEALINGPOOL_H
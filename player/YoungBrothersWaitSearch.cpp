@@ -0,0 +1,227 @@
+#define NDEBUG
+
+#include "YoungBrothersWaitSearch.h"
+#include "Player.h"
+#include "Brain.h"
+#include "SearchAnalytics.h"
+#include "SearchContext.h"
+#include "SearchTask.h"
+#include "TranspositionTable.h"
+#include "WorkStealingPool.h"
+
+#include "../duchess/Board.h"
+#include "../duchess/CompactMove.h"
+#include "../duchess/Move.h"
+#include "../duchess/MoveList.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+YoungBrothersWaitSearch::YoungBrothersWaitSearch(const Player& t_player, WorkStealingPool& t_pool) :
+        m_player(t_player), m_pool(t_pool) { }
+
+Move YoungBrothersWaitSearch::searchFromRoot(MoveList t_validMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* t_analytics, SearchContext& t_context, const int t_globalTurn) const {
+    const unsigned int numValidMoves = t_validMoves.size();
+    const EvaluationMode evaluationMode = m_player.getBrain()->getEvaluationMode();
+    const short nextTurn = m_player.getPlayerNumber() == 6 ? 1 : m_player.getPlayerNumber() + 1;
+
+    m_player.getBrain()->sortMovesBasedOnHeuristic(t_validMoves);
+
+    t_analytics->recordNodesExpandedAtTurn(t_globalTurn, numValidMoves);
+    t_analytics->recordNodesEvaluatedAtTurn(t_globalTurn, numValidMoves);
+
+    if (numValidMoves == 1) {
+        return t_validMoves[0];
+    }
+
+    // Eldest brother first, on this thread
+    t_board->applyMove(&t_validMoves[0], evaluationMode);
+    double alpha = -1 * this->searchNode(t_board, t_maxDepth - 1, -INFINITY, INFINITY, nextTurn, t_analytics,
+                                         t_context, t_globalTurn + 1, t_validMoves[0], t_maxDepth, nullptr, 0);
+    t_board->undoMove(&t_validMoves[0], evaluationMode);
+    Move bestMove = t_validMoves[0];
+
+    // Then everyone else at once, each only needing to show whether it beats the eldest. Nothing can cut off at the root
+    std::vector<double> values;
+    this->searchYoungerBrothers(*t_board, t_validMoves, t_maxDepth - 1, -INFINITY, -alpha, INFINITY, nextTurn,
+                                t_analytics, t_context, t_globalTurn + 1, t_maxDepth, nullptr, 0, values);
+
+    // A brother that fails low can come back tied with alpha without being as good, so ties go to the earlier move
+    unsigned int i;
+    for (i = 1; i < numValidMoves; ++i) {
+        if (values[i] > alpha) {
+            alpha = values[i];
+            bestMove = t_validMoves[i];
+        }
+    }
+
+    return bestMove;
+}
+
+double YoungBrothersWaitSearch::searchNode(Board* t_board, const int t_depth, double t_alpha, double t_beta,
+                                           const short t_turn, SearchAnalytics* t_analytics, SearchContext& t_context, const int t_globalTurn, const Move& t_parentMove,
+                                           const int t_maxDepth, const SearchTask* t_task, const unsigned int t_worker) const {
+    if (t_depth < YoungBrothersWaitSearch::MIN_SPLIT_DEPTH) {
+        return m_player.alphaBetaMoveSearch(t_board, t_depth, t_alpha, t_beta, t_turn, t_analytics, t_context, t_globalTurn, t_parentMove, t_maxDepth, t_task);
+    }
+
+    if (m_player.isSearchStopped() || (t_task != nullptr && t_task->isAborted())) {
+        return 0;
+    }
+
+    if (t_board->isTerminal()) {
+        return (-1 * Brain::WINNING_MOVE_SCORE) + t_depth;
+    }
+
+    const EvaluationMode evaluationMode = m_player.getBrain()->getEvaluationMode();
+    const short nextTurn = (t_turn == 6 ? 1 : t_turn + 1);
+    const double originalAlpha = t_alpha;
+
+    // The transposition table, exactly as Player::alphaBetaMoveSearch uses it
+    TranspositionTable& transpositionTable = m_player.getBrain()->getTranspositionTable();
+    const bool useTranspositionTable = t_board->getSideToMove() == t_turn;
+    const ZobristKey hash = t_board->getHash();
+    TranspositionEntry entry;
+    Move transpositionMove;
+    if (useTranspositionTable) {
+        const bool hit = transpositionTable.probe(hash, entry);
+        t_analytics->recordTranspositionProbe(hit);
+        if (hit) {
+            if (entry.depth >= t_depth) {
+                if (entry.bound == BoundType::EXACT) {
+                    t_analytics->recordTranspositionCutoff();
+                    return entry.score;
+                } else if (entry.bound == BoundType::LOWER) {
+                    t_alpha = std::max(t_alpha, entry.score);
+                } else if (entry.bound == BoundType::UPPER) {
+                    t_beta = std::min(t_beta, entry.score);
+                }
+
+                if (t_alpha + Brain::FLOAT_FUDGE >= t_beta) {
+                    t_analytics->recordTranspositionCutoff();
+                    return entry.score;
+                }
+            }
+            transpositionMove = t_board->fromCompactMove(entry.bestMove);
+        }
+    }
+
+    MoveList validMoves;
+    t_board->getLegalMoves(t_turn, validMoves);
+    m_player.getBrain()->sortMovesBasedOnHeuristic(validMoves);
+    // Whatever was best last time is the eldest brother (if it's one of the moves here: a different position can
+    // have the same hash)
+    if (!transpositionMove.isNull()) {
+        Move* found = std::find(validMoves.begin(), validMoves.end(), transpositionMove);
+        if (found != validMoves.end()) {
+            std::rotate(validMoves.begin(), found, found + 1);
+        }
+    }
+    int nodesEvaluated = 1;
+
+    // Eldest brother
+    t_board->applyMove(&validMoves[0], evaluationMode);
+    double bestValue = -this->searchNode(t_board, t_depth - 1, -t_beta, -t_alpha, nextTurn, t_analytics,
+                                         t_context, t_globalTurn + 1, validMoves[0], t_maxDepth, t_task, t_worker);
+    t_board->undoMove(&validMoves[0], evaluationMode);
+    Move bestMove = validMoves[0];
+    t_alpha = std::max(t_alpha, bestValue);
+    bool foundCutoff = false;
+
+    if (t_alpha + Brain::FLOAT_FUDGE >= t_beta) {
+        t_analytics->recordCutoffAtTurn(t_globalTurn);
+        foundCutoff = true;
+    } else {
+        // Younger brothers, in parallel
+        std::vector<double> values;
+        this->searchYoungerBrothers(*t_board, validMoves, t_depth - 1, -t_beta, -t_alpha, t_beta, nextTurn,
+                                    t_analytics, t_context, t_globalTurn + 1, t_maxDepth, t_task, t_worker, values);
+
+        unsigned int i;
+        for (i = 1; i < values.size(); ++i) {
+            ++nodesEvaluated;
+            if (values[i] > bestValue) {
+                bestValue = values[i];
+                bestMove = validMoves[i];
+            }
+            t_alpha = std::max(t_alpha, values[i]);
+            if (t_alpha + Brain::FLOAT_FUDGE >= t_beta) {
+                t_analytics->recordCutoffAtTurn(t_globalTurn);
+                foundCutoff = true;
+                break;
+            }
+        }
+    }
+
+    t_analytics->recordNodesExpandedAtTurn(t_globalTurn, validMoves.size());
+    t_analytics->recordNodesEvaluatedAtTurn(t_globalTurn, nodesEvaluated);
+
+    // An abandoned search's values are meaningless, so mustn't go in the table
+    if (useTranspositionTable && !m_player.isSearchStopped() && (t_task == nullptr || !t_task->isAborted())) {
+        BoundType bound = BoundType::EXACT;
+        if (bestValue <= originalAlpha) {
+            bound = BoundType::UPPER;
+        } else if (foundCutoff || bestValue >= t_beta) {
+            bound = BoundType::LOWER;
+        }
+        transpositionTable.store(hash, t_depth, bound, bestValue, t_board->toCompactMove(bestMove));
+    }
+
+    return bestValue;
+}
+
+void YoungBrothersWaitSearch::searchYoungerBrothers(const Board& t_board, const MoveList& t_moves,
+                                                    const int t_childDepth, const double t_childAlpha, const double t_childBeta,
+                                                    const double t_cutoffValue, const short t_childTurn, SearchAnalytics* t_analytics,
+                                                    const SearchContext& t_context, const int t_globalTurn, const int t_maxDepth, const SearchTask* t_task,
+                                                    const unsigned int t_worker, std::vector<double>& t_values) const {
+    const unsigned int numMoves = t_moves.size();
+    const EvaluationMode evaluationMode = m_player.getBrain()->getEvaluationMode();
+
+    // This thread doesn't touch t_board again until every task has finished, so tasks can copy it in the meantime
+    std::vector<CompactMove> childMoves;
+    std::vector<SearchAnalytics> childAnalytics;
+    childAnalytics.reserve(numMoves);
+    unsigned int i;
+    for (i = 0; i < numMoves; ++i) {
+        childMoves.push_back(t_board.toCompactMove(t_moves[i]));
+        childAnalytics.emplace_back(t_analytics->getTurnNumber(), t_analytics->getNumPiecesOnBoard());
+    }
+    t_values.assign(numMoves, -INFINITY);
+
+    SplitPoint splitPoint(t_task);
+    TaskGroup group;
+    for (i = 1; i < numMoves; ++i) {
+        m_pool.submit(t_worker, group, [&, i] (const unsigned int t_taskWorker) {
+            const SearchTask task(&splitPoint, i);
+            if (task.isAborted()) {
+                return;
+            }
+
+            Board board(t_board);
+            const Move move = board.fromCompactMove(childMoves[i]);
+            board.applyMove(&move, evaluationMode);
+
+            // Nothing changes t_context until every task has finished, so each starts from the same one. Only the
+            // killers are copied: history and countermoves are read from t_context, and not added to
+            SearchContext context (SearchContext::sharingTablesWith(t_context));
+            const double value = -this->searchNode(&board, t_childDepth, t_childAlpha, t_childBeta, t_childTurn,
+                                                   &childAnalytics[i], context, t_globalTurn, move, t_maxDepth, &task, t_taskWorker);
+            if (!task.isAborted()) {
+                t_values[i] = value;
+                if (value + Brain::FLOAT_FUDGE >= t_cutoffValue) {
+                    splitPoint.recordCutoff(i);
+                }
+            }
+        });
+    }
+    m_pool.wait(t_worker, group);
+
+    // Only the children up to the first cutoff count, exactly as if they'd been searched in order
+    const unsigned int lastCounted = std::min(numMoves - 1, splitPoint.getFirstCutoff());
+    for (i = 1; i <= lastCounted; ++i) {
+        t_analytics->merge(childAnalytics[i]);
+    }
+    t_values.resize(lastCounted + 1);
+}
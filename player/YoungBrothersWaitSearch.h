@@ -0,0 +1,57 @@
+#ifndef DUCHESS_CPP_YOUNGBROTHERSWAITSEARCH_H
+#define DUCHESS_CPP_YOUNGBROTHERSWAITSEARCH_H
+
+#include "SearchAnalytics.h"
+#include "SearchContext.h"
+#include "SearchTask.h"
+#include "WorkStealingPool.h"
+
+#include "../duchess/Board.h"
+#include "../duchess/CompactMove.h"
+#include "../duchess/Move.h"
+#include "../duchess/MoveList.h"
+
+#include <vector>
+
+class Player;
+
+// Parallel alpha-beta for Player, splitting the tree between the workers of a WorkStealingPool
+// At each node deep enough to be worth splitting, the first child is searched on its own, and then the rest are
+// searched in parallel with the window it left. Each parallel child is searched on its own copy of the board at the
+// split node (taken while the parent waits for it), and keeps its own SearchAnalytics
+// Each parallel child also gets its own copy of its parent's killers, and reads (without adding to) the history and
+// countermoves of the search's SearchContext (see SearchContext::sharingTablesWith)
+// Split nodes probe and store the transposition table like any other node, so (as with Lazy SMP) what gets searched
+// depends on how the work is scheduled
+// Not the default (see ParallelSearchMode): it has yet to beat Lazy SMP on a multi-core machine
+class YoungBrothersWaitSearch {
+public:
+    YoungBrothersWaitSearch(const Player& t_player, WorkStealingPool& t_pool);
+
+    // Equivalent to Player::alphaBetaFromRoot, run from worker 0 of the pool
+    Move searchFromRoot(MoveList t_validMoves, Board* t_board, const int t_maxDepth, SearchAnalytics* t_analytics, SearchContext& t_context, const int t_globalTurn) const;
+
+    // Nodes with less depth left than this are searched by one thread with Player::alphaBetaMoveSearch
+    constexpr static int MIN_SPLIT_DEPTH {3};
+
+private:
+    // Equivalent to Player::alphaBetaMoveSearch
+    double searchNode(Board* t_board, const int t_depth, double t_alpha, double t_beta,
+                      const short t_turn, SearchAnalytics* t_analytics, SearchContext& t_context, const int t_globalTurn, const Move& t_parentMove,
+                      const int t_maxDepth, const SearchTask* t_task, const unsigned int t_worker) const;
+
+    // Searches t_moves[1], t_moves[2], ... from t_board in parallel, each with the window (t_childAlpha, t_childBeta)
+    // Fills t_values with their negated scores in move order, stopping after the first that is at least
+    // t_cutoffValue, and adds the analytics of exactly those searches to t_analytics
+    // t_board is only read (by the tasks copying it) until this returns
+    void searchYoungerBrothers(const Board& t_board, const MoveList& t_moves,
+                               const int t_childDepth, const double t_childAlpha, const double t_childBeta,
+                               const double t_cutoffValue, const short t_childTurn, SearchAnalytics* t_analytics,
+                               const SearchContext& t_context, const int t_globalTurn, const int t_maxDepth, const SearchTask* t_task,
+                               const unsigned int t_worker, std::vector<double>& t_values) const;
+
+    const Player& m_player;
+    WorkStealingPool& m_pool;
+};
+
+#endif //DUCHESS_CPP_YOUNGBROTHERSWAITSEARCH_H
@@ -9,8 +9,10 @@
 #include "../../player/FeatureSet.h"
 #include "../../player/FeatureSet.h"
 #include "../../player/FeatureUtils.h"
+#include "../../player/ReductionTable.h"
 
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -25,6 +27,7 @@ void TestBrain::runTests() {
     TestBrain::test_updateWeightsForFeatures();
     TestBrain::test_randomNumber();
     TestBrain::test_sortMovesBasedOnHeuristic();
+    TestBrain::test_getMaterialBalance();
     TestBrain::test_getPlayerOffsetBySeats();
     TestBrain::test_seatsBetweenPlayers();
     TestBrain::test_positionIndexesRelativeToPlayerLookup();
@@ -57,6 +60,18 @@ void TestBrain::test_settersAndGetters() {
     brain2.setPathToWeights(pathToWeights2);
     assert(brain2.getPathToWeights() == pathToWeights2);
 
+    // Forward pruning is on by default, and each kind can be switched off on its own
+    assert(brain.usesLateMoveReductions());
+    assert(brain.usesFutilityPruning());
+    brain.setLateMoveReductions(false);
+    assert(!brain.usesLateMoveReductions());
+    assert(brain.usesFutilityPruning());
+    brain.setFutilityPruning(false);
+    assert(!brain.usesFutilityPruning());
+
+    assert(brain.getReductionTable().getBase() == ReductionTable::DEFAULT_BASE);
+    brain.setReductionTable(ReductionTable(1, 2, 4));
+    assert(brain.getReductionTable().getFullDepthMoves() == 4);
 }
 
 void TestBrain::test_sigmoid() {
@@ -220,7 +235,11 @@ void TestBrain::test_sortMovesBasedOnHeuristic() {
 
     Move m5(&from3, &to3, &takePiece3, &replacePiece);
 
-    std::vector<Move> moves { m3, m4, m5, m2};
+    MoveList moves;
+    moves.push_back(m3);
+    moves.push_back(m4);
+    moves.push_back(m5);
+    moves.push_back(m2);
     std::vector<Move> expectedOrder {m5, m4, m3, m2};
 
     Brain b;
@@ -229,10 +248,39 @@ void TestBrain::test_sortMovesBasedOnHeuristic() {
 
     b.sortMovesBasedOnHeuristic(moves);
 
-    assert(moves == expectedOrder);
+    assert(moves.toVector() == expectedOrder);
 
 }
 
+void TestBrain::test_getMaterialBalance() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    Board board;
+    board.initialiseAttDefVectors();
+
+    // Everyone starts level
+    short player;
+    for (player = 1; player <= 6; ++player) {
+        assert(brain.getMaterialBalance(board, player) == 0);
+    }
+
+    // Player 2 losing their queen is good for the odd team, and bad for the evens
+    Piece* queen2c2 = board.getPiecesForPlayer(2)[7];
+    Position offBoard ("OB");
+    board.setPiecePosition(queen2c2, &offBoard);
+    const double queenValue = brain.getValueOfPiece(queen2c2);
+    assert(std::fabs(brain.getMaterialBalance(board, 1) - queenValue) < 1e-9);
+    assert(std::fabs(brain.getMaterialBalance(board, 3) - queenValue) < 1e-9);
+    assert(std::fabs(brain.getMaterialBalance(board, 4) + queenValue) < 1e-9);
+
+    // Which is the material part of the full evaluation
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+    Board startingBoard;
+    startingBoard.initialiseAttDefVectors();
+    board.initialiseAttDefVectors();
+    const double evaluationChange = brain.evaluateBoardState(board, 1) - brain.evaluateBoardState(startingBoard, 1);
+    assert(std::fabs(evaluationChange - queenValue) < 1e-9);
+}
+
 void TestBrain::test_getPlayerOffsetBySeats() {
     assert(Brain::getPlayerOffsetBySeats(1, 0) == 1);
     assert(Brain::getPlayerOffsetBySeats(6, 1) == 1);
@@ -14,6 +14,7 @@ private:
     static void test_updateWeightsForFeatures();
     static void test_randomNumber();
     static void test_sortMovesBasedOnHeuristic();
+    static void test_getMaterialBalance();
     static void test_getPlayerOffsetBySeats();
     static void test_seatsBetweenPlayers();
     static void test_positionIndexesRelativeToPlayerLookup();
@@ -0,0 +1,265 @@
+#include "testMovePicker.h"
+#include "../MovePicker.h"
+#include "../Brain.h"
+#include "../Heuristic.h"
+#include "../FeatureSet.h"
+#include "../SearchContext.h"
+#include "../../duchess/Board.h"
+#include "../../duchess/Move.h"
+#include "../../duchess/MoveList.h"
+#include "../../duchess/Position.h"
+#include "../../duchess/Piece.h"
+#include "../../duchess/CompactMove.h"
+
+#include <cassert>
+#include <vector>
+#include <algorithm>
+
+void TestMovePicker::runTests() {
+    TestMovePicker::test_pickOrder();
+    TestMovePicker::test_capturesFirst();
+    TestMovePicker::test_losingCapturesAfterKillers();
+    TestMovePicker::test_history();
+    TestMovePicker::test_counterMove();
+    TestMovePicker::test_nullMove();
+}
+
+void TestMovePicker::test_pickOrder() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setHeuristic(Heuristic::KILLER_MOVE);
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+
+    Board board;
+    board.initialiseAttDefVectors();
+    MoveList moves;
+    board.getLegalMoves(1, moves);
+    const std::vector<Move> generated = moves.toVector();
+
+    SearchContext context;
+    context.startSearch(1);
+    context.markMoveAsKiller(board.toCompactMove(generated[3]), 2);
+    context.markMoveAsKiller(board.toCompactMove(generated[5]), 2);
+    // Not a legal move here, so never picked
+    context.markMoveAsKiller(CompactMove(1, 2), 3);
+
+    // The last line's move, then the table's, then the killers (newest first)
+    MovePicker picker (moves, board, brain, context, 1, 2, Move(), generated[6], generated[2]);
+    std::vector<Move> picked;
+    Move move;
+    while (picker.next(move)) {
+        picked.push_back(move);
+    }
+    assert(picked.size() == generated.size());
+    assert(picked[0] == generated[6]);
+    assert(picked[1] == generated[2]);
+    assert(picked[2] == generated[5]);
+    assert(picked[3] == generated[3]);
+    for (auto const& generatedMove : generated) {
+        assert(std::count(picked.begin(), picked.end(), generatedMove) == 1);
+    }
+    assert(!picker.next(move));
+
+    // The killers belong to ply 2 only
+    MoveList otherMoves;
+    board.getLegalMoves(1, otherMoves);
+    MovePicker otherPicker (otherMoves, board, brain, context, 1, 3, Move(), Move(), Move());
+    otherPicker.next(move);
+    assert(move == generated[0]);
+}
+
+void TestMovePicker::test_capturesFirst() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setHeuristic(Heuristic::KILLER_MOVE);
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+
+    // Player 1 can take a Queen or a Knight
+    Board board;
+    Position p1c3 ("1c3");
+    Position p1c5 ("1c5");
+    Position p1b6 ("1b6");
+    Position p1d6 ("1d6");
+    Position p2c2 ("2c2");
+    Position p6b2 ("6b2");
+
+    Piece* pawn1c3 = board.getPieceAtPosition(&p1c3);
+    Piece* queen2c2 = board.getPieceAtPosition(&p2c2);
+    Piece* knight6b2 = board.getPieceAtPosition(&p6b2);
+    board.setPiecePosition(pawn1c3, &p1c5);
+    board.setPiecePosition(queen2c2, &p1b6);
+    board.setPiecePosition(knight6b2, &p1d6);
+    board.initialiseAttDefVectors();
+
+    MoveList moves;
+    board.getLegalMoves(1, moves);
+    const Move quietMove = *std::find_if(moves.begin(), moves.end(), [] (const Move& t_move) -> bool {
+        return t_move.getPieceTaken() == nullptr && t_move.getReplacePiece() == nullptr;
+    });
+    SearchContext context;
+    context.startSearch(1);
+    context.markMoveAsKiller(board.toCompactMove(quietMove), 0);
+
+    // Every capture (biggest first) comes before the killer
+    MovePicker picker (moves, board, brain, context, 1, 0, Move(), Move(), Move());
+    Move move;
+    picker.next(move);
+    assert(move.getPieceTaken() == queen2c2);
+    double lastValue = brain.getValueOfPiece(queen2c2);
+    while (picker.next(move) && move.getPieceTaken() != nullptr) {
+        assert(brain.getValueOfPiece(move.getPieceTaken()) <= lastValue);
+        lastValue = brain.getValueOfPiece(move.getPieceTaken());
+    }
+    assert(move == quietMove);
+}
+
+void TestMovePicker::test_losingCapturesAfterKillers() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setHeuristic(Heuristic::KILLER_MOVE);
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+
+    // Player 1's duchess can take player 2's pawn, but player 4's knight would take the duchess back
+    Board board;
+    Position p1c3 ("1c3");
+    Position p1e3 ("1e3");
+    Position p1d4 ("1d4");
+    Position p1c6 ("1c6");
+    Position offBoard ("OB");
+    Piece* pawn2 = board.getPiecesForPlayer(2)[0];
+    Piece* knight4 = board.getPiecesForPlayer(4)[6];
+    board.setPiecePosition(pawn2, &p1d4);
+    board.setPiecePosition(knight4, &p1c6);
+    board.setPiecePosition(board.getPieceAtPosition(&p1c3), &offBoard);
+    board.setPiecePosition(board.getPieceAtPosition(&p1e3), &offBoard);
+    board.initialiseAttDefVectors();
+
+    MoveList moves;
+    board.getLegalMoves(1, moves);
+    const Move duchessTakesPawn = *std::find_if(moves.begin(), moves.end(), [&] (const Move& t_move) -> bool {
+        return t_move.getPieceTaken() == pawn2;
+    });
+    assert(brain.getStaticExchangeEvaluation(board, duchessTakesPawn) < 0);
+
+    // So it's tried after the killer, but still ahead of the other quiet moves. Taking the knight with our queen
+    // (which can now get at it) wins material, so comes before either
+    const Move quietMove = *std::find_if(moves.begin(), moves.end(), [] (const Move& t_move) -> bool {
+        return t_move.getPieceTaken() == nullptr && t_move.getReplacePiece() == nullptr;
+    });
+    SearchContext context;
+    context.startSearch(1);
+    context.markMoveAsKiller(board.toCompactMove(quietMove), 0);
+    MovePicker picker (moves, board, brain, context, 1, 0, Move(), Move(), Move());
+    Move move;
+    picker.next(move);
+    assert(move.getPieceTaken() == knight4);
+    picker.next(move);
+    assert(move == quietMove);
+    // Our bishop can take a defended pawn too
+    bool duchessPicked = false;
+    while (picker.next(move) && move.getPieceTaken() != nullptr) {
+        assert(brain.getStaticExchangeEvaluation(board, move) < 0);
+        duchessPicked = duchessPicked || move == duchessTakesPawn;
+    }
+    assert(duchessPicked);
+    while (picker.next(move)) {
+        assert(move.getPieceTaken() == nullptr);
+    }
+}
+
+void TestMovePicker::test_history() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setHeuristic(Heuristic::HISTORY);
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+
+    Board board;
+    board.initialiseAttDefVectors();
+    MoveList moves;
+    board.getLegalMoves(1, moves);
+    const std::vector<Move> generated = moves.toVector();
+
+    SearchContext context;
+    context.markMoveAsHistory(board.toCompactMove(generated[3]), 2, 1);
+    context.markMoveAsHistory(board.toCompactMove(generated[6]), 3, 1);
+    // Another player's history doesn't count
+    context.markMoveAsHistory(board.toCompactMove(generated[1]), 4, 2);
+
+    MovePicker picker (moves, board, brain, context, 1, 0, Move(), Move(), Move());
+    Move move;
+    picker.next(move);
+    assert(move == generated[6]);
+    picker.next(move);
+    assert(move == generated[3]);
+    unsigned int numPicked = 2;
+    while (picker.next(move)) {
+        assert(move != generated[6] && move != generated[3]);
+        ++numPicked;
+    }
+    assert(numPicked == generated.size());
+}
+
+void TestMovePicker::test_counterMove() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setHeuristic(Heuristic::BEST_REPLY);
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+
+    Board board;
+    board.initialiseAttDefVectors();
+    MoveList parentMoves;
+    board.getLegalMoves(6, parentMoves);
+    const Move parentMove = parentMoves[0];
+    MoveList moves;
+    board.getLegalMoves(1, moves);
+    const std::vector<Move> generated = moves.toVector();
+
+    // Matched by its squares alone
+    SearchContext context;
+    context.markCounterMove(1, board.toCompactMove(parentMove), CompactMove(generated[4].getFromPosition()->getBoardIndex(), generated[4].getToPosition()->getBoardIndex()));
+
+    MovePicker picker (moves, board, brain, context, 1, 0, parentMove, Move(), Move());
+    Move move;
+    picker.next(move);
+    assert(move == generated[4]);
+
+    // Only in answer to that move
+    MoveList otherMoves;
+    board.getLegalMoves(1, otherMoves);
+    MovePicker otherPicker (otherMoves, board, brain, context, 1, 0, parentMoves[1], Move(), Move());
+    otherPicker.next(move);
+    assert(move == generated[0]);
+
+    // A player with no legal moves left has only the null move, which has no squares to match the countermove's
+    MoveList nullMoves;
+    nullMoves.push_back(Move());
+    MovePicker nullPicker (nullMoves, board, brain, context, 1, 0, parentMove, Move(), Move());
+    assert(nullPicker.next(move));
+    assert(move.isNull());
+}
+
+void TestMovePicker::test_nullMove() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+
+    Board board;
+    board.initialiseAttDefVectors();
+    MoveList parentMoves;
+    board.getLegalMoves(6, parentMoves);
+    MoveList firstMoves;
+    board.getLegalMoves(1, firstMoves);
+
+    // Every heuristic has something stored that it could look the move up against
+    SearchContext context;
+    context.markMoveAsKiller(board.toCompactMove(firstMoves[0]), 0);
+    context.markMoveAsHistory(board.toCompactMove(firstMoves[0]), 2, 1);
+    context.markCounterMove(1, board.toCompactMove(parentMoves[0]), board.toCompactMove(firstMoves[0]));
+
+    // A checkmated or stalemated player's only move is the null move, which still gets picked
+    const Heuristic heuristics[] = {Heuristic::NONE, Heuristic::RANDOM, Heuristic::KILLER_MOVE, Heuristic::BEST_REPLY, Heuristic::HISTORY};
+    for (const Heuristic heuristic : heuristics) {
+        brain.setHeuristic(heuristic);
+        MoveList moves;
+        moves.push_back(Move());
+        MovePicker picker (moves, board, brain, context, 1, 0, parentMoves[0], Move(), Move());
+        Move move;
+        assert(picker.next(move));
+        assert(move.isNull());
+        assert(!picker.next(move));
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef DUCHESS_CPP_TESTMOVEPICKER_H
+#define DUCHESS_CPP_TESTMOVEPICKER_H
+
+class TestMovePicker {
+public:
+    static void runTests();
+
+private:
+    static void test_pickOrder();
+    static void test_capturesFirst();
+    static void test_losingCapturesAfterKillers();
+    static void test_history();
+    static void test_counterMove();
+    static void test_nullMove();
+};
+
+#endif //DUCHESS_CPP_TESTMOVEPICKER_H
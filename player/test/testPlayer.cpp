@@ -1,5 +1,7 @@
 #include <cassert>
 #include <algorithm>
+#include <cmath>
+#include <climits>
 #include <iostream>
 #include <vector>
 
@@ -9,18 +11,90 @@
 #include "../PlayerType.h"
 #include "../Heuristic.h"
 #include "../FeatureSet.h"
+#include "../SearchAnalytics.h"
+#include "../TimeControl.h"
+#include "../PrincipalVariation.h"
+#include "../SearchContext.h"
+#include "../ParallelSearchMode.h"
+#include "../WorkStealingPool.h"
+#include "../YoungBrothersWaitSearch.h"
 #include "../../duchess/EvaluationMode.h"
 
 #include "../../duchess/Board.h"
 #include "../../duchess/Position.h"
+#include "../../duchess/PositionUtils.h"
 #include "../../duchess/Move.h"
+#include "../../duchess/MoveList.h"
+#include "../../duchess/CompactMove.h"
 #include "../../duchess/Piece.h"
 
 
+// The position test_alphaBetaMakesSmartMoves is about, with t_brain set up to search it: pawn 1c3 moved to 1c5, the
+// Queen 2c2 to 1b6 and the Knight 6b2 to 1d6, so that player 1's pawn can take the Queen. Returns the Queen
+static Piece* setUpQueenCapture(Board& t_board, Brain& t_brain) {
+    t_brain.setHeuristic(Heuristic::KILLER_MOVE);
+    t_brain.setFeatureSet(FeatureSet::MATERIAL);
+    t_brain.setEvaluationMode(EvaluationMode::CUMULATIVE);
+
+    Position p1c3 ("1c3");
+    Position p1c5 ("1c5");
+    Position p1b6 ("1b6");
+    Position p1d6 ("1d6");
+    Position p2c2 ("2c2");
+    Position p6b2 ("6b2");
+
+    Piece* pawn1c3 = t_board.getPieceAtPosition(&p1c3);
+    Piece* queen2c2 = t_board.getPieceAtPosition(&p2c2);
+    Piece* knight6b2 = t_board.getPieceAtPosition(&p6b2);
+    t_board.setPiecePosition(pawn1c3, &p1c5);
+    t_board.setPiecePosition(queen2c2, &p1b6);
+    t_board.setPiecePosition(knight6b2, &p1d6);
+    t_board.initialiseAttDefVectors();
+    return queen2c2;
+}
+
+// Moves t_attacker's knight a knight's move from t_king's king (taking whatever was there off the board), putting
+// them in check
+static void putInCheck(Board& t_board, const short t_king, const short t_attacker) {
+    const Position* kingPosition = t_board.getPiecesForPlayer(t_king)[12]->getPosition();
+    const BoardIndex square = PositionUtils::getKnightMovesFromPosition(kingPosition)[0];
+    Piece* occupant = t_board.getPieceAtPosition(square);
+    if (occupant != nullptr) {
+        Position offBoard ("OB");
+        t_board.setPiecePosition(occupant, &offBoard);
+    }
+    t_board.setPiecePosition(t_board.getPiecesForPlayer(t_attacker)[6], square);
+    t_board.initialiseAttDefVectors();
+}
+
+// Clears 2b3 and moves player 1's Knight to 3e5, so that it can check player 2's King by moving there. Returns that move
+static Move setUpQuietCheck(Board& t_board) {
+    Position p2b3 ("2b3");
+    Position p3e5 ("3e5");
+    Position offBoard ("OB");
+
+    t_board.setPiecePosition(t_board.getPieceAtPosition(&p2b3), &offBoard);
+    t_board.setPiecePosition(t_board.getPiecesForPlayer(1)[6], &p3e5);
+    t_board.initialiseAttDefVectors();
+    return Move(t_board.getPosition(&p3e5), t_board.getPosition(&p2b3), nullptr);
+}
+
 void TestPlayer::runTests() {
     TestPlayer::test_playerGetterMethods();
     TestPlayer::test_AIReturnsAMove();
     TestPlayer::test_alphaBetaMakesSmartMoves();
+    TestPlayer::test_parallelSearch();
+    TestPlayer::test_youngBrothersWait();
+    TestPlayer::test_hardDeadline();
+    TestPlayer::test_quiescenceSearch();
+    TestPlayer::test_nullMovePruning();
+    TestPlayer::test_isNullMoveSafe();
+    TestPlayer::test_lateMoveReductionsAndFutility();
+    TestPlayer::test_pruningKeepsCapturesAndChecks();
+    TestPlayer::test_pruningKeepsForcedMoves();
+    TestPlayer::test_principalVariationSearch();
+    TestPlayer::test_aspirationWindow();
+    TestPlayer::test_iterativeDeepeningOrdering();
 }
 
 void TestPlayer::test_playerGetterMethods() {
@@ -45,36 +119,578 @@ void TestPlayer::test_AIReturnsAMove() {
 
 void TestPlayer::test_alphaBetaMakesSmartMoves() {
     Brain brain ("../weights/wcci/materialCheck.wts");
+
+    // Make sure player 1 prefers to take the Queen using pawn1
+    Board board;
+    Piece* queen2c2 = setUpQueenCapture(board, brain);
+
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+
+    Move m = p1.chooseMove(&board, 13);
+
+    assert(m.getPieceTaken() == queen2c2);
+    assert(*(m.getFromPosition()) == Position("1c5"));
+    assert(*(m.getToPosition()) == Position("1b6"));
+
+}
+
+void TestPlayer::test_parallelSearch() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setNumSearchThreads(4);
+    assert(brain.getNumSearchThreads() == 4);
+
+    // Player 1 should still take the Queen
+    Board board;
+    Piece* queen2c2 = setUpQueenCapture(board, brain);
+    const ZobristKey hashBefore = board.getHash();
+
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+
+    MoveList validMoves;
+    board.getLegalMoves(1, validMoves);
+    SearchAnalytics analytics (13, board.getNumPieces());
+    Move m = p1.searchForMove(&board, validMoves, 13, analytics);
+
+    assert(m.getPieceTaken() == queen2c2);
+    assert(*(m.getFromPosition()) == Position("1c5"));
+    assert(*(m.getToPosition()) == Position("1b6"));
+
+    // The helpers searched their own copies, so the board is just as it was
+    assert(board.getHash() == hashBefore);
+    assert(analytics.getNumThreads() == 4);
+    assert(analytics.getSearchDepth() >= 2);
+    assert(analytics.getTotalNodesEvaluated() > 0);
+
+    // Learning never uses helpers
+    brain.setLearning(true);
+    SearchAnalytics learningAnalytics (13, board.getNumPieces());
+    p1.searchForMove(&board, validMoves, 13, learningAnalytics);
+    assert(learningAnalytics.getNumThreads() == 1);
+}
+
+void TestPlayer::test_youngBrothersWait() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setParallelSearchMode(ParallelSearchMode::YOUNG_BROTHERS_WAIT);
+    brain.setNumSearchThreads(3);
+
+    // Player 1 should still take the Queen
+    Board board;
+    Piece* queen2c2 = setUpQueenCapture(board, brain);
+    const ZobristKey hashBefore = board.getHash();
+
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+
+    MoveList validMoves;
+    board.getLegalMoves(1, validMoves);
+
+    // Deep enough to split below the root as well as at it
+    const int depth = YoungBrothersWaitSearch::MIN_SPLIT_DEPTH + 1;
+
+    // However many workers it's split between, the search finds the capture and leaves the board as it was
+    for (auto const numWorkers : {1, 3, 3}) {
+        brain.getTranspositionTable().clear();
+        WorkStealingPool pool (numWorkers);
+        YoungBrothersWaitSearch search (p1, pool);
+        SearchAnalytics analytics (13, board.getNumPieces());
+        SearchContext context;
+        context.startSearch(13);
+        Move m = search.searchFromRoot(validMoves, &board, depth, &analytics, context, 13);
+
+        assert(m.getPieceTaken() == queen2c2);
+        assert(*(m.getFromPosition()) == Position("1c5"));
+        assert(*(m.getToPosition()) == Position("1b6"));
+        assert(board.getHash() == hashBefore);
+        assert(analytics.getTotalNodesEvaluated() > 0);
+        // Split nodes use the transposition table like everywhere else
+        assert(analytics.getTranspositionProbes() > 0);
+    }
+
+    // And searchForMove picks it up from the brain
+    SearchAnalytics analytics (13, board.getNumPieces());
+    Move m = p1.searchForMove(&board, validMoves, 13, analytics);
+    assert(m.getPieceTaken() == queen2c2);
+    assert(analytics.getNumThreads() == 3);
+}
+
+void TestPlayer::test_hardDeadline() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
     brain.setHeuristic(Heuristic::KILLER_MOVE);
     brain.setFeatureSet(FeatureSet::MATERIAL);
     brain.setEvaluationMode(EvaluationMode::CUMULATIVE);
 
     Board board;
-    // Move pawn 1c3 to 1c5
-    // Move Queen 2c2 to 1b6, Knight 6b2 to 1d6
-    // Make sure player 1 prefers to take the Queen using pawn1
-    Position p1c3 ("1c3");
-    Position p1c5 ("1c5");
-    Position p1b6 ("1b6");
-    Position p1d6 ("1d6");
-    Position p2c2 ("2c2");
-    Position p6b2 ("6b2");
-
-    Piece* pawn1c3 = board.getPieceAtPosition(&p1c3);
-    Piece* queen2c2 = board.getPieceAtPosition(&p2c2);
-    Piece* knight6b2 = board.getPieceAtPosition(&p6b2);
-    board.setPiecePosition(pawn1c3, &p1c5);
-    board.setPiecePosition(queen2c2, &p1b6);
-    board.setPiecePosition(knight6b2, &p1d6);
     board.initialiseAttDefVectors();
+    const ZobristKey hashBefore = board.getHash();
 
     Player p1 (PlayerType::AI, 1);
     p1.setBrain(&brain);
 
-    Move m = p1.chooseMove(&board, 13);
+    MoveList validMoves;
+    board.getLegalMoves(1, validMoves);
+    const std::vector<Move> legalMoves = validMoves.toVector();
+
+    // With no time at all, the search gives up before the depths it would otherwise always finish, and still comes
+    // back with a legal move. Likewise with helper threads
+    for (auto const numThreads : {1, 4}) {
+        brain.setNumSearchThreads(numThreads);
+        SearchAnalytics analytics (1, board.getNumPieces());
+        Move m = p1.searchForMove(&board, validMoves, 1, analytics, TimeControl::perMove(0));
 
+        assert(std::find(legalMoves.begin(), legalMoves.end(), m) != legalMoves.end());
+        assert(analytics.getSearchDepth() < 3);
+        assert(board.getHash() == hashBefore);
+    }
+
+    // Learning always finishes what it starts
+    brain.setNumSearchThreads(1);
+    brain.setLearning(true);
+    SearchAnalytics learningAnalytics (1, board.getNumPieces());
+    p1.searchForMove(&board, validMoves, 1, learningAnalytics, TimeControl::perMove(0));
+    assert(learningAnalytics.getSearchDepth() >= 3);
+}
+
+void TestPlayer::test_quiescenceSearch() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    assert(brain.usesQuiescenceSearch());
+
+    // Player 1 can take the Queen
+    Board board;
+    Piece* queen2c2 = setUpQueenCapture(board, brain);
+    const ZobristKey hashBefore = board.getHash();
+
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+
+    // Taking the Queen is worth more than standing pat
+    const double standPat = brain.evaluateBoardState(board, 1);
+    SearchAnalytics analytics (13, board.getNumPieces());
+    const double value = p1.quiescenceSearch(&board, -INFINITY, INFINITY, 1, &analytics, 0);
+    assert(value > standPat);
+    assert(analytics.getQuiescenceNodes() > 1);
+    assert(analytics.getTotalNodesEvaluated() == 0);
+    assert(board.getHash() == hashBefore);
+
+    // Once it's gone as deep as it's allowed, it just stands pat
+    SearchAnalytics deepAnalytics (13, board.getNumPieces());
+    assert(p1.quiescenceSearch(&board, -INFINITY, INFINITY, 1, &deepAnalytics, Player::MAX_QUIESCENCE_DEPTH) == standPat);
+    assert(deepAnalytics.getQuiescenceNodes() == 1);
+
+    // The full search counts its quiescence nodes separately, and none at all when it's turned off
+    MoveList validMoves;
+    board.getLegalMoves(1, validMoves);
+    SearchAnalytics searchAnalytics (13, board.getNumPieces());
+    p1.alphaBetaFromRoot(validMoves, &board, 2, &searchAnalytics, 13);
+    assert(searchAnalytics.getQuiescenceNodes() > 0);
+
+    // Learning trains on the leaves as they are, so never extends them
+    brain.setLearning(true);
+    SearchAnalytics learningAnalytics (13, board.getNumPieces());
+    p1.alphaBetaFromRoot(validMoves, &board, 2, &learningAnalytics, 13);
+    assert(learningAnalytics.getQuiescenceNodes() == 0);
+    brain.setLearning(false);
+
+    brain.setQuiescenceSearch(false);
+    SearchAnalytics withoutAnalytics (13, board.getNumPieces());
+    const Move m = p1.alphaBetaFromRoot(validMoves, &board, 2, &withoutAnalytics, 13);
+    assert(withoutAnalytics.getQuiescenceNodes() == 0);
     assert(m.getPieceTaken() == queen2c2);
-    assert(*(m.getFromPosition()) == p1c5);
-    assert(*(m.getToPosition()) == p1b6);
+}
+
+void TestPlayer::test_nullMovePruning() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    assert(brain.usesNullMovePruning());
+
+    // Player 1 can take the Queen
+    Board board;
+    Piece* queen2c2 = setUpQueenCapture(board, brain);
+    const ZobristKey hashBefore = board.getHash();
 
-}
\ No newline at end of file
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+    MoveList validMoves;
+    board.getLegalMoves(1, validMoves);
+
+    // Deep enough for null moves to be tried below the root, and some of them cut nodes short
+    SearchAnalytics analytics (13, board.getNumPieces());
+    const Move move = p1.alphaBetaFromRoot(validMoves, &board, 4, &analytics, 13);
+    assert(move.getPieceTaken() == queen2c2);
+    assert(analytics.getNullMoveSearches() > 0);
+    assert(analytics.getNullMoveCutoffs() > 0);
+    assert(analytics.getNullMoveCutoffs() + analytics.getNullMoveVerificationFailures() <= analytics.getNullMoveSearches());
+    assert(board.getHash() == hashBefore);
+
+    // Which saves searching some nodes, without changing the move. The first search's transposition table entries
+    // would otherwise answer most of the second
+    brain.setNullMovePruning(false);
+    brain.getTranspositionTable().clear();
+    SearchAnalytics withoutAnalytics (13, board.getNumPieces());
+    const Move withoutMove = p1.alphaBetaFromRoot(validMoves, &board, 4, &withoutAnalytics, 13);
+    assert(withoutMove == move);
+    assert(withoutAnalytics.getNullMoveSearches() == 0);
+    assert(withoutAnalytics.getTotalNodesEvaluated() > analytics.getTotalNodesEvaluated());
+
+    // Learning never prunes
+    brain.setNullMovePruning(true);
+    brain.setLearning(true);
+    SearchAnalytics learningAnalytics (13, board.getNumPieces());
+    p1.alphaBetaFromRoot(validMoves, &board, 4, &learningAnalytics, 13);
+    assert(learningAnalytics.getNullMoveSearches() == 0);
+}
+
+void TestPlayer::test_isNullMoveSafe() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+
+    // Nothing stops player 1 passing from the start
+    Board board;
+    board.initialiseAttDefVectors();
+    assert(p1.isNullMoveSafe(board, 1, 0));
+
+    // Not when a win for either side is in sight
+    assert(!p1.isNullMoveSafe(board, 1, Brain::WINNING_MOVE_SCORE / 2));
+    assert(!p1.isNullMoveSafe(board, 1, -Brain::WINNING_MOVE_SCORE / 2));
+    assert(p1.isNullMoveSafe(board, 1, Brain::WINNING_MOVE_SCORE / 4));
+
+    // Not when in check
+    Board inCheck;
+    putInCheck(inCheck, 1, 2);
+    assert(inCheck.isPlayerInCheck(1));
+    assert(!p1.isNullMoveSafe(inCheck, 1, 0));
+
+    // Nor when a teammate is, since passing hands the next seat a free move at them
+    Board teammateInCheck;
+    putInCheck(teammateInCheck, 3, 2);
+    assert(!teammateInCheck.isPlayerInCheck(1));
+    assert(teammateInCheck.isPlayerInCheck(3));
+    assert(!p1.isNullMoveSafe(teammateInCheck, 1, 0));
+    // An opponent in check doesn't matter
+    Board opponentInCheck;
+    putInCheck(opponentInCheck, 2, 1);
+    assert(opponentInCheck.isPlayerInCheck(2));
+    assert(p1.isNullMoveSafe(opponentInCheck, 1, 0));
+
+    // Nor with fewer than NULL_MOVE_MIN_PIECES pieces besides pawns and the king
+    Board fewPieces;
+    Position offBoard ("OB");
+    int piecesLeft = 0;
+    for (auto const& piece : fewPieces.getPiecesForPlayer(1)) {
+        if (piece->getType() != PieceType::PAWN && piece->getType() != PieceType::KING) {
+            if (piecesLeft < Player::NULL_MOVE_MIN_PIECES) {
+                ++piecesLeft;
+            } else {
+                fewPieces.setPiecePosition(piece, &offBoard);
+            }
+        }
+    }
+    fewPieces.initialiseAttDefVectors();
+    assert(p1.isNullMoveSafe(fewPieces, 1, 0));
+    for (auto const& piece : fewPieces.getPiecesForPlayer(1)) {
+        if (piece->getType() != PieceType::PAWN && piece->getType() != PieceType::KING && !piece->getPosition()->isOffBoard()) {
+            fewPieces.setPiecePosition(piece, &offBoard);
+            break;
+        }
+    }
+    fewPieces.initialiseAttDefVectors();
+    assert(!p1.isNullMoveSafe(fewPieces, 1, 0));
+}
+
+void TestPlayer::test_lateMoveReductionsAndFutility() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setNullMovePruning(false);
+    assert(brain.usesLateMoveReductions());
+    assert(brain.usesFutilityPruning());
+
+    // Player 1 can take the Queen
+    Board board;
+    Piece* queen2c2 = setUpQueenCapture(board, brain);
+    const ZobristKey hashBefore = board.getHash();
+
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+    MoveList validMoves;
+    board.getLegalMoves(1, validMoves);
+
+    // Late quiet moves are searched less deeply, and hopeless ones near the leaves not at all
+    SearchAnalytics analytics (13, board.getNumPieces());
+    const Move move = p1.alphaBetaFromRoot(validMoves, &board, 4, &analytics, 13);
+    assert(move.getPieceTaken() == queen2c2);
+    assert(analytics.getLateMoveReductions() > 0);
+    assert(analytics.getLateMoveResearches() <= analytics.getLateMoveReductions());
+    assert(analytics.getFutilityPrunes() > 0);
+    assert(board.getHash() == hashBefore);
+
+    // Which saves searching some nodes, without changing the move. The first search's transposition table entries
+    // would otherwise answer most of the second
+    brain.setLateMoveReductions(false);
+    brain.setFutilityPruning(false);
+    brain.getTranspositionTable().clear();
+    SearchAnalytics withoutAnalytics (13, board.getNumPieces());
+    const Move withoutMove = p1.alphaBetaFromRoot(validMoves, &board, 4, &withoutAnalytics, 13);
+    assert(withoutMove == move);
+    assert(withoutAnalytics.getLateMoveReductions() == 0);
+    assert(withoutAnalytics.getFutilityPrunes() == 0);
+    assert(withoutAnalytics.getTotalNodesEvaluated() > analytics.getTotalNodesEvaluated());
+
+    // Learning never reduces or prunes
+    brain.setLateMoveReductions(true);
+    brain.setFutilityPruning(true);
+    brain.setLearning(true);
+    SearchAnalytics learningAnalytics (13, board.getNumPieces());
+    p1.alphaBetaFromRoot(validMoves, &board, 4, &learningAnalytics, 13);
+    assert(learningAnalytics.getLateMoveReductions() == 0);
+    assert(learningAnalytics.getFutilityPrunes() == 0);
+}
+
+void TestPlayer::test_pruningKeepsCapturesAndChecks() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setNullMovePruning(false);
+
+    // Player 1 can take the Queen, which wins far more than the futility margin. With alpha where material plus the
+    // margin only just reaches it, every quiet move but the first is pruned, but the capture still raises alpha
+    Board board;
+    setUpQueenCapture(board, brain);
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+    const double alpha = brain.getMaterialBalance(board, 1) + Player::FUTILITY_MARGIN;
+
+    SearchContext context;
+    context.startSearch(13);
+    brain.setFutilityPruning(false);
+    SearchAnalytics withoutAnalytics (13, board.getNumPieces());
+    const double withoutValue = p1.alphaBetaMoveSearch(&board, 1, alpha, INFINITY, 1, &withoutAnalytics, context, 13, Move(), 1);
+    assert(withoutValue > alpha);
+
+    brain.setFutilityPruning(true);
+    brain.getTranspositionTable().clear();
+    SearchAnalytics analytics (13, board.getNumPieces());
+    const double value = p1.alphaBetaMoveSearch(&board, 1, alpha, INFINITY, 1, &analytics, context, 13, Move(), 1);
+    assert(analytics.getFutilityPrunes() > 0);
+    assert(value == withoutValue);
+
+    // Quiet moves that give check are never passed over either. Futility pruning and late move reductions make that
+    // decision together, so this covers both
+    Board checkBoard;
+    const Move check = setUpQuietCheck(checkBoard);
+    assert(checkBoard.doesQuietMoveGiveCheck(check));
+    MoveList moves;
+    checkBoard.getLegalMoves(1, moves);
+    assert(std::find(moves.begin(), moves.end(), check) != moves.end());
+
+    // Make a quiet move that doesn't give check come first, so that exactly the captures and checks follow it
+    Move firstMove;
+    int numQuiet = 0;
+    int numCapturesAndChecks = 0;
+    for (auto const& move : moves) {
+        const bool isQuiet = move.getPieceTaken() == nullptr && move.getReplacePiece() == nullptr;
+        if (isQuiet && !checkBoard.doesQuietMoveGiveCheck(move)) {
+            ++numQuiet;
+            if (firstMove.isNull()) {
+                firstMove = move;
+            }
+        } else {
+            ++numCapturesAndChecks;
+        }
+    }
+    PrincipalVariation firstLine;
+    firstLine.update(checkBoard.toCompactMove(firstMove), PrincipalVariation());
+
+    brain.getTranspositionTable().clear();
+    SearchAnalytics checkAnalytics (13, checkBoard.getNumPieces());
+    const double checkAlpha = brain.getMaterialBalance(checkBoard, 1) + Player::FUTILITY_MARGIN;
+    p1.alphaBetaMoveSearch(&checkBoard, 1, checkAlpha, INFINITY, 1, &checkAnalytics, context, 13, Move(), 1, nullptr, nullptr, &firstLine);
+    assert(checkAnalytics.getFutilityPrunes() == numQuiet - 1);
+    assert(checkAnalytics.getTotalNodesEvaluated() == 1 + numCapturesAndChecks);
+}
+
+void TestPlayer::test_pruningKeepsForcedMoves() {
+    // Player 1 has a free Queen to take at one position, and has to take the Knight checking them at the other. Every
+    // combination of pruning finds the same move at every depth as a full-width search does
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    Board queenBoard;
+    Piece* queen2c2 = setUpQueenCapture(queenBoard, brain);
+    Board checkedBoard;
+    putInCheck(checkedBoard, 1, 2);
+    Piece* knight = checkedBoard.getPiecesForPlayer(2)[6];
+
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+
+    for (Board* board : {&queenBoard, &checkedBoard}) {
+        const Piece* mustTake = board == &queenBoard ? queen2c2 : knight;
+        MoveList validMoves;
+        board->getLegalMoves(1, validMoves);
+
+        int depth;
+        for (depth = 1; depth <= 4; ++depth) {
+            Move fullWidthMove;
+            int options;
+            for (options = 0; options < 8; ++options) {
+                brain.setNullMovePruning(options & 1);
+                brain.setLateMoveReductions(options & 2);
+                brain.setFutilityPruning(options & 4);
+                brain.getTranspositionTable().clear();
+                SearchAnalytics analytics (13, board->getNumPieces());
+                const Move move = p1.alphaBetaFromRoot(validMoves, board, depth, &analytics, 13);
+                assert(move.getPieceTaken() == mustTake);
+                if (options == 0) {
+                    fullWidthMove = move;
+                }
+                assert(move == fullWidthMove);
+            }
+        }
+    }
+}
+
+void TestPlayer::test_principalVariationSearch() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setMaxSearchDepth(3);
+    assert(brain.usesPrincipalVariationSearch());
+
+    // Player 1 should still take the Queen
+    Board board;
+    Piece* queen2c2 = setUpQueenCapture(board, brain);
+    const ZobristKey hashBefore = board.getHash();
+
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+    MoveList validMoves;
+    board.getLegalMoves(1, validMoves);
+
+    // With no time limit, both searches stop at the maximum depth
+    SearchAnalytics pvsAnalytics (13, board.getNumPieces());
+    const Move pvsMove = p1.searchForMove(&board, validMoves, 13, pvsAnalytics, TimeControl::perMove(INT_MAX));
+    assert(pvsMove.getPieceTaken() == queen2c2);
+    assert(pvsAnalytics.getSearchDepth() == 3);
+    assert(board.getHash() == hashBefore);
+
+    // The line starts with the move chosen, and can be played out move by move
+    const PrincipalVariation pv = p1.getPrincipalVariation();
+    assert(pv.size() > 1);
+    assert(pv.size() <= 3);
+    assert(pv[0] == board.toCompactMove(pvsMove));
+    Board line (board);
+    for (auto const& compactMove : pv) {
+        const Move move = line.fromCompactMove(compactMove);
+        assert(line.isLegalMove(move, line.getSideToMove()));
+        line.applyMove(&move, EvaluationMode::CUMULATIVE);
+    }
+
+    // Plain alpha-beta agrees, and never uses null windows
+    brain.getTranspositionTable().clear();
+    brain.setPrincipalVariationSearch(false);
+    SearchAnalytics fullAnalytics (13, board.getNumPieces());
+    const Move fullMove = p1.searchForMove(&board, validMoves, 13, fullAnalytics, TimeControl::perMove(INT_MAX));
+    assert(fullMove == pvsMove);
+    assert(fullAnalytics.getSearchDepth() == 3);
+    assert(fullAnalytics.getNullWindowResearches() == 0);
+    assert(fullAnalytics.getAspirationFailures() == 0);
+    assert(p1.getPrincipalVariation()[0] == board.toCompactMove(fullMove));
+}
+
+void TestPlayer::test_aspirationWindow() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setHeuristic(Heuristic::KILLER_MOVE);
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+    brain.setEvaluationMode(EvaluationMode::CUMULATIVE);
+
+    Board board;
+    board.initialiseAttDefVectors();
+    const ZobristKey hashBefore = board.getHash();
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+    MoveList validMoves;
+    board.getLegalMoves(1, validMoves);
+
+    // Nothing is cut short by the table between searches, so each is searched from scratch
+    double score;
+    PrincipalVariation pv;
+    SearchAnalytics analytics (1, board.getNumPieces());
+    SearchContext context;
+    const Move move = p1.alphaBetaFromRoot(validMoves, &board, 2, &analytics, context, 1, -INFINITY, INFINITY, score, pv);
+    assert(std::isfinite(score));
+    assert(pv[0] == board.toCompactMove(move));
+
+    // A window around the score finds it exactly
+    brain.getTranspositionTable().clear();
+    double insideScore;
+    p1.alphaBetaFromRoot(validMoves, &board, 2, &analytics, context, 1, score - 1, score + 1, insideScore, pv);
+    assert(std::abs(insideScore - score) < 1e-9);
+
+    // A window above it fails low, and one below it fails high, each giving a bound on the score
+    brain.getTranspositionTable().clear();
+    double lowScore;
+    p1.alphaBetaFromRoot(validMoves, &board, 2, &analytics, context, 1, score + 1, score + 2, lowScore, pv);
+    assert(lowScore <= score + 1);
+    assert(lowScore >= score - 1e-9);
+
+    brain.getTranspositionTable().clear();
+    double highScore;
+    p1.alphaBetaFromRoot(validMoves, &board, 2, &analytics, context, 1, score - 2, score - 1, highScore, pv);
+    assert(highScore >= score - 1);
+    assert(highScore <= score + 1e-9);
+    assert(board.getHash() == hashBefore);
+}
+
+void TestPlayer::test_iterativeDeepeningOrdering() {
+    Brain brain ("../weights/wcci/materialCheck.wts");
+
+    // Player 1 should take the Queen
+    Board board;
+    Piece* queen2c2 = setUpQueenCapture(board, brain);
+    const ZobristKey hashBefore = board.getHash();
+
+    Player p1 (PlayerType::AI, 1);
+    p1.setBrain(&brain);
+    MoveList rootMoves;
+    board.getLegalMoves(1, rootMoves);
+    const unsigned int numRootMoves = rootMoves.size();
+
+    // The moves are left best first, with the same moves as before
+    double score;
+    PrincipalVariation pv;
+    SearchAnalytics analytics (13, board.getNumPieces());
+    SearchContext context;
+    context.startSearch(13);
+    const Move move = p1.alphaBetaFromRoot(rootMoves, &board, 2, &analytics, context, 13, -INFINITY, INFINITY, score, pv);
+    assert(move.getPieceTaken() == queen2c2);
+    assert(rootMoves.size() == numRootMoves);
+    assert(rootMoves[0] == move);
+    unsigned int i;
+    for (i = 0; i < rootMoves.size(); ++i) {
+        assert(board.isLegalMove(rootMoves[i], 1));
+    }
+
+    // Following that line one ply deeper finds the same move and score as searching without it
+    brain.getTranspositionTable().clear();
+    double followingScore;
+    PrincipalVariation followingPv;
+    MoveList followingMoves = rootMoves;
+    SearchContext followingContext (context);
+    const Move followingMove = p1.alphaBetaFromRoot(followingMoves, &board, 3, &analytics, followingContext, 13, -INFINITY, INFINITY, followingScore, followingPv, &pv);
+
+    brain.getTranspositionTable().clear();
+    double plainScore;
+    PrincipalVariation plainPv;
+    MoveList plainMoves = rootMoves;
+    SearchContext plainContext (context);
+    const Move plainMove = p1.alphaBetaFromRoot(plainMoves, &board, 3, &analytics, plainContext, 13, -INFINITY, INFINITY, plainScore, plainPv);
+
+    assert(followingMove == plainMove);
+    assert(std::abs(followingScore - plainScore) < 1e-9);
+    assert(board.getHash() == hashBefore);
+
+    // A line that doesn't fit the position is ignored
+    brain.getTranspositionTable().clear();
+    PrincipalVariation wrongLine;
+    wrongLine.update(CompactMove(0, 1), PrincipalVariation());
+    double wrongScore;
+    MoveList wrongMoves = rootMoves;
+    SearchContext wrongContext (context);
+    const Move wrongLineMove = p1.alphaBetaFromRoot(wrongMoves, &board, 3, &analytics, wrongContext, 13, -INFINITY, INFINITY, wrongScore, plainPv, &wrongLine);
+    assert(wrongLineMove == plainMove);
+    assert(std::abs(wrongScore - plainScore) < 1e-9);
+}
@@ -8,6 +8,18 @@ private:
     static void test_playerGetterMethods();
     static void test_AIReturnsAMove();
     static void test_alphaBetaMakesSmartMoves();
+    static void test_parallelSearch();
+    static void test_youngBrothersWait();
+    static void test_hardDeadline();
+    static void test_quiescenceSearch();
+    static void test_nullMovePruning();
+    static void test_isNullMoveSafe();
+    static void test_lateMoveReductionsAndFutility();
+    static void test_pruningKeepsCapturesAndChecks();
+    static void test_pruningKeepsForcedMoves();
+    static void test_principalVariationSearch();
+    static void test_aspirationWindow();
+    static void test_iterativeDeepeningOrdering();
 };
 
 #endif //DUCHESS_CPP_TESTPLAYER_H
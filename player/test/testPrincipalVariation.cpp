@@ -0,0 +1,70 @@
+#include "testPrincipalVariation.h"
+#include "../PrincipalVariation.h"
+#include "../../duchess/CompactMove.h"
+
+#include <cassert>
+
+void TestPrincipalVariation::runTests() {
+    TestPrincipalVariation::test_update();
+    TestPrincipalVariation::test_continuation();
+    TestPrincipalVariation::test_capacity();
+}
+
+void TestPrincipalVariation::test_update() {
+    PrincipalVariation line;
+    assert(line.empty());
+    assert(line.begin() == line.end());
+
+    const CompactMove first (10, 20);
+    const CompactMove second (30, 40, 2, 5);
+    const CompactMove third (50, 60);
+
+    // A leaf's line is just its move
+    PrincipalVariation leaf;
+    leaf.update(third, PrincipalVariation());
+    assert(leaf.size() == 1);
+    assert(leaf[0] == third);
+
+    // Each parent puts its move in front of its child's line
+    PrincipalVariation middle;
+    middle.update(second, leaf);
+    line.update(first, middle);
+    assert(line.size() == 3);
+    assert(line[0] == first);
+    assert(line[1] == second);
+    assert(line[2] == third);
+
+    // A better move replaces the whole line
+    line.update(third, PrincipalVariation());
+    assert(line.size() == 1);
+    assert(line[0] == third);
+
+    line.clear();
+    assert(line.empty());
+}
+
+void TestPrincipalVariation::test_continuation() {
+    PrincipalVariation middle;
+    middle.update(CompactMove(30, 40), PrincipalVariation());
+    PrincipalVariation line;
+    line.update(CompactMove(10, 20), middle);
+
+    const PrincipalVariation continuation = line.getContinuation();
+    assert(continuation.size() == 1);
+    assert(continuation[0] == CompactMove(30, 40));
+    assert(continuation.getContinuation().empty());
+    assert(PrincipalVariation().getContinuation().empty());
+}
+
+void TestPrincipalVariation::test_capacity() {
+    // Lines longer than the capacity are cut short rather than overflowing
+    PrincipalVariation line;
+    unsigned int i;
+    for (i = 0; i < PrincipalVariation::CAPACITY + 5; ++i) {
+        PrincipalVariation longer;
+        longer.update(CompactMove(i + 1, i + 2), line);
+        line = longer;
+    }
+    assert(line.size() == PrincipalVariation::CAPACITY);
+    assert(line[0] == CompactMove(PrincipalVariation::CAPACITY + 5, PrincipalVariation::CAPACITY + 6));
+}
@@ -0,0 +1,14 @@
+#ifndef DUCHESS_CPP_TESTPRINCIPALVARIATION_H
+#define DUCHESS_CPP_TESTPRINCIPALVARIATION_H
+
+class TestPrincipalVariation {
+public:
+    static void runTests();
+
+private:
+    static void test_update();
+    static void test_continuation();
+    static void test_capacity();
+};
+
+#endif //DUCHESS_CPP_TESTPRINCIPALVARIATION_H
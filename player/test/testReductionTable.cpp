@@ -0,0 +1,58 @@
+#include "testReductionTable.h"
+#include "../ReductionTable.h"
+
+#include <cassert>
+
+void TestReductionTable::runTests() {
+    TestReductionTable::test_defaultTable();
+    TestReductionTable::test_parameters();
+}
+
+void TestReductionTable::test_defaultTable() {
+    const ReductionTable table;
+    int depth;
+    int moveNumber;
+    for (depth = 1; depth <= ReductionTable::MAX_DEPTH; ++depth) {
+        for (moveNumber = 1; moveNumber <= ReductionTable::MAX_MOVE_NUMBER; ++moveNumber) {
+            const int reduction = table.getReduction(depth, moveNumber);
+            // The first few moves are searched fully, and a reduced search always has a ply left
+            if (moveNumber <= ReductionTable::DEFAULT_FULL_DEPTH_MOVES || depth <= 2) {
+                assert(reduction == 0);
+            }
+            assert(reduction >= 0);
+            assert(reduction <= depth - 2 || reduction == 0);
+            // Later moves and deeper nodes are never reduced less
+            assert(reduction >= table.getReduction(depth - 1, moveNumber));
+            assert(reduction >= table.getReduction(depth, moveNumber - 1));
+        }
+    }
+
+    // Late enough moves far enough from the leaves are reduced
+    assert(table.getReduction(4, 20) > 0);
+    assert(table.getReduction(10, 40) > table.getReduction(4, 20));
+
+    // Past the ends of the table is the same as at them
+    assert(table.getReduction(ReductionTable::MAX_DEPTH + 10, 50) == table.getReduction(ReductionTable::MAX_DEPTH, 50));
+    assert(table.getReduction(10, ReductionTable::MAX_MOVE_NUMBER + 100) == table.getReduction(10, ReductionTable::MAX_MOVE_NUMBER));
+    assert(table.getReduction(0, 50) == 0);
+    assert(table.getReduction(10, 0) == 0);
+}
+
+void TestReductionTable::test_parameters() {
+    const ReductionTable table (1, 1000, 5);
+    assert(table.getBase() == 1);
+    assert(table.getDivisor() == 1000);
+    assert(table.getFullDepthMoves() == 5);
+
+    // Hardly any growth, so just the base once past the first five moves (where there's room)
+    assert(table.getReduction(10, 5) == 0);
+    assert(table.getReduction(10, 6) == 1);
+    assert(table.getReduction(10, 100) == 1);
+    assert(table.getReduction(3, 6) == 1);
+    assert(table.getReduction(2, 6) == 0);
+
+    // A bigger base reduces more, up to leaving one ply
+    const ReductionTable aggressive (3, 1000, 0);
+    assert(aggressive.getReduction(10, 1) == 3);
+    assert(aggressive.getReduction(4, 1) == 2);
+}
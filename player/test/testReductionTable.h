@@ -0,0 +1,12 @@
+#ifndef DUCHESS_CPP_TESTREDUCTIONTABLE_H
+#define DUCHESS_CPP_TESTREDUCTIONTABLE_H
+
+class TestReductionTable {
+public:
+    static void runTests();
+private:
+    static void test_defaultTable();
+    static void test_parameters();
+};
+
+#endif //DUCHESS_CPP_TESTREDUCTIONTABLE_H
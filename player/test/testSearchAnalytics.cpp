@@ -13,6 +13,11 @@ void TestSearchAnalytics::runTests() {
     TestSearchAnalytics::test_turnConversion();
     TestSearchAnalytics::test_piecesOnBoard();
     TestSearchAnalytics::test_reset();
+    TestSearchAnalytics::test_transpositionRates();
+    TestSearchAnalytics::test_merge();
+    TestSearchAnalytics::test_quiescence();
+    TestSearchAnalytics::test_principalVariationSearch();
+    TestSearchAnalytics::test_nullMovePruning();
 }
 
 void TestSearchAnalytics::test_cutoffs() {
@@ -113,4 +118,121 @@ void TestSearchAnalytics::test_piecesOnBoard() {
     assert(analytics.getNumPiecesOnBoard() == 90);
     SearchAnalytics analytics2(1);
     assert(analytics2.getNumPiecesOnBoard() == 0);
-}
\ No newline at end of file
+}
+
+void TestSearchAnalytics::test_transpositionRates() {
+    SearchAnalytics analytics(1, 90);
+    assert(analytics.getTranspositionHitRate() == 0);
+    assert(analytics.getTranspositionCutoffRate() == 0);
+
+    analytics.recordTranspositionProbe(true);
+    analytics.recordTranspositionProbe(true);
+    analytics.recordTranspositionProbe(false);
+    analytics.recordTranspositionProbe(false);
+    analytics.recordTranspositionCutoff();
+
+    assert(analytics.getTranspositionProbes() == 4);
+    assert(analytics.getTranspositionHits() == 2);
+    assert(analytics.getTranspositionCutoffs() == 1);
+    assert(analytics.getTranspositionHitRate() == 0.5);
+    assert(analytics.getTranspositionCutoffRate() == 0.25);
+
+    analytics.reset();
+    assert(analytics.getTranspositionProbes() == 0);
+    assert(analytics.getTranspositionHits() == 0);
+    assert(analytics.getTranspositionCutoffs() == 0);
+}
+
+void TestSearchAnalytics::test_merge() {
+    SearchAnalytics main(1, 90);
+    SearchAnalytics helper(1, 90);
+
+    main.recordNodesEvaluatedAtDepth(2, 10);
+    main.recordCutoffAtDepth(2);
+    main.recordTranspositionProbe(true);
+    main.setSearchDepth(3);
+    helper.recordNodesEvaluatedAtDepth(2, 5);
+    helper.recordNodesEvaluatedAtDepth(6, 7);
+    helper.recordCutoffAtDepth(2);
+    helper.recordTranspositionProbe(false);
+    helper.recordTranspositionCutoff();
+    helper.setSearchDepth(5);
+
+    main.merge(helper);
+
+    assert(main.getNodesEvaluatedAtDepth(2) == 15);
+    assert(main.getNodesEvaluatedAtDepth(6) == 7);
+    assert(main.getTotalNodesEvaluated() == 22);
+    assert(main.getCutoffsAtDepth(2) == 2);
+    assert(main.getTranspositionProbes() == 2);
+    assert(main.getTranspositionHits() == 1);
+    assert(main.getTranspositionCutoffs() == 1);
+    // The depth is still that of the main search
+    assert(main.getSearchDepth() == 3);
+}
+
+void TestSearchAnalytics::test_quiescence() {
+    SearchAnalytics main(1, 90);
+    main.recordQuiescenceNode();
+    main.recordQuiescenceNode();
+    main.recordQuiescenceCutoff();
+
+    // Kept apart from the nodes at each depth
+    assert(main.getQuiescenceNodes() == 2);
+    assert(main.getQuiescenceCutoffs() == 1);
+    assert(main.getTotalNodesEvaluated() == 0);
+
+    SearchAnalytics helper(1, 90);
+    helper.recordQuiescenceNode();
+    main.merge(helper);
+    assert(main.getQuiescenceNodes() == 3);
+    assert(main.getQuiescenceCutoffs() == 1);
+
+    main.reset();
+    assert(main.getQuiescenceNodes() == 0);
+    assert(main.getQuiescenceCutoffs() == 0);
+}
+
+void TestSearchAnalytics::test_principalVariationSearch() {
+    SearchAnalytics main(1, 90);
+    main.recordNullWindowResearch();
+    main.recordNullWindowResearch();
+    main.recordAspirationFailure();
+    assert(main.getNullWindowResearches() == 2);
+    assert(main.getAspirationFailures() == 1);
+
+    SearchAnalytics helper(1, 90);
+    helper.recordNullWindowResearch();
+    main.merge(helper);
+    assert(main.getNullWindowResearches() == 3);
+    assert(main.getAspirationFailures() == 1);
+
+    main.reset();
+    assert(main.getNullWindowResearches() == 0);
+    assert(main.getAspirationFailures() == 0);
+}
+
+void TestSearchAnalytics::test_nullMovePruning() {
+    SearchAnalytics main(1, 90);
+    main.recordNullMoveSearch();
+    main.recordNullMoveSearch();
+    main.recordNullMoveSearch();
+    main.recordNullMoveCutoff();
+    main.recordNullMoveVerificationFailure();
+    assert(main.getNullMoveSearches() == 3);
+    assert(main.getNullMoveCutoffs() == 1);
+    assert(main.getNullMoveVerificationFailures() == 1);
+
+    SearchAnalytics helper(1, 90);
+    helper.recordNullMoveSearch();
+    helper.recordNullMoveCutoff();
+    main.merge(helper);
+    assert(main.getNullMoveSearches() == 4);
+    assert(main.getNullMoveCutoffs() == 2);
+    assert(main.getNullMoveVerificationFailures() == 1);
+
+    main.reset();
+    assert(main.getNullMoveSearches() == 0);
+    assert(main.getNullMoveCutoffs() == 0);
+    assert(main.getNullMoveVerificationFailures() == 0);
+}
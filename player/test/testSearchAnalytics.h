@@ -12,6 +12,11 @@ private:
     static void test_turnConversion();
     static void test_piecesOnBoard();
     static void test_reset();
+    static void test_transpositionRates();
+    static void test_merge();
+    static void test_quiescence();
+    static void test_principalVariationSearch();
+    static void test_nullMovePruning();
 };
 
 #endif //DUCHESS_CPP_TESTSEARCHANALYTICS_H
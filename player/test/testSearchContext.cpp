@@ -0,0 +1,214 @@
+#include "testSearchContext.h"
+
+#include "../../duchess/Move.h"
+#include "../../duchess/CompactMove.h"
+#include "../../duchess/Board.h"
+#include "../SearchContext.h"
+
+#include <vector>
+#include <cassert>
+
+void TestSearchContext::runTests() {
+    TestSearchContext::test_killer();
+    TestSearchContext::test_killerAging();
+    TestSearchContext::test_history();
+    TestSearchContext::test_historyDecay();
+    TestSearchContext::test_counterMove();
+    TestSearchContext::test_sharingTablesWith();
+}
+
+void TestSearchContext::test_killer() {
+    Board b;
+    b.initialiseAttDefVectors();
+    const std::vector<Move> moves = b.getLegalMoves(6);
+
+    const CompactMove m1 = b.toCompactMove(moves[0]);
+    const CompactMove m2 = b.toCompactMove(moves[1]);
+    const CompactMove m3 = b.toCompactMove(moves[2]);
+
+    SearchContext context;
+    context.startSearch(10);
+    assert(context.getPly(13) == 3);
+
+    context.markMoveAsKiller(m1, 3);
+    context.markMoveAsKiller(m2, 3);
+    assert(context.getKiller(3, 0) == m2);
+    assert(context.getKiller(3, 1) == m1);
+    assert(context.isMoveKiller(m1, 3));
+    assert(!context.isMoveKiller(m1, 2));
+    assert(context.getKiller(4, 0).isNull());
+
+    // Marking the latest again changes nothing, but an older one comes back to the front
+    context.markMoveAsKiller(m2, 3);
+    assert(context.getKiller(3, 1) == m1);
+    context.markMoveAsKiller(m1, 3);
+    assert(context.getKiller(3, 0) == m1);
+    assert(context.getKiller(3, 1) == m2);
+
+    // Only KILLERS_PER_PLY are kept
+    context.markMoveAsKiller(m3, 3);
+    assert(context.getKiller(3, 0) == m3);
+    assert(context.getKiller(3, 1) == m1);
+    assert(!context.isMoveKiller(m2, 3));
+
+    // Plies out of range are ignored
+    context.markMoveAsKiller(m1, -1);
+    context.markMoveAsKiller(m1, SearchContext::MAX_PLY);
+    assert(context.getKiller(-1, 0).isNull());
+    assert(context.getKiller(SearchContext::MAX_PLY, 0).isNull());
+}
+
+void TestSearchContext::test_killerAging() {
+    Board b;
+    b.initialiseAttDefVectors();
+    const std::vector<Move> moves = b.getLegalMoves(1);
+
+    const CompactMove m1 = b.toCompactMove(moves[0]);
+    const CompactMove m2 = b.toCompactMove(moves[1]);
+
+    SearchContext context;
+    context.startSearch(1);
+    context.markMoveAsKiller(m1, 6);
+    context.markMoveAsKiller(m2, 1);
+
+    // A whole round later, what was 6 plies down is now at the root's ply, and what was above it is gone
+    context.startSearch(7);
+    assert(context.getKiller(0, 0) == m1);
+    assert(context.getKiller(6, 0).isNull());
+    assert(!context.isMoveKiller(m2, 1));
+
+    // Going backwards (e.g. a new game) forgets everything
+    context.startSearch(1);
+    assert(context.getKiller(0, 0).isNull());
+    assert(context.getKiller(6, 0).isNull());
+}
+
+void TestSearchContext::test_history() {
+    Board b;
+    b.initialiseAttDefVectors();
+    const std::vector<Move> moves = b.getLegalMoves(1);
+
+    const CompactMove m1 = b.toCompactMove(moves[0]);
+    const CompactMove m2 = b.toCompactMove(moves[1]);
+    const CompactMove m3 = b.toCompactMove(moves[2]);
+
+    SearchContext context;
+
+    context.markMoveAsHistory(m1, 3, 1);
+    context.markMoveAsHistory(m3, 5, 1);
+    context.markMoveAsHistory(m1, 4, 1);
+
+    assert(context.getHistoricalCutoffs(m1, 1) == 25);
+    assert(context.getHistoricalCutoffs(m3, 1) == 25);
+    assert(context.getHistoricalCutoffs(m1, 2) == 0);
+    assert(context.getHistoricalCutoffs(m2, 1) == 0);
+    assert(context.getHistoricalCutoffs(1, m1.getFromIndex(), m1.getToIndex()) == 25);
+
+    // Only the squares count, not what's taken
+    const CompactMove m1Taking (m1.getFromIndex(), m1.getToIndex(), 2, 0);
+    assert(context.getHistoricalCutoffs(m1Taking, 1) == 25);
+    assert(context.getHistoricalCutoffs(m1Taking, 6) == 0);
+}
+
+void TestSearchContext::test_historyDecay() {
+    Board b;
+    b.initialiseAttDefVectors();
+    const std::vector<Move> moves = b.getLegalMoves(1);
+
+    const CompactMove m1 = b.toCompactMove(moves[0]);
+    const CompactMove m2 = b.toCompactMove(moves[1]);
+
+    SearchContext context;
+    context.startSearch(1);
+    context.markMoveAsHistory(m1, 4, 1);
+    context.markMoveAsHistory(m2, 1, 1);
+    context.markMoveAsHistory(m2, 3, 2);
+
+    // Each new search halves every score
+    context.startSearch(7);
+    assert(context.getHistoricalCutoffs(m1, 1) == 8);
+    assert(context.getHistoricalCutoffs(m2, 1) == 0);
+    assert(context.getHistoricalCutoffs(m2, 2) == 4);
+
+    // So does going past MAX_HISTORY_SCORE, but only for that player
+    while (context.getHistoricalCutoffs(m1, 1) == 8) {
+        context.markMoveAsHistory(m2, SearchContext::MAX_PLY, 1);
+    }
+    assert(context.getHistoricalCutoffs(m1, 1) == 4);
+    assert(context.getHistoricalCutoffs(m2, 1) <= SearchContext::MAX_HISTORY_SCORE);
+    assert(context.getHistoricalCutoffs(m2, 2) == 4);
+}
+
+void TestSearchContext::test_counterMove() {
+    Board b;
+    b.initialiseAttDefVectors();
+    const std::vector<Move> moves = b.getLegalMoves(1);
+    const std::vector<Move> replies = b.getLegalMoves(2);
+
+    const CompactMove parent = b.toCompactMove(moves[0]);
+    const CompactMove otherParent = b.toCompactMove(moves[1]);
+    const CompactMove r1 = b.toCompactMove(replies[0]);
+    const CompactMove r2 = b.toCompactMove(replies[1]);
+
+    SearchContext context;
+    assert(context.getCounterMove(2, parent).isNull());
+
+    context.markCounterMove(2, parent, r1);
+    assert(context.getCounterMove(2, parent).getFromIndex() == r1.getFromIndex());
+    assert(context.getCounterMove(2, parent).getToIndex() == r1.getToIndex());
+    assert(context.getCounterMove(2, otherParent).isNull());
+    // Each player has their own
+    assert(context.getCounterMove(3, parent).isNull());
+
+    // Only the latest is kept, and only its squares
+    context.markCounterMove(2, parent, r2);
+    assert(context.getCounterMove(2, parent) == CompactMove(r2.getFromIndex(), r2.getToIndex()));
+
+    // Moves between the same squares share an entry, whatever they take
+    const CompactMove parentTaking (parent.getFromIndex(), parent.getToIndex(), 3, 0);
+    assert(context.getCounterMove(2, parentTaking) == context.getCounterMove(2, parent));
+}
+
+void TestSearchContext::test_sharingTablesWith() {
+    Board b;
+    b.initialiseAttDefVectors();
+    const std::vector<Move> moves = b.getLegalMoves(1);
+    const std::vector<Move> replies = b.getLegalMoves(2);
+    const CompactMove m1 = b.toCompactMove(moves[0]);
+    const CompactMove m2 = b.toCompactMove(moves[1]);
+    const CompactMove r1 = b.toCompactMove(replies[0]);
+
+    SearchContext parent;
+    parent.startSearch(10);
+    parent.markMoveAsKiller(m1, 2);
+    parent.markMoveAsHistory(m1, 3, 1);
+    parent.markCounterMove(2, m1, r1);
+
+    // Starts off seeing everything the parent does
+    SearchContext task (SearchContext::sharingTablesWith(parent));
+    assert(task.getPly(13) == 3);
+    assert(task.isMoveKiller(m1, 2));
+    assert(task.getHistoricalCutoffs(m1, 1) == 9);
+    assert(task.getCounterMove(2, m1).getFromIndex() == r1.getFromIndex());
+
+    // Its killers are its own
+    task.markMoveAsKiller(m2, 2);
+    assert(task.isMoveKiller(m2, 2));
+    assert(!parent.isMoveKiller(m2, 2));
+
+    // But it can't add to the history or countermoves
+    task.markMoveAsHistory(m2, 4, 1);
+    task.markCounterMove(2, m2, r1);
+    assert(task.getHistoricalCutoffs(m2, 1) == 0);
+    assert(parent.getHistoricalCutoffs(m2, 1) == 0);
+    assert(parent.getCounterMove(2, m2).isNull());
+
+    // Later changes to the parent's show through, including to tasks of tasks, and copies of them
+    parent.markMoveAsHistory(m2, 2, 1);
+    SearchContext subtask (SearchContext::sharingTablesWith(task));
+    const SearchContext copy (subtask);
+    assert(task.getHistoricalCutoffs(m2, 1) == 4);
+    assert(subtask.getHistoricalCutoffs(m2, 1) == 4);
+    assert(copy.getHistoricalCutoffs(m2, 1) == 4);
+    assert(subtask.isMoveKiller(m2, 2));
+}
@@ -0,0 +1,16 @@
+#ifndef DUCHESS_CPP_TESTSEARCHCONTEXT_H
+#define DUCHESS_CPP_TESTSEARCHCONTEXT_H
+
+class TestSearchContext {
+public:
+    static void runTests();
+private:
+    static void test_killer();
+    static void test_killerAging();
+    static void test_history();
+    static void test_historyDecay();
+    static void test_counterMove();
+    static void test_sharingTablesWith();
+};
+
+#endif //DUCHESS_CPP_TESTSEARCHCONTEXT_H
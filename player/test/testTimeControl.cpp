@@ -0,0 +1,55 @@
+#include "testTimeControl.h"
+#include "../TimeControl.h"
+
+#include <cassert>
+#include <initializer_list>
+
+void TestTimeControl::runTests() {
+    TestTimeControl::test_perMove();
+    TestTimeControl::test_remainingClock();
+    TestTimeControl::test_neverFlags();
+}
+
+void TestTimeControl::test_perMove() {
+    const TimeControl timeControl = TimeControl::perMove(1500);
+    assert(!timeControl.isClock());
+    assert(timeControl.getMillis() == 1500);
+
+    // The position makes no difference
+    assert(timeControl.allocateBudgetMillis(90, 40) == 1500);
+    assert(timeControl.allocateBudgetMillis(12, 3) == 1500);
+}
+
+void TestTimeControl::test_remainingClock() {
+    const TimeControl timeControl = TimeControl::remainingClock(600000);
+    assert(timeControl.isClock());
+    assert(timeControl.getMillis() == 600000);
+
+    // A typical opening position gets an even share of the clock between the moves left in a full game
+    const int opening = timeControl.allocateBudgetMillis(TimeControl::NUM_PIECES_AT_START, TimeControl::TYPICAL_NUM_LEGAL_MOVES);
+    assert(opening == (600000 - TimeControl::CLOCK_SAFETY_MARGIN_MILLIS) / TimeControl::MAX_MOVES_TO_GO);
+
+    // With fewer pieces there are fewer moves left to share it between
+    assert(timeControl.allocateBudgetMillis(30, TimeControl::TYPICAL_NUM_LEGAL_MOVES) > opening);
+
+    // Positions with more options get longer, and simpler ones shorter
+    assert(timeControl.allocateBudgetMillis(TimeControl::NUM_PIECES_AT_START, 90) > opening);
+    assert(timeControl.allocateBudgetMillis(TimeControl::NUM_PIECES_AT_START, 10) < opening);
+
+    // But only so far (allowing for the budgets being rounded down to whole milliseconds)
+    assert(timeControl.allocateBudgetMillis(TimeControl::NUM_PIECES_AT_START, 1000) <= (opening + 1) * TimeControl::MAX_COMPLEXITY_FACTOR);
+    assert(timeControl.allocateBudgetMillis(TimeControl::NUM_PIECES_AT_START, 2) >= (opening - 1) * TimeControl::MIN_COMPLEXITY_FACTOR);
+
+    // And there's nothing to think about with only one move
+    assert(timeControl.allocateBudgetMillis(TimeControl::NUM_PIECES_AT_START, 1) == 0);
+}
+
+void TestTimeControl::test_neverFlags() {
+    // However little is left, no move uses more than a fraction of what's on the clock after the safety margin
+    for (auto const clock : {0, 50, 100, 150, 1000, 5000}) {
+        const TimeControl timeControl = TimeControl::remainingClock(clock);
+        const int budget = timeControl.allocateBudgetMillis(8, 200);
+        assert(budget >= 0);
+        assert(budget <= (clock - TimeControl::CLOCK_SAFETY_MARGIN_MILLIS) * TimeControl::MAX_CLOCK_FRACTION || budget == 0);
+    }
+}
@@ -0,0 +1,13 @@
+#ifndef DUCHESS_CPP_TESTTIMECONTROL_H
+#define DUCHESS_CPP_TESTTIMECONTROL_H
+
+class TestTimeControl {
+public:
+    static void runTests();
+private:
+    static void test_perMove();
+    static void test_remainingClock();
+    static void test_neverFlags();
+};
+
+#endif //DUCHESS_CPP_TESTTIMECONTROL_H
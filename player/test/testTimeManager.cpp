@@ -0,0 +1,51 @@
+#include "testTimeManager.h"
+#include "../TimeManager.h"
+
+#include <cassert>
+#include <chrono>
+#include <thread>
+
+void TestTimeManager::runTests() {
+    TestTimeManager::test_budget();
+    TestTimeManager::test_softLimit();
+    TestTimeManager::test_hardLimit();
+}
+
+void TestTimeManager::test_budget() {
+    const TimeManager fromBudget(1000);
+    assert(fromBudget.getSoftLimitMillis() == 500);
+    assert(fromBudget.getHardLimitMillis() == 1000);
+
+    const TimeManager explicitLimits(300, 400);
+    assert(explicitLimits.getSoftLimitMillis() == 300);
+    assert(explicitLimits.getHardLimitMillis() == 400);
+}
+
+void TestTimeManager::test_softLimit() {
+    const TimeManager timeManager(10000, 20000);
+    assert(timeManager.shouldStartIteration(0));
+    assert(timeManager.shouldStartIteration(5000));
+    assert(!timeManager.shouldStartIteration(10000));
+}
+
+void TestTimeManager::test_hardLimit() {
+    TimeManager timeManager(50, 100);
+    assert(!timeManager.checkHardLimit());
+    assert(!timeManager.isHardLimitReached());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    // Polling only reads the clock every so often, but gets there within NODES_BETWEEN_CHECKS calls
+    unsigned int polls = 0;
+    while (!timeManager.pollHardLimit()) {
+        ++polls;
+        assert(polls < TimeManager::NODES_BETWEEN_CHECKS);
+    }
+    assert(timeManager.isHardLimitReached());
+    assert(timeManager.checkHardLimit());
+    assert(!timeManager.shouldStartIteration(0));
+
+    // Restarting gives it the whole budget again
+    timeManager.start();
+    assert(!timeManager.isHardLimitReached());
+    assert(!timeManager.checkHardLimit());
+}
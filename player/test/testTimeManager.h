@@ -0,0 +1,13 @@
+#ifndef DUCHESS_CPP_TESTTIMEMANAGER_H
+#define DUCHESS_CPP_TESTTIMEMANAGER_H
+
+class TestTimeManager {
+public:
+    static void runTests();
+private:
+    static void test_budget();
+    static void test_softLimit();
+    static void test_hardLimit();
+};
+
+#endif //DUCHESS_CPP_TESTTIMEMANAGER_H
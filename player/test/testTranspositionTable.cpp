@@ -0,0 +1,210 @@
+#include "testTranspositionTable.h"
+
+#include "../TranspositionTable.h"
+#include "../Player.h"
+#include "../Brain.h"
+#include "../SearchAnalytics.h"
+
+#include "../../duchess/Board.h"
+#include "../../duchess/CompactMove.h"
+#include "../../duchess/MoveList.h"
+
+#include <cassert>
+#include <thread>
+#include <vector>
+
+void TestTranspositionTable::runTests() {
+    TestTranspositionTable::test_storeAndProbe();
+    TestTranspositionTable::test_replacement();
+    TestTranspositionTable::test_generations();
+    TestTranspositionTable::test_sizing();
+    TestTranspositionTable::test_searchUsesTable();
+    TestTranspositionTable::test_concurrentAccess();
+}
+
+void TestTranspositionTable::test_storeAndProbe() {
+    TranspositionTable table(1);
+    TranspositionEntry entry;
+
+    const ZobristKey key = 0x123456789ABCDEF0;
+    assert(!table.probe(key, entry));
+
+    table.store(key, 3, BoundType::LOWER, 1.5, CompactMove(10, 20));
+    assert(table.probe(key, entry));
+    assert(entry.key == key);
+    assert(entry.depth == 3);
+    assert(entry.bound == BoundType::LOWER);
+    assert(entry.score == 1.5);
+    assert(entry.bestMove == CompactMove(10, 20));
+
+    // Same bucket, different key
+    assert(!table.probe(key + table.getNumBuckets(), entry));
+
+    // Storing the same position again overwrites it, even at a shallower depth
+    table.store(key, 1, BoundType::EXACT, -2, CompactMove(30, 40));
+    assert(table.probe(key, entry));
+    assert(entry.depth == 1);
+    assert(entry.bound == BoundType::EXACT);
+    assert(entry.bestMove == CompactMove(30, 40));
+
+    table.clear();
+    assert(!table.probe(key, entry));
+}
+
+void TestTranspositionTable::test_replacement() {
+    TranspositionTable table(1);
+    TranspositionEntry entry;
+
+    // All of these land in the same bucket
+    const ZobristKey deep = 5;
+    const ZobristKey shallow = deep + table.getNumBuckets();
+    const ZobristKey shallower = deep + 2 * table.getNumBuckets();
+    const ZobristKey deeper = deep + 3 * table.getNumBuckets();
+
+    table.store(deep, 5, BoundType::EXACT, 0, CompactMove());
+    table.store(shallow, 2, BoundType::EXACT, 0, CompactMove());
+    assert(table.probe(deep, entry));
+    assert(table.probe(shallow, entry));
+
+    // A shallow search only ever pushes out the always-replace entry
+    table.store(shallower, 1, BoundType::EXACT, 0, CompactMove());
+    assert(table.probe(deep, entry));
+    assert(!table.probe(shallow, entry));
+    assert(table.probe(shallower, entry));
+
+    // A deeper search takes the depth-preferred slot, and what was there moves to the other slot
+    table.store(deeper, 6, BoundType::EXACT, 0, CompactMove());
+    assert(table.probe(deeper, entry));
+    assert(table.probe(deep, entry));
+    assert(!table.probe(shallower, entry));
+}
+
+void TestTranspositionTable::test_generations() {
+    TranspositionTable table(1);
+    TranspositionEntry entry;
+
+    const ZobristKey deep = 5;
+    const ZobristKey shallow = deep + table.getNumBuckets();
+    const ZobristKey shallower = deep + 2 * table.getNumBuckets();
+
+    table.store(deep, 8, BoundType::EXACT, 0, CompactMove());
+    assert(table.probe(deep, entry));
+    assert(entry.generation == table.getGeneration());
+
+    // Left over from an earlier search, the deep entry gives way to a shallow one, and isn't kept in the other slot
+    table.store(shallow, 1, BoundType::EXACT, 0, CompactMove());
+    table.newSearch();
+    table.store(shallower, 2, BoundType::EXACT, 0, CompactMove());
+    assert(table.probe(shallower, entry));
+    assert(entry.generation == table.getGeneration());
+    assert(!table.probe(deep, entry));
+    assert(table.probe(shallow, entry));
+
+    // Still readable, just replaceable
+    table.newSearch();
+    assert(table.probe(shallower, entry));
+
+    // Each search moves the table on
+    Board b;
+    b.initialiseAttDefVectors();
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+    brain.setTranspositionTableSizeInMB(1);
+    brain.setMaxSearchDepth(2);
+    Player player(PlayerType::AI, 1);
+    player.setBrain(&brain);
+
+    MoveList moves;
+    b.getLegalMoves(1, moves);
+    const unsigned char generation = brain.getTranspositionTable().getGeneration();
+    player.searchForMove(&b, moves, 1);
+    assert(brain.getTranspositionTable().getGeneration() == (unsigned char)(generation + 1));
+}
+
+void TestTranspositionTable::test_sizing() {
+    TranspositionTable table(1);
+    assert(table.getSizeInMB() == 1);
+    assert(table.getNumBuckets() > 0);
+    // Power of two
+    assert((table.getNumBuckets() & (table.getNumBuckets() - 1)) == 0);
+    const std::size_t oneMBBuckets = table.getNumBuckets();
+
+    table.resize(2);
+    assert(table.getSizeInMB() == 2);
+    assert((table.getNumBuckets() & (table.getNumBuckets() - 1)) == 0);
+    assert(table.getNumBuckets() == 2 * oneMBBuckets);
+
+    // Resizing throws everything away
+    TranspositionEntry entry;
+    table.store(7, 1, BoundType::EXACT, 0, CompactMove());
+    table.resize(1);
+    assert(!table.probe(7, entry));
+}
+
+void TestTranspositionTable::test_searchUsesTable() {
+    Board b;
+    b.initialiseAttDefVectors();
+
+    Brain brain ("../weights/wcci/materialCheck.wts");
+    brain.setFeatureSet(FeatureSet::MATERIAL);
+    brain.setTranspositionTableSizeInMB(1);
+    Player player(PlayerType::AI, 1);
+    player.setBrain(&brain);
+
+    MoveList moves;
+    b.getLegalMoves(1, moves);
+
+    SearchAnalytics firstAnalytics(1, b.getNumPieces());
+    player.alphaBetaFromRoot(moves, &b, 2, &firstAnalytics, 1);
+    assert(firstAnalytics.getTranspositionProbes() > 0);
+
+    // Every node below the root was stored, so searching again cuts off straight away
+    SearchAnalytics secondAnalytics(1, b.getNumPieces());
+    player.alphaBetaFromRoot(moves, &b, 2, &secondAnalytics, 1);
+    assert(secondAnalytics.getTranspositionHits() > 0);
+    assert(secondAnalytics.getTranspositionCutoffs() > 0);
+    assert(secondAnalytics.getTranspositionCutoffRate() > 0);
+
+    // Learning never touches the table
+    brain.setLearning(true);
+    SearchAnalytics learningAnalytics(1, b.getNumPieces());
+    player.alphaBetaFromRoot(moves, &b, 2, &learningAnalytics, 1);
+    assert(learningAnalytics.getTranspositionProbes() == 0);
+}
+
+void TestTranspositionTable::test_concurrentAccess() {
+    // A tiny table, so that threads are constantly overwriting each other's buckets
+    TranspositionTable table(0);
+    const int numThreads = 4;
+    const int storesPerThread = 20000;
+
+    // Every entry is derived from its key, so a probe that mixed up two writes would be caught
+    std::vector<std::thread> threads;
+    std::vector<char> consistent(numThreads, true);
+    int thread;
+    for (thread = 0; thread < numThreads; ++thread) {
+        threads.emplace_back([&table, &consistent, thread, storesPerThread] () {
+            int i;
+            for (i = 0; i < storesPerThread; ++i) {
+                const ZobristKey key = (ZobristKey(i % 64) << 32) | ZobristKey(i * 7 + thread);
+                const short depth = short(key % 50);
+                table.store(key, depth, BoundType::EXACT, double(key), CompactMove(uint32_t(key)));
+
+                TranspositionEntry entry;
+                const ZobristKey probeKey = (ZobristKey((i * 3) % 64) << 32) | ZobristKey(i * 5);
+                if (table.probe(probeKey, entry)) {
+                    if (entry.depth != short(probeKey % 50) || entry.score != double(probeKey) ||
+                            entry.bestMove != CompactMove(uint32_t(probeKey))) {
+                        consistent[thread] = false;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (thread = 0; thread < numThreads; ++thread) {
+        assert(consistent[thread]);
+    }
+}
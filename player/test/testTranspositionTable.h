@@ -0,0 +1,16 @@
+#ifndef DUCHESS_CPP_TESTTRANSPOSITIONTABLE_H
+#define DUCHESS_CPP_TESTTRANSPOSITIONTABLE_H
+
+class TestTranspositionTable {
+public:
+    static void runTests();
+private:
+    static void test_storeAndProbe();
+    static void test_replacement();
+    static void test_generations();
+    static void test_sizing();
+    static void test_searchUsesTable();
+    static void test_concurrentAccess();
+};
+
+#endif //DUCHESS_CPP_TESTTRANSPOSITIONTABLE_H
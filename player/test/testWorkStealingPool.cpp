@@ -0,0 +1,86 @@
+#include "testWorkStealingPool.h"
+#include "../WorkStealingPool.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+void TestWorkStealingPool::runTests() {
+    TestWorkStealingPool::test_runsEveryTask();
+    TestWorkStealingPool::test_nestedGroups();
+    TestWorkStealingPool::test_singleWorker();
+    TestWorkStealingPool::test_waitForStolenTask();
+}
+
+void TestWorkStealingPool::test_runsEveryTask() {
+    WorkStealingPool pool(4);
+    assert(pool.getNumWorkers() == 4);
+
+    std::vector<int> results(1000, 0);
+    std::vector<char> workerValid(1000, false);
+    TaskGroup group;
+    int i;
+    for (i = 0; i < 1000; ++i) {
+        pool.submit(0, group, [&results, &workerValid, i] (const unsigned int t_worker) {
+            results[i] = i * i;
+            workerValid[i] = t_worker < 4;
+        });
+    }
+    pool.wait(0, group);
+    assert(group.isDone());
+
+    for (i = 0; i < 1000; ++i) {
+        assert(results[i] == i * i);
+        assert(workerValid[i]);
+    }
+}
+
+void TestWorkStealingPool::test_nestedGroups() {
+    // Tasks that wait on tasks of their own mustn't deadlock, however few workers there are
+    WorkStealingPool pool(3);
+    std::atomic<int> total(0);
+    TestWorkStealingPool::countTreeNodes(pool, 0, 10, total);
+    assert(total == (1 << 11) - 1);
+}
+
+void TestWorkStealingPool::test_singleWorker() {
+    WorkStealingPool pool(1);
+    assert(pool.getNumWorkers() == 1);
+
+    std::atomic<int> total(0);
+    TestWorkStealingPool::countTreeNodes(pool, 0, 6, total);
+    assert(total == (1 << 7) - 1);
+}
+
+void TestWorkStealingPool::test_waitForStolenTask() {
+    // Give the other worker time to steal the task, so that waiting has nothing to run and has to sleep until it's done
+    WorkStealingPool pool(2);
+    std::atomic<bool> finished(false);
+    TaskGroup group;
+    pool.submit(0, group, [&finished] (const unsigned int) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        finished = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    pool.wait(0, group);
+    assert(group.isDone());
+    assert(finished);
+}
+
+void TestWorkStealingPool::countTreeNodes(WorkStealingPool& t_pool, const unsigned int t_worker, const int t_depth, std::atomic<int>& t_total) {
+    ++t_total;
+    if (t_depth == 0) {
+        return;
+    }
+
+    TaskGroup group;
+    int child;
+    for (child = 0; child < 2; ++child) {
+        t_pool.submit(t_worker, group, [&t_pool, &t_total, t_depth] (const unsigned int t_taskWorker) {
+            TestWorkStealingPool::countTreeNodes(t_pool, t_taskWorker, t_depth - 1, t_total);
+        });
+    }
+    t_pool.wait(t_worker, group);
+}
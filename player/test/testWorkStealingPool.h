@@ -0,0 +1,21 @@
+#ifndef DUCHESS_CPP_TESTWORKSTEALINGPOOL_H
+#define DUCHESS_CPP_TESTWORKSTEALINGPOOL_H
+
+#include <atomic>
+
+class WorkStealingPool;
+
+class TestWorkStealingPool {
+public:
+    static void runTests();
+private:
+    static void test_runsEveryTask();
+    static void test_nestedGroups();
+    static void test_singleWorker();
+    static void test_waitForStolenTask();
+
+    // Adds 1 to t_total for every node of a binary tree of the given depth, splitting at each node
+    static void countTreeNodes(WorkStealingPool& t_pool, const unsigned int t_worker, const int t_depth, std::atomic<int>& t_total);
+};
+
+#endif //DUCHESS_CPP_TESTWORKSTEALINGPOOL_H
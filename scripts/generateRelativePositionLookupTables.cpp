@@ -3,6 +3,7 @@
 #include <cstring>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 
 #include "../duchess/Position.h"
 #include "../duchess/PositionUtils.h"
@@ -14,21 +15,33 @@
  * Options:
  *      --knight Prints knight-moves-from-position lookup table [position] --> [results]
  *      --directions Prints lookup table of [position][direction] --> result
+ *      --neighbours Prints lookup tables of [position] --> adjacent, diagonal, adjacent and diagonal, and knight move squares
+ *      --rays Prints lookup tables of [position][direction] --> full line of positions, and of the lines out of the vortex
  *
  */
 
 static void printKnightLookupTable();
 static void printDirectionLookupTable();
+static void printRayLookupTables();
+static void printNeighbourLookupTables();
+static std::vector<BoardIndex> toCountedRow(const std::vector<BoardIndex>& t_indices, const unsigned int t_width);
+static std::vector<BoardIndex> getRayAfterStep(const BoardIndex t_from, const BoardIndex t_to, const short t_direction);
+static std::vector<BoardIndex> padRay(std::vector<BoardIndex> t_ray, const unsigned int t_length);
 static void printPositionsRelativeToSeatLookupTable();
 static void printMovesToPositionLookupTable();
 static void printUsage();
 static void print2DArray(const std::vector<std::vector<BoardIndex>>& vecs);
+static void print3DArray(const std::vector<std::vector<std::vector<short int>>>& vecs);
 
 int main(const int argc, const char* argv[]) {
     if (argc >= 2 && strcmp("--knight", argv[1]) == 0) {
         printKnightLookupTable();
     } else if (argc >= 2 && strcmp("--directions", argv[1]) == 0) {
         printDirectionLookupTable();
+    } else if (argc >= 2 && strcmp("--neighbours", argv[1]) == 0) {
+        printNeighbourLookupTables();
+    } else if (argc >= 2 && strcmp("--rays", argv[1]) == 0) {
+        printRayLookupTables();
     } else if (argc >= 2 && strcmp("--perplayer", argv[1]) == 0) {
         printPositionsRelativeToSeatLookupTable();
     } else if (argc >= 2 && strcmp("--nummoves", argv[1]) == 0) {
@@ -45,7 +58,7 @@ static void printKnightLookupTable() {
     BoardIndex posIndex;
     for (posIndex = 1; posIndex <= 156; ++posIndex) {
         Position* pos = PositionUtils::boardIndexToPositionSixPlayer(posIndex);
-        vecs.push_back(PositionUtils::getKnightMovesFromPosition(pos));
+        vecs.push_back(PositionUtils::getKnightMovesFromPosition(pos).toVector());
         delete pos;
     }
 
@@ -69,17 +82,142 @@ static void printDirectionLookupTable() {
     print2DArray(vecs);
 }
 
+// Rows of the neighbour tables are the number of entries, followed by the entries, padded with 0s
+static std::vector<BoardIndex> toCountedRow(const std::vector<BoardIndex>& t_indices, const unsigned int t_width) {
+    std::vector<BoardIndex> row {(BoardIndex) t_indices.size()};
+    row.insert(row.end(), t_indices.begin(), t_indices.end());
+    while (row.size() < t_width) {
+        row.push_back(0);
+    }
+    return row;
+}
+
+static void printNeighbourLookupTables() {
+    std::vector<std::vector<BoardIndex>> adjacent;
+    std::vector<std::vector<BoardIndex>> diagonal;
+    std::vector<std::vector<BoardIndex>> adjacentAndDiagonal;
+    std::vector<std::vector<BoardIndex>> knight;
+    BoardIndex posIndex;
+    for (posIndex = 1; posIndex <= 157; ++posIndex) {
+        Position* pos = PositionUtils::boardIndexToPositionSixPlayer(posIndex);
+        adjacent.push_back(toCountedRow(PositionUtils::getAdjacentSquareIndices(pos).toVector(), PositionUtils::MAX_ADJACENT_SQUARES + 1));
+        diagonal.push_back(toCountedRow(PositionUtils::getDiagonalSquareIndices(pos).toVector(), PositionUtils::MAX_DIAGONAL_SQUARES + 1));
+        adjacentAndDiagonal.push_back(toCountedRow(PositionUtils::getAdjacentAndDiagonalSquareIndices(pos).toVector(),
+                                                   PositionUtils::MAX_ADJACENT_AND_DIAGONAL_SQUARES + 1));
+        knight.push_back(toCountedRow(PositionUtils::getKnightMovesFromPosition(pos).toVector(), PositionUtils::MAX_KNIGHT_MOVES + 1));
+        delete pos;
+    }
+
+    print2DArray(adjacent);
+    std::cout << std::endl << std::endl;
+    print2DArray(diagonal);
+    std::cout << std::endl << std::endl;
+    print2DArray(adjacentAndDiagonal);
+    std::cout << std::endl << std::endl;
+    print2DArray(knight);
+    std::cout << std::endl;
+}
+
+// Follows a line that has just stepped from t_from to t_to in t_direction until it runs off the board
+// Returns every square on the line from t_to onwards (t_from excluded)
+static std::vector<BoardIndex> getRayAfterStep(const BoardIndex t_from, const BoardIndex t_to, const short t_direction) {
+    std::vector<BoardIndex> ray;
+    short direction = t_direction;
+    Position* prev = PositionUtils::boardIndexToPositionSixPlayer(t_from);
+    BoardIndex curIndex = t_to;
+    while (curIndex != 0) {
+        // Lines never loop back on themselves, so anything longer than the board means the tables are broken
+        assert(ray.size() < PositionUtils::NUM_BOARD_INDICES_SIX_PLAYER);
+        ray.push_back(curIndex);
+        Position* cur = PositionUtils::boardIndexToPositionSixPlayer(curIndex);
+        const BoardIndex nextIndex = PositionUtils::getIndexOfNextSquareInLine(prev, cur, direction);
+        const short flapChange = PositionUtils::getFlapChange(prev, cur);
+        direction = PositionUtils::determineNextDirectionGivenPreviousDirectionAndFlapChange(direction, flapChange);
+        delete prev;
+        prev = cur;
+        curIndex = nextIndex;
+    }
+    delete prev;
+
+    return ray;
+}
+
+// Pads a ray with 0s (off board) so that every row of the table has the same length
+static std::vector<BoardIndex> padRay(std::vector<BoardIndex> t_ray, const unsigned int t_length) {
+    while (t_ray.size() < t_length) {
+        t_ray.push_back(0);
+    }
+    return t_ray;
+}
+
+static void printRayLookupTables() {
+    const BoardIndex vortexIndex = 157;
+    std::vector<std::vector<std::vector<BoardIndex>>> rays;
+    unsigned int maxLength = 0;
+    BoardIndex posIndex;
+    for (posIndex = 1; posIndex <= 156; ++posIndex) {
+        std::vector<std::vector<BoardIndex>> raysFromPosition;
+        Position* pos = PositionUtils::boardIndexToPositionSixPlayer(posIndex);
+        short direction;
+        for (direction = PositionUtils::DIRECTION_CLOCKWISE; direction <= PositionUtils::DIRECTION_OUT_ANTICLOCKWISE; ++direction) {
+            const BoardIndex firstStep = PositionUtils::getIndexOfPositionInDirection(pos, direction);
+            const std::vector<BoardIndex>& ray = getRayAfterStep(posIndex, firstStep, direction);
+            maxLength = std::max(maxLength, (unsigned int) ray.size());
+            raysFromPosition.push_back(ray);
+        }
+        delete pos;
+        rays.push_back(raysFromPosition);
+    }
+
+    // Lines out of the vortex go OUT through each adjacent square and OUT_ANTICLOCKWISE through each diagonal square
+    std::vector<std::vector<BoardIndex>> vortexRays;
+    Position* vortex = PositionUtils::boardIndexToPositionSixPlayer(vortexIndex);
+    for (auto const& adjacentIndex : PositionUtils::getAdjacentSquareIndices(vortex).toVector()) {
+        vortexRays.push_back(getRayAfterStep(vortexIndex, adjacentIndex, PositionUtils::DIRECTION_OUT));
+    }
+    for (auto const& diagonalIndex : PositionUtils::getDiagonalSquareIndices(vortex).toVector()) {
+        vortexRays.push_back(getRayAfterStep(vortexIndex, diagonalIndex, PositionUtils::DIRECTION_OUT_ANTICLOCKWISE));
+    }
+    delete vortex;
+    for (auto const& ray : vortexRays) {
+        maxLength = std::max(maxLength, (unsigned int) ray.size());
+    }
+
+    // Every ray is terminated by at least one 0
+    std::cout << "// MAX_RAY_LENGTH = " << maxLength << std::endl;
+    std::vector<std::vector<std::vector<short int>>> paddedRays;
+    for (auto const& raysFromPosition : rays) {
+        std::vector<std::vector<short int>> paddedRaysFromPosition;
+        for (auto const& ray : raysFromPosition) {
+            const std::vector<BoardIndex>& padded = padRay(ray, maxLength + 1);
+            paddedRaysFromPosition.push_back(std::vector<short int>(padded.begin(), padded.end()));
+        }
+        paddedRays.push_back(paddedRaysFromPosition);
+    }
+    print3DArray(paddedRays);
+    std::cout << std::endl << std::endl;
+
+    std::vector<std::vector<BoardIndex>> paddedVortexRays;
+    for (auto const& ray : vortexRays) {
+        paddedVortexRays.push_back(padRay(ray, maxLength + 1));
+    }
+    print2DArray(paddedVortexRays);
+    std::cout << std::endl;
+}
+
 static void printUsage() {
     std::cout << "Usage: " << std::endl;
     std::cout << "    --knight         Print knight lookup table" << std::endl;
     std::cout << "    --directions     Print directional lookup table" << std::endl;
+    std::cout << "    --neighbours     Print adjacent/diagonal/knight move lookup tables" << std::endl;
+    std::cout << "    --rays           Print full line lookup tables for each position/direction and for the vortex" << std::endl;
     std::cout << "    --perplayer      Print list of BoardIndexes relative to seat" << std::endl;
     std::cout << "    --nummoves       Print lookup table for PieceType->StartPos->EndPos giving num moves needed" << std::endl;
 
 }
 
 static void print2DArray(const std::vector<std::vector<BoardIndex>>& vecs) {
-    BoardIndex i, j;
+    unsigned int i, j;
     std::cout << "{";
     for (i = 0; i < vecs.size(); ++i) {
         std::cout << "{";
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <cstdint>
 
 #include "../duchess/Board.h"
 #include "../duchess/Position.h"
@@ -201,6 +202,15 @@ short LegacyUtils::dataToPlayerTurn(const char incomingData[]) {
     return incomingData[(numSquares * 2) + 2] + 1;
 }
 
+int LegacyUtils::dataToClockTime(const char incomingData[]) {
+    int numSquares = 157;
+    // Four bytes, most significant first. They must be read unsigned, or any byte over 127 would be sign extended
+    const unsigned char* clockData = reinterpret_cast<const unsigned char*>(incomingData) + (numSquares * 2) + 3;
+    const uint32_t clockTime = (uint32_t(clockData[0]) << 24) | (uint32_t(clockData[1]) << 16)
+                               | (uint32_t(clockData[2]) << 8) | uint32_t(clockData[3]);
+    return int32_t(clockTime);
+}
+
 int LegacyUtils::pieceToModernRelativeIndex(const Piece* t_piece, const Board* t_board) {
     if (t_piece == nullptr) {
         return -1;
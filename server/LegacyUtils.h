@@ -17,6 +17,8 @@ public:
     static int pieceToModernRelativeIndex(const Piece* t_piece, const Board* t_board);
     static std::string moveToMoveData(const Move& m, const Piece* activePiece, const bool gameIsOver, const Board* board);
     static short dataToPlayerTurn(const char incomingData[]);
+    // Milliseconds left on the clock of the player to move. 0 or less if the game isn't timed
+    static int dataToClockTime(const char incomingData[]);
 
 };
 
@@ -20,6 +20,9 @@
 #include "../duchess/PositionUtils.h"
 #include "../duchess/PieceType.h"
 
+#include "../player/TimeControl.h"
+#include "../player/TimeManager.h"
+
 // Unfortunately we need this to be a static variable, as the signal_handler callback needs to be able to change
 // it without having a Server object explicitly passed
 bool Server::isRunning = true;
@@ -114,6 +117,7 @@ void Server::run() {
             b.initialiseAttDefVectors();
 
             short playerTurn = LegacyUtils::dataToPlayerTurn(incoming_data_buffer);
+            b.setSideToMove(playerTurn);
             // Update the turn number
             if (turnNumber == -1) {
                 turnNumber = playerTurn;
@@ -123,8 +127,13 @@ void Server::run() {
                 turnNumber += playerTurn - lastTurn + 6;
             }
 
+            // Share out what's left on our clock, unless the game isn't timed
+            const int clockTime = LegacyUtils::dataToClockTime(incoming_data_buffer);
+            const TimeControl timeControl = clockTime > 0 ? TimeControl::remainingClock(clockTime)
+                                                          : TimeControl::perMove(TimeManager::DEFAULT_BUDGET_MILLIS);
+
             this->getPlayer()->setPlayerNumber(playerTurn);
-            const Move move = this->getPlayer()->chooseMove(&b, turnNumber);
+            const Move move = this->getPlayer()->chooseMove(&b, turnNumber, timeControl);
             const Piece* activePiece = b.getPieceAtPosition(move.getFromPosition());
             // Check that our move is legal
             std::cout << "Checking move legal: " << move.toString() << std::endl;
@@ -175,8 +184,7 @@ std::vector <std::vector<Piece>> Server::dataToPieces(const char incomingData[])
 
     int numPlayers = (incomingData[i] << 8) | incomingData[i + 1];
     assert(numPlayers == 6);
-//    int clockTime = (incomingData[i + 3] << 24) | (incomingData[i + 4] << 16)
-//                    | (incomingData[i + 5] << 8) | incomingData[i + 6];
+    // The clock time follows (see LegacyUtils::dataToClockTime)
 //    int randomMove = incomingData[i + 7];
 
     return pieces;
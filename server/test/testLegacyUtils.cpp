@@ -14,6 +14,7 @@ void TestLegacyUtils::runTests() {
     TestLegacyUtils::test_legacyPieceNumberToOwner();
     TestLegacyUtils::test_legacySquareToPosition();
     TestLegacyUtils::test_positionToLegacyPosIndex();
+    TestLegacyUtils::test_dataToClockTime();
 }
 
 void TestLegacyUtils::test_legacyPieceNumberToPieceIndex() {
@@ -276,3 +277,25 @@ void TestLegacyUtils::test_positionToLegacyPosIndex() {
     assert(LegacyUtils::positionToLegacyPosIndex(&vortex) == indexVortex);
     assert(LegacyUtils::positionToLegacyPosIndex(&offBoard) == indexOB);
 }
+
+void TestLegacyUtils::test_dataToClockTime() {
+    const int numSquares = 157;
+    char data[numSquares * 2 + 8] = {0};
+    const int clockOffset = numSquares * 2 + 3;
+
+    assert(LegacyUtils::dataToClockTime(data) == 0);
+
+    // 5 minutes, with bytes that would go negative if read as signed chars
+    const int fiveMinutes = 300000;
+    data[clockOffset] = char((fiveMinutes >> 24) & 0xFF);
+    data[clockOffset + 1] = char((fiveMinutes >> 16) & 0xFF);
+    data[clockOffset + 2] = char((fiveMinutes >> 8) & 0xFF);
+    data[clockOffset + 3] = char(fiveMinutes & 0xFF);
+    assert((unsigned char) data[clockOffset + 2] > 127);
+    assert(LegacyUtils::dataToClockTime(data) == fiveMinutes);
+
+    // The player turn just before it is unaffected
+    data[numSquares * 2 + 2] = 4;
+    assert(LegacyUtils::dataToPlayerTurn(data) == 5);
+    assert(LegacyUtils::dataToClockTime(data) == fiveMinutes);
+}
@@ -9,6 +9,7 @@ private:
     static void test_legacyPieceNumberToOwner();
     static void test_legacySquareToPosition();
     static void test_positionToLegacyPosIndex();
+    static void test_dataToClockTime();
 };
 
 #endif //DUCHESS_CPP_TESTLEGACYUTILS_H